@@ -20,6 +20,7 @@
 
 #include "stdio.h"
 #include "co_core.h"
+#include "co_pdo_plan.h"
 
 void COTmrLock  (void);
 void COTmrUnlock(void);
@@ -195,27 +196,22 @@ int16_t COParaDefault(struct CO_PARA_T *pg)
 WEAK
 void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 {
-    (void)frm;
-    (void)pos;
-    (void)size;
-    (void)obj;
-
     /* Optional: place here some code, which is called
      * when a PDO is received with mapped values with
-     * a size larger than 4 byte.
+     * a size larger than 4 byte. The default writes the
+     * 64-bit, 48-bit and REAL64 basic types.
      */
+    CORPdoWrWide(frm, pos, size, obj);
 }
 
 WEAK
 void COTpdoReadData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 {
-    (void)frm;
-    (void)pos;
-    (void)size;
-    (void)obj;
-
     /* Optional: place here some code, which is called
      * when a PDO is constructed for transmission which
      * needs a mapped values with a size larger than 4 byte.
+     * The default reads the 64-bit, 48-bit and REAL64
+     * basic types.
      */
+    COTPdoRdWide(frm, pos, size, obj);
 }
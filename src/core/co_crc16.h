@@ -0,0 +1,114 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CRC16_H_
+#define CO_CRC16_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief CRC16 PROVIDER
+*
+*    This function type continues the CiA 301 block transfer CRC (CRC-16
+*    CCITT: polynomial 0x1021, initial value 0, no reflection, no final
+*    xor) with the given data. The result of a call is the start value
+*    of the next call, so a domain can be processed in segments.
+*/
+typedef uint16_t (*CO_CRC16_FUNC)(uint16_t crc, const uint8_t *data, uint32_t len);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CRC16 REFERENCE
+*
+* \details  This function calculates the CRC bit by bit. It needs no tables
+*           and is the reference for the other providers.
+*
+* \param    crc
+*           CRC of the previous data (0 for the first segment)
+*
+* \param    data
+*           pointer to the data
+*
+* \param    len
+*           number of bytes
+*
+* \return   CRC including the given data
+*/
+/*---------------------------------------------------------------------------*/
+uint16_t COCrc16Ref(uint16_t crc, const uint8_t *data, uint32_t len);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CRC16 SLICE-BY-4
+*
+* \details  This function calculates the CRC with four constant lookup
+*           tables (2 KiB), which consume 4 bytes per step. Remaining
+*           bytes are processed with the first table.
+*
+* \param    crc
+*           CRC of the previous data (0 for the first segment)
+*
+* \param    data
+*           pointer to the data
+*
+* \param    len
+*           number of bytes
+*
+* \return   CRC including the given data
+*/
+/*---------------------------------------------------------------------------*/
+uint16_t COCrc16Slice4(uint16_t crc, const uint8_t *data, uint32_t len);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CRC16 OF BUILD
+*
+* \details  This function calculates the CRC with the provider, which is
+*           selected at build time with CO_CRC16_CALC (default:
+*           COCrc16Slice4). The firmware selects the DMA sniffer provider
+*           RP2350Crc16Dma() with the CMake option CO_CRC16=DMA.
+*
+* \param    crc
+*           CRC of the previous data (0 for the first segment)
+*
+* \param    data
+*           pointer to the data
+*
+* \param    len
+*           number of bytes
+*
+* \return   CRC including the given data
+*/
+/*---------------------------------------------------------------------------*/
+uint16_t COCrc16(uint16_t crc, const uint8_t *data, uint32_t len);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
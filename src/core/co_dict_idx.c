@@ -0,0 +1,150 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_dict_idx.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* mask the index and subindex from a object entry key */
+#define CO_DICT_IDX_DEV(key)   ((uint32_t)(key) & 0xFFFFFF00uL)
+
+/* multiplicative hash (golden ratio) of index and subindex */
+#define CO_DICT_IDX_HASH(idx,key)   \
+    ((uint32_t)((CO_DICT_IDX_DEV(key) >> 8) * 0x9E3779B1uL) >> (idx)->Shift)
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t CODictIdxInit(CO_DICT_IDX *idx, CO_DICT *cod, uint16_t *slot, uint32_t num)
+{
+    CO_OBJ   *obj;
+    uint32_t  used = 0;
+    uint32_t  size = 1;
+    uint32_t  pos;
+    uint32_t  hash;
+    uint8_t   bits = 0;
+    uint8_t   probe;
+
+    if ((idx == 0) || (cod == 0) || (slot == 0)) {
+        return (-1);
+    }
+    CODictIdxClear(idx);
+
+    obj = cod->Root;                            /* count used object entries */
+    if (obj != 0) {
+        while ((used < cod->Max) && (obj->Key != 0)) {
+            used++;
+            obj++;
+        }
+    }
+    if ((used == 0) || (used > 0xFFFEu)) {
+        return (-1);
+    }
+
+    while ((bits < 16) && ((size << 1) <= num)) {   /* largest power of two */
+        size <<= 1;
+        bits++;
+    }
+    if (size <= used) {                            /* no free slot in table */
+        return (-1);
+    }
+
+    idx->Shift    = (uint8_t)(32u - bits);
+    idx->MaxProbe = 0;
+    for (hash = 0; hash < size; hash++) {
+        slot[hash] = 0;
+    }
+    for (pos = 0; pos < used; pos++) {
+        hash  = CO_DICT_IDX_HASH(idx, cod->Root[pos].Key);
+        probe = 1;
+        while (slot[hash] != 0) {                         /* linear probing */
+            hash = (hash + 1) & (size - 1);
+            if (probe < 0xFFu) {
+                probe++;
+            }
+        }
+        slot[hash] = (uint16_t)(pos + 1);
+        if (probe > idx->MaxProbe) {
+            idx->MaxProbe = probe;
+        }
+    }
+
+    idx->Slot = slot;
+    idx->Num  = used;
+    idx->Dict = cod;
+
+    return ((int16_t)used);
+}
+
+/*
+* see function definition
+*/
+CO_OBJ *CODictIdxFind(CO_DICT_IDX *idx, uint32_t key)
+{
+    CO_OBJ   *obj;
+    uint32_t  mask;
+    uint32_t  hash;
+    uint16_t  pos;
+    uint8_t   probe;
+
+    if ((idx == 0) || (idx->Dict == 0)) {
+        return ((CO_OBJ *)0);
+    }
+
+    key   = CO_DICT_IDX_DEV(key);
+    mask  = (0xFFFFFFFFuL >> idx->Shift);
+    hash  = CO_DICT_IDX_HASH(idx, key);
+    probe = idx->MaxProbe;
+    while (probe > 0) {
+        pos = idx->Slot[hash];
+        if (pos == 0) {                         /* free slot: not in index */
+            break;
+        }
+        obj = &idx->Dict->Root[pos - 1];
+        if (CO_DICT_IDX_DEV(obj->Key) == key) {
+            return (obj);
+        }
+        hash = (hash + 1) & mask;
+        probe--;
+    }
+
+    return ((CO_OBJ *)0);
+}
+
+/*
+* see function definition
+*/
+void CODictIdxClear(CO_DICT_IDX *idx)
+{
+    if (idx == 0) {
+        return;
+    }
+    idx->Dict     = 0;
+    idx->Slot     = 0;
+    idx->Num      = 0;
+    idx->Shift    = 32;
+    idx->MaxProbe = 0;
+}
@@ -0,0 +1,143 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_DICT_IDX_H_
+#define CO_DICT_IDX_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief NUMBER OF INDEX SLOTS FOR THE NODE DICTIONARY
+*
+* \details The number of hash slots, which are allocated for the automatic
+*          index of the node object dictionary (see CO_DICT_IDX_WRAP). Each
+*          slot needs 2 bytes. The number of slots must be larger than the
+*          number of object entries, otherwise CODictInit() fails; a load
+*          factor of 0.5 or less keeps the number of probes per lookup close
+*          to 1. Set with the CMake cache variable CO_DICT_IDX_SLOTS.
+*/
+/*---------------------------------------------------------------------------*/
+#ifndef CO_DICT_IDX_SLOTS
+#define CO_DICT_IDX_SLOTS   2048u
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief OBJECT DICTIONARY INDEX
+*
+*    This structure holds an open addressing hash table, which maps the
+*    index and subindex of an object entry to the position of this entry
+*    within the object entry array of the object dictionary.
+*
+*    With CO_DICT_IDX_WRAP, the index serves the calls of CODictFind(), which
+*    are linked from other modules (e.g. COObjRdValue() and the services of
+*    the extensions). The stack functions CODictRdByte(), CODictRdWord(),
+*    CODictRdLong(), CODictWrByte(), CODictWrWord() and CODictWrLong() call
+*    CODictFind() within the stack module co_dict.c. The linker does not
+*    redirect these calls, so they keep the binary search of the stack. The
+*    stack uses them mainly while the services are set up (e.g. PDO and SDO
+*    configuration after a reset), not per received frame.
+*/
+typedef struct CO_DICT_IDX_T {
+    CO_DICT  *Dict;            /*!< indexed object dictionary               */
+    uint16_t *Slot;            /*!< hash slots (entry position + 1, 0=free) */
+    uint32_t  Num;             /*!< number of indexed object entries        */
+    uint8_t   Shift;           /*!< hash shift (32 - log2(number of slots)) */
+    uint8_t   MaxProbe;        /*!< longest probe sequence in hash table    */
+} CO_DICT_IDX;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BUILD OBJECT DICTIONARY INDEX
+*
+* \details  This function builds the hash index for all object entries of
+*           the given (initialized) object dictionary. The largest power of
+*           two, which fits into the given slot memory, is used as hash table
+*           size.
+*
+* \param    idx
+*           reference to the object dictionary index
+*
+* \param    cod
+*           reference to the initialized object dictionary
+*
+* \param    slot
+*           pointer to the slot memory for the hash table
+*
+* \param    num
+*           number of available slots in the slot memory
+*
+* \retval   >=0    number of indexed object entries
+* \retval   <0     index not usable (too few slots, bad arguments)
+*/
+/*---------------------------------------------------------------------------*/
+int16_t CODictIdxInit(CO_DICT_IDX *idx, CO_DICT *cod, uint16_t *slot, uint32_t num);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FIND OBJECT ENTRY WITH INDEX
+*
+* \details  This function searches the object entry with the given key in
+*           the hash index. The found object entry is verified against the
+*           requested key, therefore a modified object dictionary never
+*           returns a wrong object entry; instead the function returns NULL
+*           and the caller should fall back to CODictFind().
+*
+* \param    idx
+*           reference to the object dictionary index
+*
+* \param    key
+*           object entry key; should be generated with the macro CO_DEV()
+*
+* \retval   >0    pointer to the identified object entry
+* \retval   =0    object entry is not in index
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ *CODictIdxFind(CO_DICT_IDX *idx, uint32_t key);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CLEAR OBJECT DICTIONARY INDEX
+*
+* \details  This function detaches the index from the object dictionary.
+*           All following lookups with this index will miss.
+*
+* \param    idx
+*           reference to the object dictionary index
+*/
+/*---------------------------------------------------------------------------*/
+void CODictIdxClear(CO_DICT_IDX *idx);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
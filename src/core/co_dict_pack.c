@@ -0,0 +1,309 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_dict_pack.h"
+#include "co_real32.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* mask the index and subindex from a object entry key */
+#define CO_DICT_PACK_DEV(key)   ((uint32_t)(key) & 0xFFFFFF00uL)
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* list of registered packed dictionaries */
+static CO_DICT_PACK *PackList = 0;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK FOR BASIC TYPE
+*
+* \details  Basic integer and floating point types with up to 4 bytes are
+*           transferred with expedited SDO transfers, so the stack accesses
+*           them within a single call and they can be presented as temporary
+*           view. Wider types (48 and 64 bit) need segmented transfers, in
+*           which the SDO server keeps the object entry over several frames.
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t CODictPackIsBasic(const CO_OBJ_TYPE *type)
+{
+    return (uint8_t)((type == &COTUnsigned8)  || (type == &COTSigned8)  ||
+                     (type == &COTUnsigned16) || (type == &COTSigned16) ||
+                     (type == &COTUnsigned32) || (type == &COTSigned32) ||
+                     (type == &COTReal32));
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEARCH SORTED KEY
+*
+* \details  Binary search of the key in an array of object entries, which
+*           starts with the key. The entries are given by the address of
+*           the first key and the distance of the entries in bytes.
+*
+* \retval   <num  position of the entry with the key
+* \retval   =num  key not found
+*/
+/*---------------------------------------------------------------------------*/
+static uint32_t CODictPackSearch(const uint8_t *base, uint32_t step, uint32_t num, uint32_t dev)
+{
+    uint32_t lo = 0;
+    uint32_t hi = num;
+    uint32_t mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) >> 1;
+        if (CO_DICT_PACK_DEV(*(const uint32_t *)&base[mid * step]) < dev) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if ((lo < num) &&
+        (CO_DICT_PACK_DEV(*(const uint32_t *)&base[lo * step]) == dev)) {
+        return (lo);
+    }
+    return (num);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET TYPE TABLE INDEX
+*
+* \details  Search the given type in the type table and append it, if it
+*           is not present.
+*
+* \retval   >=0   type table index
+* \retval   <0    type table is full
+*/
+/*---------------------------------------------------------------------------*/
+static int32_t CODictPackTypeIdx(CO_DICT_PACK *pack, const CO_OBJ_TYPE *type)
+{
+    uint16_t n;
+
+    for (n = 0; n < pack->TypeNum; n++) {
+        if (pack->Mem.Type[n] == type) {
+            return ((int32_t)n);
+        }
+    }
+    if ((pack->TypeNum >= pack->Mem.TypeMax) ||
+        (pack->TypeNum >= CO_DICT_PACK_TYPE_MAX)) {
+        return (-1);
+    }
+    pack->Mem.Type[pack->TypeNum] = type;
+    pack->TypeNum++;
+
+    return ((int32_t)n);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t CODictPackInit(CO_DICT_PACK *pack, const CO_DICT_PACK_SPEC *spec)
+{
+    CO_DICT_PACK *p;
+
+    if ((pack == 0) || (spec == 0) ||
+        (spec->Entry == 0) || (spec->TypeIdx == 0) || (spec->Type == 0)) {
+        return (-1);
+    }
+
+    pack->Dict     = 0;
+    pack->Mem      = *spec;
+    pack->EntryNum = 0;
+    pack->TypeNum  = 0;
+    pack->PinNum   = 0;
+    pack->RingPos  = 0;
+    pack->Anchor.Key  = 0;                      /* end-marker */
+    pack->Anchor.Type = 0;
+    pack->Anchor.Data = 0;
+
+    p = PackList;                               /* register once */
+    while ((p != 0) && (p != pack)) {
+        p = p->Next;
+    }
+    if (p == 0) {
+        pack->Next = PackList;
+        PackList   = pack;
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+int16_t CODictPackAdd(CO_DICT_PACK *pack, uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data)
+{
+    CO_OBJ_PACK *entry;
+    CO_OBJ      *pin;
+    uint32_t     last = 0;
+    int32_t      tidx;
+
+    if ((pack == 0) || (type == 0) || (CO_DICT_PACK_DEV(key) == 0)) {
+        return (-1);
+    }
+    if (pack->EntryNum > 0) {
+        last = CO_DICT_PACK_DEV(pack->Mem.Entry[pack->EntryNum - 1].Key);
+    }
+    if ((pack->PinNum > 0) &&
+        (CO_DICT_PACK_DEV(pack->Mem.Pin[pack->PinNum - 1].Key) > last)) {
+        last = CO_DICT_PACK_DEV(pack->Mem.Pin[pack->PinNum - 1].Key);
+    }
+    if (last >= CO_DICT_PACK_DEV(key)) {
+        return (-1);                            /* bad order or duplicate */
+    }
+
+    if ((CO_IS_PDOMAP(key) != 0) || (CODictPackIsBasic(type) == 0)) {
+        if ((pack->Mem.Pin == 0) || ((pack->PinNum + 1u) >= pack->Mem.PinMax)) {
+            return (-1);                        /* keep room for end-marker */
+        }
+        pin       = &pack->Mem.Pin[pack->PinNum];
+        pin->Key  = key;
+        pin->Type = type;
+        pin->Data = data;
+        pack->PinNum++;
+        pin++;
+        pin->Key  = 0;                          /* end-marker */
+        pin->Type = 0;
+        pin->Data = 0;
+        return (0);
+    }
+
+    if (pack->EntryNum >= pack->Mem.EntryMax) {
+        return (-1);
+    }
+    tidx = CODictPackTypeIdx(pack, type);
+    if (tidx < 0) {
+        return (-1);
+    }
+    entry       = &pack->Mem.Entry[pack->EntryNum];
+    entry->Key  = key;
+    entry->Data = data;
+    pack->Mem.TypeIdx[pack->EntryNum] = (uint8_t)tidx;
+    pack->EntryNum++;
+
+    return (0);
+}
+
+/*
+* see function definition
+*/
+CO_OBJ *CODictPackRoot(CO_DICT_PACK *pack)
+{
+    return (&pack->Anchor);
+}
+
+/*
+* see function definition
+*/
+uint16_t CODictPackSize(CO_DICT_PACK *pack)
+{
+    return ((uint16_t)(pack->EntryNum + pack->PinNum + 1));
+}
+
+/*
+* see function definition
+*/
+uint8_t CODictPackAttach(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max)
+{
+    CO_DICT_PACK *pack = PackList;
+
+    while (pack != 0) {
+        if (&pack->Anchor == root) {
+            pack->Dict = cod;
+            cod->Node  = node;
+            cod->Root  = (pack->PinNum > 0) ? pack->Mem.Pin : root;
+            cod->Num   = pack->PinNum;
+            cod->Max   = max;
+            return (1);
+        }
+        pack = pack->Next;
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+CO_DICT_PACK *CODictPackGet(CO_DICT *cod)
+{
+    CO_DICT_PACK *pack = PackList;
+
+    while ((pack != 0) && ((cod == 0) || (pack->Dict != cod))) {
+        pack = pack->Next;
+    }
+    return (pack);
+}
+
+/*
+* see function definition
+*/
+CO_OBJ *CODictPackFind(CO_DICT_PACK *pack, uint32_t key)
+{
+    CO_OBJ_PACK *entry;
+    CO_OBJ      *view;
+    uint32_t     dev;
+    uint32_t     pos;
+
+    if (pack == 0) {
+        return ((CO_OBJ *)0);
+    }
+
+    dev = CO_DICT_PACK_DEV(key);
+    pos = CODictPackSearch((const uint8_t *)pack->Mem.Entry,
+                           sizeof(CO_OBJ_PACK), pack->EntryNum, dev);
+    if (pos >= pack->EntryNum) {
+        if (pack->PinNum == 0) {
+            return ((CO_OBJ *)0);
+        }
+        pos = CODictPackSearch((const uint8_t *)pack->Mem.Pin,
+                               sizeof(CO_OBJ), pack->PinNum, dev);
+        if (pos >= pack->PinNum) {
+            return ((CO_OBJ *)0);
+        }
+        return (&pack->Mem.Pin[pos]);
+    }
+    entry = &pack->Mem.Entry[pos];
+
+    view = &pack->Ring[pack->RingPos];
+    pack->RingPos++;
+    if (pack->RingPos >= CO_DICT_PACK_RING) {
+        pack->RingPos = 0;
+    }
+    view->Type = (CO_OBJ_TYPE *)pack->Mem.Type[pack->Mem.TypeIdx[pos]];
+    if ((CO_IS_DIRECT(entry->Key) != 0) && (CO_IS_WRITE(entry->Key) != 0)) {
+        /* present direct value as reference (little endian word access) */
+        view->Key  = entry->Key & ~(uint32_t)CO_OBJ_D_____;
+        view->Data = (CO_DATA)(&entry->Data);
+    } else {
+        view->Key  = entry->Key;
+        view->Data = entry->Data;
+    }
+    return (view);
+}
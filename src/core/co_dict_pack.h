@@ -0,0 +1,249 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_DICT_PACK_H_
+#define CO_DICT_PACK_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief NUMBER OF TEMPORARY OBJECT ENTRY VIEWS
+*
+* \details Lookups of basic object entries return a temporary CO_OBJ view
+*          from a ring of this size. A view stays valid until this number
+*          of further lookups is done; the stack services use a view of a
+*          basic object entry with up to 4 bytes only within one call
+*          (expedited SDO transfer, PDO mapping check).
+*/
+/*---------------------------------------------------------------------------*/
+#ifndef CO_DICT_PACK_RING
+#define CO_DICT_PACK_RING   8u
+#endif
+
+/* largest number of object types in the type table of a packed dictionary */
+#define CO_DICT_PACK_TYPE_MAX   255u
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief PACKED OBJECT ENTRY
+*
+*    This structure holds a basic object entry without the type, which is
+*    stored as 8-bit index into the type table in a separate array. With
+*    the type index an entry needs 9 bytes instead of the 12 bytes of a
+*    CO_OBJ (32-bit targets).
+*/
+typedef struct CO_OBJ_PACK_T {
+    uint32_t Key;              /*!< object entry key (see CO_KEY())         */
+    CO_DATA  Data;             /*!< direct value or reference               */
+} CO_OBJ_PACK;
+
+/*! \brief PACKED OBJECT DICTIONARY MEMORY
+*
+*    This structure specifies the memory areas for a packed dictionary.
+*    The pinned object entry array needs one additional entry for the
+*    end-marker.
+*/
+typedef struct CO_DICT_PACK_SPEC_T {
+    CO_OBJ_PACK        *Entry;     /*!< packed object entry array           */
+    uint8_t            *TypeIdx;   /*!< type index per packed object entry  */
+    uint16_t            EntryMax;  /*!< length of packed object entry array */
+    const CO_OBJ_TYPE **Type;      /*!< object type table                   */
+    uint16_t            TypeMax;   /*!< length of object type table         */
+    CO_OBJ             *Pin;       /*!< pinned object entry array           */
+    uint16_t            PinMax;    /*!< length of pinned object entry array */
+} CO_DICT_PACK_SPEC;
+
+/*! \brief PACKED OBJECT DICTIONARY
+*
+*    This structure holds the management data of a packed dictionary.
+*/
+typedef struct CO_DICT_PACK_T {
+    struct CO_DICT_PACK_T *Next;     /*!< next registered packed dictionary */
+    CO_DICT               *Dict;     /*!< attached stack object dictionary  */
+    CO_DICT_PACK_SPEC      Mem;      /*!< memory specification              */
+    uint16_t               EntryNum; /*!< number of used packed entries     */
+    uint16_t               TypeNum;  /*!< number of used type table entries */
+    uint16_t               PinNum;   /*!< number of used pinned entries     */
+    CO_OBJ                 Anchor;   /*!< root handed to the stack          */
+    CO_OBJ                 Ring[CO_DICT_PACK_RING]; /*!< temporary views    */
+    uint8_t                RingPos;  /*!< next temporary view               */
+} CO_DICT_PACK;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT PACKED OBJECT DICTIONARY
+*
+* \details  This function initializes an empty packed dictionary with the
+*           given memory areas and registers it for the dictionary adapter.
+*
+* \param    pack
+*           reference to the packed dictionary
+*
+* \param    spec
+*           reference to the memory specification
+*
+* \retval   =0    packed dictionary is initialized
+* \retval   <0    bad arguments
+*/
+/*---------------------------------------------------------------------------*/
+int16_t CODictPackInit(CO_DICT_PACK *pack, const CO_DICT_PACK_SPEC *spec);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ADD OBJECT ENTRY TO PACKED DICTIONARY
+*
+* \details  This function appends an object entry, given in the usual
+*           CO_OBJ notation, to the packed dictionary. The object entries
+*           must be added in ascending order of index and subindex.
+*
+*           Basic object entries (integer and floating point types with up
+*           to 4 bytes) are packed. PDO mappable object entries, 48 and 64
+*           bit types and all non-basic types (domains, strings, user types)
+*           are pinned as CO_OBJ: the stack keeps pointers to these object
+*           entries over several calls (PDO mapping, segmented SDO
+*           transfer). A pinned entry needs the same memory as in a plain
+*           dictionary.
+*
+* \param    pack
+*           reference to the packed dictionary
+*
+* \param    key
+*           object entry key; generated with the macro CO_KEY()
+*
+* \param    type
+*           object type
+*
+* \param    data
+*           object data (value or reference, depending on key)
+*
+* \retval   =0    object entry added
+* \retval   <0    bad order, duplicate key or no free memory
+*/
+/*---------------------------------------------------------------------------*/
+int16_t CODictPackAdd(CO_DICT_PACK *pack, uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET ROOT OF PACKED OBJECT DICTIONARY
+*
+* \details  This function returns the object dictionary root, which must be
+*           set in the node specification (Dict). CODictInit() attaches the
+*           packed dictionary, when it is called with this root.
+*
+* \param    pack
+*           reference to the packed dictionary
+*
+* \return   root for the node specification
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ *CODictPackRoot(CO_DICT_PACK *pack);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET SIZE OF PACKED OBJECT DICTIONARY
+*
+* \details  This function returns the dictionary size, which must be set in
+*           the node specification (DictLen).
+*
+* \param    pack
+*           reference to the packed dictionary
+*
+* \return   number of object entries including the end-marker
+*/
+/*---------------------------------------------------------------------------*/
+uint16_t CODictPackSize(CO_DICT_PACK *pack);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ATTACH PACKED OBJECT DICTIONARY
+*
+* \details  This function checks, if the given root belongs to a registered
+*           packed dictionary and attaches it to the stack dictionary. It is
+*           called by the wrapped CODictInit(). The stack dictionary holds
+*           the pinned object entries as root, so all PDO mappable entries
+*           have a stable position within the stack dictionary (see
+*           COTPdoDirtyMark()).
+*
+* \param    cod
+*           reference to the stack object dictionary
+*
+* \param    node
+*           reference to the parent node
+*
+* \param    root
+*           root given to CODictInit()
+*
+* \param    max
+*           size given to CODictInit()
+*
+* \retval   >0    packed dictionary attached
+* \retval   =0    root is no packed dictionary
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t CODictPackAttach(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET ATTACHED PACKED OBJECT DICTIONARY
+*
+* \param    cod
+*           reference to the stack object dictionary
+*
+* \retval   >0    packed dictionary, attached to this stack dictionary
+* \retval   =0    stack dictionary is not packed
+*/
+/*---------------------------------------------------------------------------*/
+CO_DICT_PACK *CODictPackGet(CO_DICT *cod);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FIND OBJECT ENTRY IN PACKED DICTIONARY
+*
+* \details  This function searches the packed object entry and returns a
+*           CO_OBJ view of it. Pinned object entries are returned directly,
+*           all other object entries as temporary view (see
+*           CO_DICT_PACK_RING). Writable direct values are presented as
+*           reference to the value in the packed entry, so writes through
+*           the view are stored in the packed dictionary.
+*
+* \param    pack
+*           reference to the packed dictionary
+*
+* \param    key
+*           object entry key; should be generated with the macro CO_DEV()
+*
+* \retval   >0    pointer to the object entry view
+* \retval   =0    object entry not found
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ *CODictPackFind(CO_DICT_PACK *pack, uint32_t key);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,393 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_DICT_STATIC_HPP_
+#define CO_DICT_STATIC_HPP_
+
+/*! \file
+*
+*   Compile-time object dictionary builder (C++17, header only).
+*
+*   The object entries are declared as template arguments together with
+*   their backing variables. The builder sorts them at compile time,
+*   rejects duplicate keys, unsupported variable types and access flags
+*   which can not work with a read-only dictionary, and emits a constant
+*   CO_OBJ array terminated by the end-marker:
+*
+*   \code
+*   static uint8_t  ErrReg;
+*   static uint32_t SyncId = 0x80;
+*
+*   using AppDict = co::od::Dict<
+*       co::od::Ref<0x1005, 0, CO_OBJ_____RW, &SyncId>,
+*       co::od::Val<0x1000, 0, CO_OBJ_D___R_, uint32_t, 0x191>,
+*       co::od::Ref<0x1001, 0, CO_OBJ_____R_, &ErrReg>
+*   >;
+*
+*   spec.Dict    = AppDict::Get();
+*   spec.DictLen = AppDict::Size;
+*   CO_OBJ *obj  = AppDict::Find<0x1005, 0>();   // resolved at compile time
+*   \endcode
+*
+*   The array is a constexpr array of entries with the layout of CO_OBJ,
+*   so it is constant initialised and placed in read-only memory (flash)
+*   by every conforming compiler. For this reason, direct entries
+*   (CO_OBJ_D_____) must be read-only: the stack stores written direct
+*   values in the entry itself.
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "co_core.h"
+#include "co_real32.h"
+#include "co_real64.h"
+#include "co_signed64.h"
+#include "co_unsigned64.h"
+
+namespace co {
+namespace od {
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+namespace detail {
+
+/* all access flags, known by the stack */
+constexpr uint8_t AccMask = (uint8_t)(CO_OBJ_D_____ | CO_OBJ__N____ |
+                                      CO_OBJ___A___ | CO_OBJ____P__ |
+                                      CO_OBJ_____RW);
+
+/* object entry key without access flags */
+constexpr uint32_t Dev(uint16_t idx, uint8_t sub)
+{
+    return (((uint32_t)idx << 16) | ((uint32_t)sub << 8));
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief VARIABLE TYPE MAPPING
+*
+* \details Maps the C++ type of a backing variable to the stack object type.
+*          Variables without a specialization are rejected at compile time.
+*/
+/*---------------------------------------------------------------------------*/
+template <typename T> struct TypeOf {
+    static constexpr const CO_OBJ_TYPE *Type = nullptr;
+};
+template <> struct TypeOf<uint8_t>  { static constexpr const CO_OBJ_TYPE *Type = &COTUnsigned8;  };
+template <> struct TypeOf<uint16_t> { static constexpr const CO_OBJ_TYPE *Type = &COTUnsigned16; };
+template <> struct TypeOf<uint32_t> { static constexpr const CO_OBJ_TYPE *Type = &COTUnsigned32; };
+template <> struct TypeOf<int8_t>   { static constexpr const CO_OBJ_TYPE *Type = &COTSigned8;    };
+template <> struct TypeOf<int16_t>  { static constexpr const CO_OBJ_TYPE *Type = &COTSigned16;   };
+template <> struct TypeOf<int32_t>  { static constexpr const CO_OBJ_TYPE *Type = &COTSigned32;   };
+template <> struct TypeOf<uint64_t> { static constexpr const CO_OBJ_TYPE *Type = &COTUnsigned64; };
+template <> struct TypeOf<int64_t>  { static constexpr const CO_OBJ_TYPE *Type = &COTSigned64;   };
+template <> struct TypeOf<float>    { static constexpr const CO_OBJ_TYPE *Type = &COTReal32;     };
+template <> struct TypeOf<double>   { static constexpr const CO_OBJ_TYPE *Type = &COTReal64;     };
+template <> struct TypeOf<CO_OBJ_DOM> { static constexpr const CO_OBJ_TYPE *Type = &COTDomain;   };
+template <> struct TypeOf<CO_OBJ_STR> { static constexpr const CO_OBJ_TYPE *Type = &COTString;   };
+
+/*---------------------------------------------------------------------------*/
+/*! \brief CONSTANT OBJECT ENTRY DATA
+*
+* \details The data of an object entry is either the address of the
+*          backing variable or the direct value. A pointer can not be
+*          converted to CO_DATA in a constant expression, therefore the
+*          address is kept as pointer member. Both members have the size
+*          and representation of CO_DATA.
+*/
+/*---------------------------------------------------------------------------*/
+union Data {
+    const void *Ptr;
+    CO_DATA     Val;
+
+    constexpr explicit Data(const void *ptr) : Ptr(ptr) { }
+    constexpr explicit Data(CO_DATA val) : Val(val) { }
+};
+
+/*---------------------------------------------------------------------------*/
+/*! \brief CONSTANT OBJECT ENTRY
+*
+* \details Object entry with the memory layout of CO_OBJ, which can be
+*          initialised in a constant expression.
+*/
+/*---------------------------------------------------------------------------*/
+struct Obj {
+    uint32_t                  Key;
+    decltype(CO_OBJ::Type)    Type;
+    Data                      Dat;
+};
+
+static_assert(sizeof(const void *) == sizeof(CO_DATA),
+    "CO_DATA does not have the size of an address");
+static_assert((sizeof(Obj) == sizeof(CO_OBJ)) &&
+              (offsetof(Obj, Key)  == offsetof(CO_OBJ, Key))  &&
+              (offsetof(Obj, Type) == offsetof(CO_OBJ, Type)) &&
+              (offsetof(Obj, Dat)  == offsetof(CO_OBJ, Data)),
+    "constant object entry does not match CO_OBJ");
+
+/*---------------------------------------------------------------------------*/
+/*! \brief COMMON ENTRY CHECKS
+*
+* \details Checks, which are independent of the kind of object entry.
+*/
+/*---------------------------------------------------------------------------*/
+template <uint16_t Idx, uint8_t Sub, uint8_t Acc>
+struct Entry {
+    static_assert(Idx != 0,
+        "index 0 is reserved for the end-marker");
+    static_assert((Acc & (uint8_t)~AccMask) == 0,
+        "unknown access flags");
+    static_assert((Acc & CO_OBJ_____RW) != 0,
+        "object entry is neither readable nor writable");
+
+    static constexpr uint32_t Key = CO_KEY(Idx, Sub, Acc);
+};
+
+/*---------------------------------------------------------------------------*/
+/*! \brief SORTED ENTRY ORDER
+*
+* \details Returns the positions of the given keys in ascending key order.
+*          Insertion sort is sufficient for compile-time use.
+*/
+/*---------------------------------------------------------------------------*/
+template <std::size_t N>
+constexpr std::array<std::size_t, N> Order(const std::array<uint32_t, N> &key)
+{
+    std::array<std::size_t, N> pos{};
+    for (std::size_t i = 0; i < N; i++) {
+        pos[i] = i;
+    }
+    for (std::size_t i = 1; i < N; i++) {
+        std::size_t x = pos[i];
+        std::size_t j = i;
+        while ((j > 0) && ((key[pos[j - 1]] & 0xFFFFFF00u) > (key[x] & 0xFFFFFF00u))) {
+            pos[j] = pos[j - 1];
+            j--;
+        }
+        pos[j] = x;
+    }
+    return (pos);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief CHECK FOR DUPLICATE KEYS
+*
+* \details Returns true, if the sorted key list contains an index/subindex
+*          pair twice.
+*/
+/*---------------------------------------------------------------------------*/
+template <std::size_t N>
+constexpr bool HasDuplicate(const std::array<uint32_t, N> &key,
+                            const std::array<std::size_t, N> &pos)
+{
+    for (std::size_t i = 1; i < N; i++) {
+        if ((key[pos[i - 1]] & 0xFFFFFF00u) == (key[pos[i]] & 0xFFFFFF00u)) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief OBJECT ENTRY TABLE
+*
+* \details Holds the constexpr object entry array for an already sorted
+*          list of entries.
+*/
+/*---------------------------------------------------------------------------*/
+template <typename... E>
+struct Table {
+    static constexpr Obj Root[sizeof...(E) + 1] = {
+        { E::Key, E::Type, E::Dat }...,
+        { 0, nullptr, Data((CO_DATA)0) }                 /* end-marker */
+    };
+};
+
+template <typename List, typename Seq, const auto &Pos> struct SortedTable;
+
+template <typename... E, std::size_t... I, const auto &Pos>
+struct SortedTable<std::tuple<E...>, std::index_sequence<I...>, Pos> {
+    using Type = Table<std::tuple_element_t<Pos[I], std::tuple<E...>>...>;
+};
+
+} /* namespace detail */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief INDIRECT OBJECT ENTRY
+*
+* \details Object entry at Idx:Sub, which references the variable Var. The
+*          object type is derived from the variable type.
+*/
+/*---------------------------------------------------------------------------*/
+template <uint16_t Idx, uint8_t Sub, uint8_t Acc, auto *Var>
+struct Ref : detail::Entry<Idx, Sub, Acc> {
+    using Var_t = std::remove_pointer_t<decltype(Var)>;
+    using Raw_t = std::remove_cv_t<Var_t>;
+
+    static_assert(!CO_IS_DIRECT(Acc),
+        "referenced variable with direct access flag, use Val<>");
+    static_assert(detail::TypeOf<Raw_t>::Type != nullptr,
+        "no object type for this variable type, use TypedRef<>");
+    static_assert(!(CO_IS_WRITE(Acc) && std::is_const<Var_t>::value),
+        "writable object entry references a constant variable");
+    static_assert(!CO_IS_PDOMAP(Acc) || (sizeof(Raw_t) <= 8),
+        "PDO mappable object entry is larger than 8 bytes");
+
+    static constexpr const CO_OBJ_TYPE *Type = detail::TypeOf<Raw_t>::Type;
+    static constexpr detail::Data       Dat  = detail::Data(Var);
+};
+
+/*---------------------------------------------------------------------------*/
+/*! \brief DIRECT OBJECT ENTRY
+*
+* \details Read-only object entry at Idx:Sub with the constant V stored in
+*          the entry itself.
+*/
+/*---------------------------------------------------------------------------*/
+template <uint16_t Idx, uint8_t Sub, uint8_t Acc, typename T, T V>
+struct Val : detail::Entry<Idx, Sub, Acc> {
+    static_assert(CO_IS_DIRECT(Acc),
+        "constant value without direct access flag");
+    static_assert(!CO_IS_WRITE(Acc),
+        "direct object entries are read-only in a constant dictionary");
+    static_assert(detail::TypeOf<T>::Type != nullptr,
+        "no object type for this value type");
+    static_assert(sizeof(T) <= sizeof(CO_DATA),
+        "value does not fit into a direct object entry");
+
+    static constexpr const CO_OBJ_TYPE *Type = detail::TypeOf<T>::Type;
+    static constexpr detail::Data       Dat  = detail::Data((CO_DATA)V);
+};
+
+/*---------------------------------------------------------------------------*/
+/*! \brief INDIRECT OBJECT ENTRY WITH EXPLICIT TYPE
+*
+* \details Object entry at Idx:Sub with the object type Ty, which references
+*          Var. Use this for user types and special stack types.
+*/
+/*---------------------------------------------------------------------------*/
+template <uint16_t Idx, uint8_t Sub, uint8_t Acc, const CO_OBJ_TYPE *Ty, auto *Var>
+struct TypedRef : detail::Entry<Idx, Sub, Acc> {
+    static_assert(!CO_IS_DIRECT(Acc),
+        "referenced variable with direct access flag, use TypedVal<>");
+    static_assert(Ty != nullptr,
+        "missing object type");
+
+    static constexpr const CO_OBJ_TYPE *Type = Ty;
+    static constexpr detail::Data       Dat  = detail::Data(Var);
+};
+
+/*---------------------------------------------------------------------------*/
+/*! \brief DIRECT OBJECT ENTRY WITH EXPLICIT TYPE
+*
+* \details Read-only object entry at Idx:Sub with the object type Ty and the
+*          constant V, e.g. a fixed PDO COB-ID with CO_TPDO_ID.
+*/
+/*---------------------------------------------------------------------------*/
+template <uint16_t Idx, uint8_t Sub, uint8_t Acc, const CO_OBJ_TYPE *Ty, uint32_t V>
+struct TypedVal : detail::Entry<Idx, Sub, Acc> {
+    static_assert(CO_IS_DIRECT(Acc),
+        "constant value without direct access flag");
+    static_assert(!CO_IS_WRITE(Acc),
+        "direct object entries are read-only in a constant dictionary");
+    static_assert(Ty != nullptr,
+        "missing object type");
+
+    static constexpr const CO_OBJ_TYPE *Type = Ty;
+    static constexpr detail::Data       Dat  = detail::Data((CO_DATA)V);
+};
+
+/*---------------------------------------------------------------------------*/
+/*! \brief CONSTANT OBJECT DICTIONARY
+*
+* \details Collects the object entries E, sorts them ascending by index and
+*          subindex and provides the constant object entry array.
+*/
+/*---------------------------------------------------------------------------*/
+template <typename... E>
+class Dict {
+    static constexpr std::size_t N = sizeof...(E);
+
+    static_assert(N > 0, "empty object dictionary");
+    static_assert(N < 0xFFFFu, "too many object entries");
+
+    static constexpr std::array<uint32_t, N>    Keys = {{ E::Key... }};
+    static constexpr std::array<std::size_t, N> Pos  = detail::Order<N>(Keys);
+
+    static_assert(!detail::HasDuplicate<N>(Keys, Pos),
+        "duplicate index/subindex in object dictionary");
+
+    using Table = typename detail::SortedTable<
+        std::tuple<E...>, std::make_index_sequence<N>, Pos>::Type;
+
+    template <uint32_t Dev>
+    static constexpr std::size_t Locate(void)
+    {
+        for (std::size_t i = 0; i < N; i++) {
+            if ((Keys[Pos[i]] & 0xFFFFFF00u) == Dev) {
+                return (i);
+            }
+        }
+        return (N);
+    }
+
+public:
+    /*! number of object entries, including the end-marker */
+    static constexpr uint16_t Size = (uint16_t)(N + 1);
+
+    /*! \brief Returns the first object entry for the node specification. The
+    *   stack API is not const-qualified; the entries are never written. */
+    static CO_OBJ *Get(void)
+    {
+        return (reinterpret_cast<CO_OBJ *>(const_cast<detail::Obj *>(&Table::Root[0])));
+    }
+
+    /*! \brief Position of object entry Idx:Sub in the sorted array. */
+    template <uint16_t Idx, uint8_t Sub>
+    static constexpr std::size_t Index(void)
+    {
+        constexpr std::size_t pos = Locate<detail::Dev(Idx, Sub)>();
+        static_assert(pos < N, "object entry is not in the dictionary");
+        return (pos);
+    }
+
+    /*! \brief Object entry Idx:Sub, resolved at compile time. This is the
+    *   equivalent of CODictFind() for keys known at compile time. */
+    template <uint16_t Idx, uint8_t Sub>
+    static CO_OBJ *Find(void)
+    {
+        return (Get() + Index<Idx, Sub>());
+    }
+};
+
+} /* namespace od */
+} /* namespace co */
+
+#endif  /* #ifndef CO_DICT_STATIC_HPP_ */
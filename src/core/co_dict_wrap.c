@@ -0,0 +1,121 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_dict_idx.h"
+#include "co_dict_pack.h"
+
+#if CO_DICT_IDX_WRAP || CO_DICT_PACK_WRAP
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+#if CO_DICT_IDX_WRAP
+/* index of the node object dictionary */
+static CO_DICT_IDX DictIdx;
+/* allocate memory for the index of the node object dictionary */
+static uint16_t DictIdxSlot[CO_DICT_IDX_SLOTS];
+#endif
+
+/******************************************************************************
+* LINKER WRAPPED STACK FUNCTIONS
+******************************************************************************/
+
+int16_t __real_CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max);
+CO_OBJ *__real_CODictFind(CO_DICT *cod, uint32_t key);
+
+int16_t __wrap_CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max);
+CO_OBJ *__wrap_CODictFind(CO_DICT *cod, uint32_t key);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT OBJECT DICTIONARY (WRAPPED)
+*
+* \details  A root of a registered packed dictionary is attached without the
+*           stack function. Otherwise initialize the object dictionary with
+*           the stack function and build the hash index for the node object
+*           dictionary afterwards. When the dictionary does not fit into the
+*           CO_DICT_IDX_SLOTS slots, the initialization fails with the node
+*           error CO_ERR_OBJ_INIT instead of silently falling back to the
+*           binary search of the stack.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t __wrap_CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max)
+{
+    int16_t err;
+
+#if CO_DICT_PACK_WRAP
+    if (CODictPackAttach(cod, node, root, max) != 0) {
+        return (0);
+    }
+#endif
+    err = __real_CODictInit(cod, node, root, max);
+#if CO_DICT_IDX_WRAP
+    if (err >= 0) {
+        if (CODictIdxInit(&DictIdx, cod, &DictIdxSlot[0], CO_DICT_IDX_SLOTS) < 0) {
+            if (node != 0) {
+                node->Error = CO_ERR_OBJ_INIT;  /* CO_DICT_IDX_SLOTS too small */
+            }
+            err = -1;
+        }
+    } else if (DictIdx.Dict == cod) {
+        CODictIdxClear(&DictIdx);
+    }
+#endif
+    return (err);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FIND OBJECT ENTRY (WRAPPED)
+*
+* \details  Lookup the object entry in the attached packed dictionary or in
+*           the hash index. Misses in the hash index are passed to the stack
+*           function; this keeps the error handling of the stack for unknown
+*           keys and finds object entries, which are added to a dynamic
+*           object dictionary after the index is built. Calls within the
+*           stack module co_dict.c (CODictRd/Wr functions) are not wrapped.
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ *__wrap_CODictFind(CO_DICT *cod, uint32_t key)
+{
+    CO_OBJ *obj = (CO_OBJ *)0;
+#if CO_DICT_PACK_WRAP
+    CO_DICT_PACK *pack;
+
+    pack = CODictPackGet(cod);
+    if (pack != 0) {
+        obj = CODictPackFind(pack, key);
+        if ((obj == 0) && (cod->Node != 0)) {
+            cod->Node->Error = CO_ERR_OBJ_NOT_FOUND;
+        }
+        return (obj);
+    }
+#endif
+#if CO_DICT_IDX_WRAP
+    if (DictIdx.Dict == cod) {
+        obj = CODictIdxFind(&DictIdx, key);
+    }
+#endif
+    if (obj == 0) {
+        obj = __real_CODictFind(cod, key);
+    }
+    return (obj);
+}
+
+#endif  /* #if CO_DICT_IDX_WRAP || CO_DICT_PACK_WRAP */
@@ -0,0 +1,231 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_dispatch.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* table entry: service (bit 15..12) and instance (bit 11..0) */
+#define CO_DISPATCH_ENTRY(svc,inst)  ((uint16_t)(((uint16_t)(svc) << 12) | ((inst) & 0x0FFFu)))
+#define CO_DISPATCH_SVC(entry)       ((uint8_t)((entry) >> 12))
+#define CO_DISPATCH_INST(entry)      ((uint16_t)((entry) & 0x0FFFu))
+
+/* COB-ID flags of the communication objects */
+#define CO_DISPATCH_COBID_OFF        0x80000000u   /* not valid / not used  */
+#define CO_DISPATCH_COBID_EXT        0x20000000u   /* 29-bit identifier     */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled dispatch table, rebuild request and NMT mode of table */
+static CO_NODE          *DispNode  = 0;
+static uint8_t           DispDirty = 1;
+static CO_MODE           DispMode  = CO_INVALID;
+
+/* service and instance of each 11-bit identifier */
+static uint16_t          DispTable[CO_DISPATCH_ID_N];
+
+/* dispatch table counters */
+static CO_DISPATCH_STAT  DispStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SET TABLE ENTRY
+*/
+/*---------------------------------------------------------------------------*/
+static void CODispatchSet(uint32_t id, uint8_t svc, uint16_t inst)
+{
+    if (id >= CO_DISPATCH_ID_N) {
+        return;
+    }
+    if (DispTable[id] == 0) {
+        DispStat.Used++;
+    }
+    DispTable[id] = CO_DISPATCH_ENTRY(svc, inst);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SET TABLE ENTRY OF COB-ID OBJECT
+*
+* \details  Missing objects, invalid COB-IDs and 29-bit identifiers are
+*           ignored.
+*/
+/*---------------------------------------------------------------------------*/
+static void CODispatchSetCobId(uint32_t key, uint8_t svc, uint16_t inst)
+{
+    uint32_t cobid;
+
+    if (CODictRdLong(&DispNode->Dict, key, &cobid) != CO_ERR_NONE) {
+        return;
+    }
+    if ((cobid & (CO_DISPATCH_COBID_OFF | CO_DISPATCH_COBID_EXT)) != 0) {
+        return;
+    }
+    CODispatchSet(cobid & 0x7FFu, svc, inst);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BUILD DISPATCH TABLE
+*/
+/*---------------------------------------------------------------------------*/
+static void CODispatchBuild(void)
+{
+    CO_NODE  *node = DispNode;
+    uint32_t  hb;
+    uint16_t  n;
+    uint8_t   num;
+
+    for (n = 0; n < CO_DISPATCH_ID_N; n++) {
+        DispTable[n] = 0;
+    }
+    DispStat.Used = 0;
+
+    CODispatchSet(0x000u, CO_DISPATCH_NMT, 0);
+    CODispatchSet(0x700u + (node->NodeId & 0x7Fu), CO_DISPATCH_NMT, 0);
+    CODispatchSet(0x7E5u, CO_DISPATCH_LSS, 0);
+    CODispatchSetCobId(CO_DEV(0x1005, 0), CO_DISPATCH_SYNC, 0);
+
+#if CO_SSDO_N > 0
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if ((n == 0) && (CODictFind(&node->Dict, CO_DEV(0x1200, 1)) == 0)) {
+            CODispatchSet(0x600u + (node->NodeId & 0x7Fu), CO_DISPATCH_SDO_SRV, 0);
+        } else {
+            CODispatchSetCobId(CO_DEV(0x1200u + n, 1), CO_DISPATCH_SDO_SRV, n);
+        }
+    }
+#endif
+#if USE_CSDO
+    for (n = 0; n < CO_CSDO_N; n++) {             /* COB-ID plus server node-id */
+        if ((node->CSdo[n].RxId & (CO_DISPATCH_COBID_OFF | CO_DISPATCH_COBID_EXT)) == 0) {
+            CODispatchSet(node->CSdo[n].RxId & 0x7FFu, CO_DISPATCH_SDO_CLI, n);
+        }
+    }
+#endif
+    if (CODictRdByte(&node->Dict, CO_DEV(0x1016, 0), &num) == CO_ERR_NONE) {
+        for (n = 1; n <= num; n++) {
+            if ((CODictRdLong(&node->Dict, CO_DEV(0x1016, n), &hb) == CO_ERR_NONE) &&
+                (((hb >> 16) & 0x7Fu) != 0)) {
+                CODispatchSet(0x700u + ((hb >> 16) & 0x7Fu), CO_DISPATCH_HB_CONS, (uint16_t)(n - 1u));
+            }
+        }
+    }
+    for (n = 0; n < CO_RPDO_N; n++) {
+        CODispatchSetCobId(CO_DEV(0x1400u + n, 1), CO_DISPATCH_RPDO, n);
+    }
+
+    DispMode  = CONmtGetMode(&node->Nmt);
+    DispDirty = 0;
+    DispStat.Builds++;
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void CODispatchInit(CO_NODE *node)
+{
+    DispStat.Builds   = 0;
+    DispStat.Lookups  = 0;
+    DispStat.Bypassed = 0;
+    DispStat.Used     = 0;
+    DispNode          = node;
+    DispDirty         = 1;
+    if (node != 0) {
+        CODispatchBuild();
+    }
+}
+
+/*
+* see function definition
+*/
+void CODispatchRebuild(void)
+{
+    DispDirty = 1;
+}
+
+/*
+* see function definition
+*/
+void CODispatchTouch(uint32_t key)
+{
+    uint16_t idx = CO_GET_IDX(key);
+
+    if ((idx == 0x1005u) || (idx == 0x1016u) ||
+        ((idx >= 0x1200u) && (idx <= 0x12FFu)) ||
+        ((idx >= 0x1400u) && (idx <= 0x15FFu))) {
+        DispDirty = 1;
+    }
+}
+
+/*
+* see function definition
+*/
+uint8_t CODispatchFind(uint32_t id, uint16_t *inst)
+{
+    uint16_t entry = 0;
+
+    if (DispNode == 0) {
+        return (CO_DISPATCH_OFF);
+    }
+    DispStat.Lookups++;
+    if ((DispDirty != 0) || (CONmtGetMode(&DispNode->Nmt) != DispMode)) {
+        CODispatchBuild();
+    }
+    if (id < CO_DISPATCH_ID_N) {
+        entry = DispTable[id];
+    }
+    if (inst != 0) {
+        *inst = CO_DISPATCH_INST(entry);
+    }
+    return (CO_DISPATCH_SVC(entry));
+}
+
+/*
+* see function definition
+*/
+int16_t CODispatchBypass(CO_IF *cif, CO_IF_FRM *frm)
+{
+    if ((DispNode == 0) || (cif != &DispNode->If)) {
+        return (0);
+    }
+    if (CODispatchFind(CO_GET_ID(frm), 0) != CO_DISPATCH_NONE) {
+        return (0);
+    }
+    COIfCanReceive(frm);
+    DispStat.Bypassed++;
+    return (1);
+}
+
+/*
+* see function definition
+*/
+const CO_DISPATCH_STAT *CODispatchStat(void)
+{
+    return (&DispStat);
+}
@@ -0,0 +1,166 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_DISPATCH_H_
+#define CO_DISPATCH_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_DISPATCH_ID_N       2048u    /*!< number of 11-bit identifiers    */
+
+#define CO_DISPATCH_NONE       0u       /*!< identifier not used by the node */
+#define CO_DISPATCH_NMT        1u       /*!< NMT command / error control     */
+#define CO_DISPATCH_SYNC       2u       /*!< SYNC                            */
+#define CO_DISPATCH_SDO_SRV    3u       /*!< SDO server request              */
+#define CO_DISPATCH_SDO_CLI    4u       /*!< SDO client response             */
+#define CO_DISPATCH_HB_CONS    5u       /*!< consumed heartbeat              */
+#define CO_DISPATCH_RPDO       6u       /*!< RPDO                            */
+#define CO_DISPATCH_LSS        7u       /*!< LSS master request              */
+#define CO_DISPATCH_OFF        0xFFu    /*!< dispatch table disabled         */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief DISPATCH TABLE STATISTICS
+*
+*    Counters of the dispatch table since CODispatchInit().
+*/
+typedef struct CO_DISPATCH_STAT_T {
+    uint32_t Builds;           /*!< table rebuilds                          */
+    uint32_t Lookups;          /*!< identifier lookups                      */
+    uint32_t Bypassed;         /*!< frames passed to COIfCanReceive()       */
+    uint16_t Used;             /*!< identifiers used by the node            */
+} CO_DISPATCH_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT DISPATCH TABLE
+*
+* \details  This function enables the dispatch table for the given node. It
+*           must be called after CONodeInit(). The table maps each 11-bit
+*           CAN identifier to the receiving service and its instance. It is
+*           built from the communication objects in the dictionary:
+*           NMT (000h), SYNC (1005h), SDO servers (1200h+n:1), SDO clients
+*           (response identifier of the enabled client, 1280h+n:2 plus the
+*           server node-id 1280h+n:3), heartbeat consumers (1016h), RPDOs
+*           (1400h+n:1), the error control of the node and the LSS master
+*           (7E5h).
+*
+*           The table is rebuilt before the next lookup, when one of these
+*           objects is written with COObjWrValue() (see CO_DISPATCH_WRAP),
+*           when the NMT mode changes, or after CODispatchRebuild().
+*
+*           With CO_DISPATCH_WRAP, received frames with an unused identifier
+*           are passed to COIfCanReceive() directly, without the service
+*           checks of CONodeProcess().
+*
+* \param    node
+*           reference to the node; NULL disables the table
+*/
+/*---------------------------------------------------------------------------*/
+void CODispatchInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REBUILD DISPATCH TABLE
+*
+* \details  This function marks the table for a rebuild before the next
+*           lookup. It is needed, when the application changes a COB-ID
+*           without COObjWrValue().
+*/
+/*---------------------------------------------------------------------------*/
+void CODispatchRebuild(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK WRITTEN OBJECT ENTRY
+*
+* \details  This function marks the table for a rebuild, when the given
+*           key belongs to a communication object with a COB-ID. With
+*           CO_DISPATCH_WRAP, the function is called by the wrapped stack
+*           function COObjWrValue().
+*
+* \param    key
+*           key of the written object entry
+*/
+/*---------------------------------------------------------------------------*/
+void CODispatchTouch(uint32_t key);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FIND SERVICE OF IDENTIFIER
+*
+* \details  This function returns the service, which receives the given CAN
+*           identifier, with a single table access.
+*
+* \param    id
+*           CAN identifier
+*
+* \param    inst
+*           service instance (e.g. RPDO number), or NULL
+*
+* \return   service (CO_DISPATCH_xxx), or CO_DISPATCH_OFF when the table is
+*           disabled
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t CODispatchFind(uint32_t id, uint16_t *inst);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BYPASS UNUSED FRAME
+*
+* \details  This function passes a received frame with an identifier, which
+*           is not used by the node, to COIfCanReceive(). With
+*           CO_DISPATCH_WRAP, the function is called by the wrapped stack
+*           function COIfCanRead().
+*
+* \param    cif
+*           reference to the CAN interface, which received the frame
+*
+* \param    frm
+*           received frame
+*
+* \retval   =1    frame is handled; the stack shall not process it
+* \retval   =0    frame is processed by the stack
+*/
+/*---------------------------------------------------------------------------*/
+int16_t CODispatchBypass(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET DISPATCH TABLE STATISTICS
+*
+* \retval   reference to the dispatch table counters
+*/
+/*---------------------------------------------------------------------------*/
+const CO_DISPATCH_STAT *CODispatchStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,219 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_if_fd.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* CAN FD frames read in one call of the adapter read function */
+#define CO_IF_FD_READ_N     8u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* number of data bytes for each DLC code */
+static const uint8_t FdLen[16] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64
+};
+
+/* CAN FD driver, data phase bit rate and receiver of CAN FD frames */
+static const CO_IF_FD_DRV *FdDrv  = 0;
+static uint32_t            FdRate = 0;
+static CO_IF_FD_RECV       FdRecv = 0;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void    COIfFdCanInit   (void);
+static void    COIfFdCanEnable (uint32_t baudrate);
+static int16_t COIfFdCanRead   (CO_IF_FRM *frm);
+static int16_t COIfFdCanSend   (CO_IF_FRM *frm);
+static void    COIfFdCanReset  (void);
+static void    COIfFdCanClose  (void);
+
+/******************************************************************************
+* PUBLIC VARIABLE
+******************************************************************************/
+
+const CO_IF_CAN_DRV COIfFdCanDriver = {
+    COIfFdCanInit,
+    COIfFdCanEnable,
+    COIfFdCanRead,
+    COIfFdCanSend,
+    COIfFdCanReset,
+    COIfFdCanClose
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void COIfFdCanInit(void)
+{
+    if (FdDrv != 0) {
+        FdDrv->Init();
+    }
+}
+
+static void COIfFdCanEnable(uint32_t baudrate)
+{
+    if (FdDrv != 0) {
+        FdDrv->Enable(baudrate, FdRate);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  READ CLASSICAL FRAME
+*
+* \details  CAN FD frames are passed to the receive function, until a
+*           classical frame is read or CO_IF_FD_READ_N frames are handled.
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COIfFdCanRead(CO_IF_FRM *frm)
+{
+    CO_IF_FD_FRM fd;
+    int16_t      err;
+    uint8_t      n;
+
+    if (FdDrv == 0) {
+        return (-1);
+    }
+    for (n = 0; n < CO_IF_FD_READ_N; n++) {
+        err = FdDrv->Read(&fd);
+        if (err <= 0) {
+            return (err);
+        }
+        if (((fd.Flags & CO_IF_FD_FDF) == 0) && (fd.DLC <= 8u)) {
+            CO_SET_ID (frm, fd.Identifier);
+            CO_SET_DLC(frm, fd.DLC);
+            memcpy(&frm->Data[0], &fd.Data[0], 8u);
+            return ((int16_t)sizeof(CO_IF_FRM));
+        }
+        if (FdRecv != 0) {
+            (void)FdRecv(&fd);
+        }
+    }
+    return (0);
+}
+
+static int16_t COIfFdCanSend(CO_IF_FRM *frm)
+{
+    CO_IF_FD_FRM fd;
+    int16_t      err;
+
+    if (FdDrv == 0) {
+        return (-1);
+    }
+    fd.Identifier = CO_GET_ID(frm);
+    fd.DLC        = CO_GET_DLC(frm);
+    fd.Flags      = 0;
+    memcpy(&fd.Data[0], &frm->Data[0], 8u);
+    err = FdDrv->Send(&fd);
+    if (err > 0) {
+        err = (int16_t)sizeof(CO_IF_FRM);
+    }
+    return (err);
+}
+
+static void COIfFdCanReset(void)
+{
+    if (FdDrv != 0) {
+        FdDrv->Reset();
+    }
+}
+
+static void COIfFdCanClose(void)
+{
+    if (FdDrv != 0) {
+        FdDrv->Close();
+    }
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+uint8_t COIfFdDlcToLen(uint8_t code)
+{
+    return (FdLen[code & 0x0Fu]);
+}
+
+/*
+* see function definition
+*/
+uint8_t COIfFdLenToDlc(uint8_t len)
+{
+    uint8_t code;
+
+    if (len <= 8u) {
+        return (len);
+    }
+    for (code = 9u; code < 15u; code++) {
+        if (FdLen[code] >= len) {
+            break;
+        }
+    }
+    return (code);
+}
+
+/*
+* see function definition
+*/
+void COIfFdInit(const CO_IF_FD_DRV *drv, uint32_t rate, CO_IF_FD_RECV recv)
+{
+    FdDrv  = drv;
+    FdRate = rate;
+    FdRecv = recv;
+}
+
+/*
+* see function definition
+*/
+int16_t COIfFdSend(CO_IF_FD_FRM *frm)
+{
+    uint8_t len;
+
+    if ((FdDrv == 0) || (frm == 0) || (frm->DLC > CO_IF_FD_DLEN)) {
+        return (-1);
+    }
+    if ((frm->Flags & CO_IF_FD_FDF) == 0) {
+        if (frm->DLC > 8u) {
+            return (-1);
+        }
+    } else {
+        len = COIfFdDlcToLen(COIfFdLenToDlc(frm->DLC));
+        memset(&frm->Data[frm->DLC], 0, (uint32_t)(len - frm->DLC));
+        frm->DLC = len;
+    }
+    if (FdRate == 0) {
+        frm->Flags &= (uint8_t)~CO_IF_FD_BRS;
+    }
+    frm->Flags &= (uint8_t)~CO_IF_FD_ESI;
+    return (FdDrv->Send(frm));
+}
@@ -0,0 +1,164 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_IF_FD_H_
+#define CO_IF_FD_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_IF_FD_DLEN       64u    /*!< max. data bytes in a CAN FD frame   */
+
+#define CO_IF_FD_FDF      0x01u    /*!< frame flag: FD frame format         */
+#define CO_IF_FD_BRS      0x02u    /*!< frame flag: bit rate switch         */
+#define CO_IF_FD_ESI      0x04u    /*!< frame flag: error passive sender    */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief CAN FD FRAME
+*
+*    This structure holds a classical CAN or CAN FD frame. The DLC holds
+*    the number of data bytes (0..8, 12, 16, 20, 24, 32, 48 or 64); frames
+*    without CO_IF_FD_FDF are classical frames with up to 8 bytes.
+*/
+typedef struct CO_IF_FD_FRM_T {
+    uint32_t Identifier;          /*!< CAN identifier                       */
+    uint8_t  Data[CO_IF_FD_DLEN]; /*!< frame data                           */
+    uint8_t  DLC;                 /*!< number of data bytes                 */
+    uint8_t  Flags;               /*!< frame flags (CO_IF_FD_xxx)           */
+} CO_IF_FD_FRM;
+
+/*! \brief CAN FD DRIVER INTERFACE
+*
+*    The CAN FD driver functions follow the classical CAN driver interface
+*    of the stack (CO_IF_CAN_DRV). The driver is enabled with a nominal bit
+*    rate and a data phase bit rate; a data bit rate of 0 disables the bit
+*    rate switch.
+*/
+typedef struct CO_IF_FD_DRV_T {
+    void    (*Init)  (void);
+    void    (*Enable)(uint32_t nominal, uint32_t data);
+    int16_t (*Read)  (CO_IF_FD_FRM *frm);
+    int16_t (*Send)  (CO_IF_FD_FRM *frm);
+    void    (*Reset) (void);
+    void    (*Close) (void);
+} CO_IF_FD_DRV;
+
+/*! \brief CAN FD RECEIVE FUNCTION
+*
+*    This function type is called with each received CAN FD frame, which
+*    is not passed to the stack.
+*/
+typedef int16_t (*CO_IF_FD_RECV)(CO_IF_FD_FRM *frm);
+
+/******************************************************************************
+* PUBLIC SYMBOLS
+******************************************************************************/
+
+/*! \brief CLASSICAL CAN ADAPTER
+*
+*    This classical CAN driver passes the frames of the stack through the
+*    CAN FD driver of COIfFdInit(). Use it as CAN driver of the node.
+*/
+extern const CO_IF_CAN_DRV COIfFdCanDriver;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CAN FD DATA LENGTH
+*
+* \details  This function converts the 4-bit DLC code of a CAN FD frame
+*           into the number of data bytes.
+*
+* \param    code
+*           DLC code (0..15)
+*
+* \return   number of data bytes
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t COIfFdDlcToLen(uint8_t code);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CAN FD DLC CODE
+*
+* \details  This function returns the smallest 4-bit DLC code of a CAN FD
+*           frame, which holds the given number of data bytes.
+*
+* \param    len
+*           number of data bytes (0..64)
+*
+* \return   DLC code (0..15); 15 for more than 64 bytes
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t COIfFdLenToDlc(uint8_t len);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT CAN FD ADAPTER
+*
+* \details  This function selects the CAN FD driver behind COIfFdCanDriver.
+*           It must be called before CONodeInit(). Classical frames are
+*           passed to the stack; CAN FD frames are passed to the receive
+*           function.
+*
+* \param    drv
+*           reference to the CAN FD driver; NULL disables the adapter
+*
+* \param    rate
+*           data phase bit rate; 0 for no bit rate switch
+*
+* \param    recv
+*           receive function for CAN FD frames; NULL drops these frames
+*/
+/*---------------------------------------------------------------------------*/
+void COIfFdInit(const CO_IF_FD_DRV *drv, uint32_t rate, CO_IF_FD_RECV recv);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND CAN FD FRAME
+*
+* \details  This function sends the frame with the CAN FD driver. The data
+*           of a CAN FD frame is padded with 0 to the next valid length.
+*           The bit rate switch is cleared without a data phase bit rate.
+*
+* \param    frm
+*           CAN FD frame
+*
+* \retval   >0    frame is sent
+* \retval   =0    no transmit buffer available
+* \retval   <0    adapter disabled, bad frame or driver error
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COIfFdSend(CO_IF_FD_FRM *frm);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
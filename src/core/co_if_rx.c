@@ -0,0 +1,119 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if CO_SDO_DEFER_WRAP
+#include "co_sdo_defer.h"
+#endif
+#if CO_MPDO_WRAP
+#include "co_mpdo.h"
+#endif
+#if CO_SDO_ZC_WRAP
+#include "co_sdo_zc.h"
+#endif
+#if CO_SDO_POOL_WRAP
+#include "co_sdo_pool.h"
+#endif
+#if CO_CSDO_BLK_WRAP
+#include "co_csdo_blk.h"
+#endif
+#if CO_DISPATCH_WRAP
+#include "co_dispatch.h"
+#endif
+
+#if CO_IF_RX_WRAP
+
+/******************************************************************************
+* LINKER WRAPPED STACK FUNCTIONS
+******************************************************************************/
+
+int16_t __real_COIfCanRead(CO_IF *cif, CO_IF_FRM *frm);
+
+int16_t __wrap_COIfCanRead(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  READ CAN FRAME (WRAPPED)
+*
+* \details  Each frame read by the stack is passed to the receive functions
+*           of the enabled extensions in a fixed order, before the stack
+*           processes the frame:
+*
+*           1. SDO requests with a pending object access are parked; a
+*              parked request is returned later, when no frame is received
+*           2. MPDOs are written into the local object entries; the stack
+*              ignores the MPDO identifiers
+*           3. zero-copy uploads of the SDO servers are answered
+*           4. all other SDO requests lease the SDO server buffers
+*           5. responses to running SDO client block transfers are consumed
+*           6. frames with identifiers, which are not used by the node,
+*              skip the service checks of the stack (dispatch table)
+*
+*           A frame, which is consumed by an extension, is not passed to the
+*           following extensions and the stack.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t __wrap_COIfCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    int16_t err;
+#if CO_SDO_DEFER_WRAP
+    int16_t replay;
+#endif
+
+    err = __real_COIfCanRead(cif, frm);
+#if CO_SDO_DEFER_WRAP
+    if (err <= 0) {
+        replay = COSdoDeferReplay(cif, frm);
+        if (replay > 0) {
+            err = replay;
+        }
+    } else if (COSdoDeferReceive(cif, frm) != 0) {
+        return (0);
+    }
+#endif
+#if CO_MPDO_WRAP
+    if (err > 0) {
+        (void)COMPdoIfReceive(cif, frm);
+    }
+#endif
+#if CO_SDO_ZC_WRAP
+    if ((err > 0) && (COSdoZcReceive(cif, frm) != 0)) {
+        return (0);
+    }
+#endif
+#if CO_SDO_POOL_WRAP
+    if ((err > 0) && (COSdoPoolReceive(cif, frm) != 0)) {
+        return (0);
+    }
+#endif
+#if CO_CSDO_BLK_WRAP
+    if ((err > 0) && (COCSdoBlkReceive(cif, frm) != 0)) {
+        return (0);
+    }
+#endif
+#if CO_DISPATCH_WRAP
+    if ((err > 0) && (CODispatchBypass(cif, frm) != 0)) {
+        return (0);
+    }
+#endif
+    return (err);
+}
+
+#endif  /* #if CO_IF_RX_WRAP */
@@ -0,0 +1,67 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if CO_SDO_POOL_WRAP
+#include "co_sdo_pool.h"
+#endif
+#if CO_SYNC_PIPE_WRAP
+#include "co_sync_pipe.h"
+#endif
+
+#if CO_IF_TX_WRAP
+
+/******************************************************************************
+* LINKER WRAPPED STACK FUNCTIONS
+******************************************************************************/
+
+int16_t __real_COIfCanSend(CO_IF *cif, CO_IF_FRM *frm);
+
+int16_t __wrap_COIfCanSend(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND CAN FRAME (WRAPPED)
+*
+* \details  Each frame sent by the stack or an extension is passed to the
+*           send functions of the enabled extensions in a fixed order:
+*
+*           1. SDO responses end the buffer leases of the SDO servers
+*           2. frames of the SYNC pipeline node are collected during the
+*              SYNC handling and sent as a batch afterwards
+*
+*           A collected frame is not passed to the stack function; all
+*           other frames are sent with the CAN driver of the stack.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t __wrap_COIfCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+#if CO_SDO_POOL_WRAP
+    COSdoPoolSend(cif, frm);
+#endif
+#if CO_SYNC_PIPE_WRAP
+    if (COSyncPipeSend(cif, frm) != 0) {
+        return ((int16_t)sizeof(CO_IF_FRM));
+    }
+#endif
+    return (__real_COIfCanSend(cif, frm));
+}
+
+#endif  /* #if CO_IF_TX_WRAP */
@@ -34,6 +34,11 @@ static uint32_t filter_ = 0x01000000;
 
 #define PIN_21_IRQ IO_IRQ_BANK0
 
+// Software TX queue behind the three TX buffers of the MCP2515
+static CO_IF_FRM txq_[RP2350_MCP2515_TXQ_N];
+static uint8_t txq_head_ = 0;
+static uint8_t txq_num_ = 0;
+
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
@@ -46,6 +51,10 @@ static int16_t DrvCanRead   (CO_IF_FRM *frm);
 static void    DrvCanReset  (void);
 static void    DrvCanClose  (void);
 
+static MCP2515::ERROR DrvCanTxFrame (const CO_IF_FRM *frm);
+static int16_t        DrvCanTxQueue (const CO_IF_FRM *frm);
+static void           DrvCanTxDrain (void);
+
 MCP2515::ERROR set_mask(uint32_t mask) {
     mask_ = mask;
     return MCP2515::ERROR_OK;
@@ -197,14 +206,47 @@ static void DrvCanEnable(uint32_t baudrate) {
     printf("[ CAN    ]      CAN bus enabled\n");
 };
 
-static int16_t DrvCanSend(CO_IF_FRM *frm) {
+static MCP2515::ERROR DrvCanTxFrame(const CO_IF_FRM *frm) {
     struct can_frame outgoing;
     outgoing.can_id = frm->Identifier;
     outgoing.can_dlc = frm->DLC;
     for (uint8_t idx=0; idx<frm->DLC; idx++) {
         outgoing.data[idx] = frm->Data[idx];
     }
-    ret_ = can_.sendMessage(&outgoing);
+    return can_.sendMessage(&outgoing);
+};
+
+static int16_t DrvCanTxQueue(const CO_IF_FRM *frm) {
+    if (txq_num_ >= RP2350_MCP2515_TXQ_N) {
+        return (-1);
+    }
+    txq_[(uint8_t)((txq_head_ + txq_num_) % RP2350_MCP2515_TXQ_N)] = *frm;
+    txq_num_++;
+    return (sizeof(CO_IF_FRM));
+};
+
+static void DrvCanTxDrain(void) {
+    // Move queued frames into the TX buffers, which are free again; keep
+    // the order and stop at the first busy buffer.
+    while (txq_num_ > 0) {
+        if (DrvCanTxFrame(&txq_[txq_head_]) != MCP2515::ERROR_OK) {
+            break;
+        }
+        txq_head_ = (uint8_t)((txq_head_ + 1) % RP2350_MCP2515_TXQ_N);
+        txq_num_--;
+    }
+};
+
+static int16_t DrvCanSend(CO_IF_FRM *frm) {
+    DrvCanTxDrain();
+    if (txq_num_ > 0) {
+        // Frames are waiting for a TX buffer; don't overtake them
+        return DrvCanTxQueue(frm);
+    }
+    ret_ = DrvCanTxFrame(frm);
+    if (ret_ == MCP2515::ERROR_ALLTXBUSY) {
+        return DrvCanTxQueue(frm);
+    }
     if (ret_ != MCP2515::ERROR_OK) {
         printf("[ CAN    ] ****** MCP2515: sendMessage failed with code %u\n",
                ret_);
@@ -213,9 +255,43 @@ static int16_t DrvCanSend(CO_IF_FRM *frm) {
     return (sizeof(CO_IF_FRM));
 };
 
+int16_t RP2350MCP2515CanSendBatch(CO_IF_FRM *frm, uint8_t num) {
+    uint8_t sent = 0;
+    // Fill the TX buffers back to back and queue the frames, which don't
+    // fit; the queue is drained when a TX buffer completes.
+    DrvCanTxDrain();
+    while (sent < num) {
+        ret_ = MCP2515::ERROR_ALLTXBUSY;
+        if (txq_num_ == 0) {
+            ret_ = DrvCanTxFrame(&frm[sent]);
+        }
+        if (ret_ == MCP2515::ERROR_ALLTXBUSY) {
+            if (DrvCanTxQueue(&frm[sent]) < 0) {
+                break;
+            }
+        } else if (ret_ != MCP2515::ERROR_OK) {
+            break;
+        }
+        sent++;
+    }
+    if ((sent == 0) && (num > 0)) {
+        return (-1);
+    }
+    return (sent);
+};
+
+void RP2350MCP2515CanTxDone(void) {
+    can_.clearTXInterrupts();
+    DrvCanTxDrain();
+};
+
 static int16_t DrvCanRead (CO_IF_FRM *frm) {
     uint8_t irq = can_.getInterrupts();
     struct can_frame incoming;
+    // A completed transmission frees a TX buffer for the queued frames
+    if (irq & (MCP2515::CANINTF_TX0IF | MCP2515::CANINTF_TX1IF | MCP2515::CANINTF_TX2IF)) {
+        RP2350MCP2515CanTxDone();
+    }
     // Check if there is a message in the RX buffers
     if (irq & MCP2515::CANINTF_RX0IF) {
         ret_ = can_.readMessage(MCP2515::RXB0, &incoming);
@@ -263,6 +339,8 @@ static void DrvCanReset(void) {
     // Disable CAN message received interrupts
     // Re-enable MCP2515's CAN message received interrupts in DrvCanEnable
     gpio_set_irq_enabled(PIN_21_IRQ, GPIO_IRQ_EDGE_FALL, false);
+    txq_head_ = 0;
+    txq_num_ = 0;
 
     // printf("[ CAN    ]      Reseting CAN driver\n");
     // ret_ = can_.reset();
@@ -28,12 +28,34 @@ extern "C" {
 #include "mcp2515/mcp2515.h"
 #include "co_if.h"
 
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/* Frames queued in software, when all three TX buffers are busy */
+#ifndef RP2350_MCP2515_TXQ_N
+#define RP2350_MCP2515_TXQ_N 32
+#endif
+
 /******************************************************************************
 * PUBLIC SYMBOLS
 ******************************************************************************/
 
 extern const CO_IF_CAN_DRV RP2350MCP2515CanDriver;
 
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/* Send a batch of frames (e.g. all synchronous TPDOs); frames, which don't
+ * fit into the TX buffers, are queued. Returns the number of frames accepted
+ * by the controller or the queue, or -1 when the first frame fails. */
+int16_t RP2350MCP2515CanSendBatch(CO_IF_FRM *frm, uint8_t num);
+
+/* Move queued frames into the TX buffers; call on a TX-complete interrupt.
+ * The driver drains the queue as well on each read and send. */
+void RP2350MCP2515CanTxDone(void);
+
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
 #endif
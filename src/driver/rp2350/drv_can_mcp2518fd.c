@@ -0,0 +1,341 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "stdio.h"
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+#include "hardware/spi.h"
+#include "drv_can_mcp2518fd.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define MCP_SPI                 spi0
+
+// SPI instructions (4 bit instruction, 12 bit address)
+#define MCP_INS_RESET           0x0u
+#define MCP_INS_WRITE           0x2u
+#define MCP_INS_READ            0x3u
+
+// CAN FD controller module registers
+#define MCP_REG_CON             0x000u
+#define MCP_REG_NBTCFG          0x004u
+#define MCP_REG_DBTCFG          0x008u
+#define MCP_REG_TDC             0x00Cu
+#define MCP_REG_INT             0x01Cu
+#define MCP_REG_TXQCON          0x050u
+#define MCP_REG_TXQSTA          0x054u
+#define MCP_REG_TXQUA           0x058u
+#define MCP_REG_FIFOCON1        0x05Cu
+#define MCP_REG_FIFOSTA1        0x060u
+#define MCP_REG_FIFOUA1         0x064u
+#define MCP_REG_FLTCON0         0x1D0u
+#define MCP_REG_FLTOBJ0         0x1F0u
+#define MCP_REG_MASK0           0x1F4u
+#define MCP_RAM_START           0x400u
+#define MCP_REG_OSC             0xE00u
+
+// C1CON fields
+#define MCP_CON_REQOP_POS       24u
+#define MCP_CON_OPMOD_POS       21u
+#define MCP_CON_MODE_MASK       0x7u
+#define MCP_CON_STEF            (1uL << 19)
+#define MCP_CON_BRSDIS          (1uL << 12)
+
+// operation modes
+#define MCP_MODE_NORMAL_FD      0x0u
+#define MCP_MODE_LISTEN_ONLY    0x3u
+#define MCP_MODE_CONFIG         0x4u
+
+// FIFO control: payload 64 bytes, TXQ with 8 and RX FIFO with 16 objects
+#define MCP_FIFO_PLSIZE_64      (7uL << 29)
+#define MCP_TXQ_CON             (MCP_FIFO_PLSIZE_64 | (7uL << 24) | (3uL << 21) | (1uL << 16))
+#define MCP_RXF_CON             (MCP_FIFO_PLSIZE_64 | (15uL << 24) | 1uL)
+#define MCP_FIFO_UINC           0x01u   // byte 1 of FIFO control
+#define MCP_FIFO_TXREQ          0x02u   // byte 1 of FIFO control
+#define MCP_FIFO_NOT_EMPTY      0x01u   // byte 0 of FIFO status
+#define MCP_TXQ_NOT_FULL        0x01u   // byte 0 of TXQ status
+
+// message object flags (second word)
+#define MCP_OBJ_IDE             (1uL << 4)
+#define MCP_OBJ_BRS             (1uL << 6)
+#define MCP_OBJ_FDF             (1uL << 7)
+#define MCP_OBJ_ESI             (1uL << 8)
+
+#define MCP_OSC_READY           (1uL << 10)
+#define MCP_INT_RXIE            (1uL << 17)
+#define MCP_TDC_AUTO            (2uL << 16)
+
+static uint8_t obj_[8 + CO_IF_FD_DLEN];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void    DrvCanInit   (void);
+static void    DrvCanEnable (uint32_t nominal, uint32_t data);
+static int16_t DrvCanSend   (CO_IF_FD_FRM *frm);
+static int16_t DrvCanRead   (CO_IF_FD_FRM *frm);
+static void    DrvCanReset  (void);
+static void    DrvCanClose  (void);
+
+/******************************************************************************
+* PUBLIC VARIABLE
+******************************************************************************/
+
+const CO_IF_FD_DRV RP2350MCP2518FDCanDriver = {
+    DrvCanInit,
+    DrvCanEnable,
+    DrvCanRead,
+    DrvCanSend,
+    DrvCanReset,
+    DrvCanClose
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void mcp_transfer(uint8_t ins, uint16_t addr, uint8_t *buf, uint16_t len) {
+    uint8_t cmd[2];
+    cmd[0] = (uint8_t)((ins << 4) | ((addr >> 8) & 0x0Fu));
+    cmd[1] = (uint8_t)(addr & 0xFFu);
+    gpio_put(MCP2518FD_PIN_CS, 0);
+    spi_write_blocking(MCP_SPI, cmd, 2);
+    if (ins == MCP_INS_READ) {
+        spi_read_blocking(MCP_SPI, 0x00, buf, len);
+    } else if (len > 0) {
+        spi_write_blocking(MCP_SPI, buf, len);
+    }
+    gpio_put(MCP2518FD_PIN_CS, 1);
+};
+
+static uint32_t mcp_read32(uint16_t addr) {
+    uint8_t buf[4];
+    mcp_transfer(MCP_INS_READ, addr, buf, 4);
+    // Registers are little endian on the SPI bus
+    return ((uint32_t)buf[0])       | ((uint32_t)buf[1] << 8) |
+           ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+};
+
+static void mcp_write32(uint16_t addr, uint32_t val) {
+    uint8_t buf[4];
+    buf[0] = (uint8_t)val;
+    buf[1] = (uint8_t)(val >> 8);
+    buf[2] = (uint8_t)(val >> 16);
+    buf[3] = (uint8_t)(val >> 24);
+    mcp_transfer(MCP_INS_WRITE, addr, buf, 4);
+};
+
+static void mcp_write8(uint16_t addr, uint8_t val) {
+    mcp_transfer(MCP_INS_WRITE, addr, &val, 1);
+};
+
+static bool mcp_set_mode(uint32_t mode) {
+    uint32_t con = mcp_read32(MCP_REG_CON);
+    con &= ~((uint32_t)MCP_CON_MODE_MASK << MCP_CON_REQOP_POS);
+    con |= (mode << MCP_CON_REQOP_POS);
+    mcp_write32(MCP_REG_CON, con);
+    // Mode change waits for the end of an ongoing frame
+    for (uint8_t retry = 0; retry < 100; retry++) {
+        con = mcp_read32(MCP_REG_CON);
+        if (((con >> MCP_CON_OPMOD_POS) & MCP_CON_MODE_MASK) == mode) {
+            return true;
+        }
+        sleep_us(100);
+    }
+    return false;
+};
+
+// Bit timing register value with the sample point at 80%; the nominal and
+// data bit timing registers share the field positions.
+static uint32_t mcp_bit_timing(uint32_t rate, uint32_t max_tq, uint32_t *tseg1) {
+    uint32_t tq = MCP2518FD_OSC_HZ / rate;
+    uint32_t brp = 1;
+    while ((tq / brp) > max_tq) {
+        brp++;
+    }
+    uint32_t num = tq / brp;
+    uint32_t ts1 = ((num * 80u) / 100u) - 1u;      // without sync segment
+    uint32_t ts2 = num - 1u - ts1;
+    *tseg1 = ts1;
+    return ((brp - 1u) << 24) | ((ts1 - 1u) << 16) |
+           ((ts2 - 1u) << 8)  |  (ts2 - 1u);
+};
+
+static void DrvCanInit(void) {
+    printf("[ CAN    ]      Initializing MCP2518FD CAN FD controller\n");
+    spi_init(MCP_SPI, MCP2518FD_SPI_CLOCK);
+    gpio_set_function(MCP2518FD_PIN_TX, GPIO_FUNC_SPI);
+    gpio_set_function(MCP2518FD_PIN_RX, GPIO_FUNC_SPI);
+    gpio_set_function(MCP2518FD_PIN_SCK, GPIO_FUNC_SPI);
+    gpio_init(MCP2518FD_PIN_CS);
+    gpio_set_dir(MCP2518FD_PIN_CS, GPIO_OUT);
+    gpio_put(MCP2518FD_PIN_CS, 1);
+
+    // Reset puts the controller into configuration mode
+    mcp_transfer(MCP_INS_RESET, 0x000u, NULL, 0);
+    sleep_ms(2);
+    uint8_t retry = 0;
+    while ((mcp_read32(MCP_REG_OSC) & MCP_OSC_READY) == 0) {
+        if (++retry > 100) {
+            // Repeat error message
+            while (true) {
+                printf("[ CAN    ]    MCP2518FD oscillator not ready\n");
+                sleep_ms(1000);
+            };
+        }
+        sleep_us(100);
+    }
+    printf("[ CAN    ]      MCP2518FD CAN FD controller initialized\n");
+};
+
+static void DrvCanEnable(uint32_t nominal, uint32_t data) {
+    uint32_t tseg1;
+    printf("[ CAN    ]      Enabling CAN FD bus\n");
+    printf("[ CAN    ]        MCP2518FD: Nominal %u, data %u\n", nominal, data);
+    if (!mcp_set_mode(MCP_MODE_CONFIG)) {
+        printf("[ CAN    ] ****** MCP2518FD: Configuration mode failed\n");
+        return;
+    }
+
+    mcp_write32(MCP_REG_NBTCFG, mcp_bit_timing(nominal, 256u, &tseg1));
+    uint32_t con = mcp_read32(MCP_REG_CON) & ~MCP_CON_STEF;
+    if (data > 0) {
+        mcp_write32(MCP_REG_DBTCFG, mcp_bit_timing(data, 32u, &tseg1));
+        // Automatic transmitter delay compensation at the sample point
+        mcp_write32(MCP_REG_TDC, MCP_TDC_AUTO | ((tseg1 + 1u) << 8));
+        con &= ~MCP_CON_BRSDIS;
+    } else {
+        con |= MCP_CON_BRSDIS;
+    }
+    mcp_write32(MCP_REG_CON, con);
+
+    // TXQ for transmission, FIFO 1 receives all frames with filter 0
+    mcp_write32(MCP_REG_TXQCON, MCP_TXQ_CON);
+    mcp_write32(MCP_REG_FIFOCON1, MCP_RXF_CON);
+    mcp_write8(MCP_REG_FLTCON0, 0x00u);
+    mcp_write32(MCP_REG_FLTOBJ0, 0x00000000u);
+    mcp_write32(MCP_REG_MASK0, 0x00000000u);
+    mcp_write8(MCP_REG_FLTCON0, 0x80u | 1u);
+    mcp_write32(MCP_REG_INT, MCP_INT_RXIE);
+
+    printf("[ CAN    ]        MCP2518FD: Exiting configuration mode\n");
+    if (!mcp_set_mode(MCP_MODE_NORMAL_FD)) {
+        // Repeat error message
+        while (true) {
+            printf("[ CAN    ] ****** MCP2518FD: Normal FD mode failed\n");
+            sleep_ms(1000);
+        };
+    }
+    printf("[ CAN    ]      CAN FD bus enabled\n");
+};
+
+static int16_t DrvCanSend(CO_IF_FD_FRM *frm) {
+    uint8_t sta;
+    mcp_transfer(MCP_INS_READ, MCP_REG_TXQSTA, &sta, 1);
+    if ((sta & MCP_TXQ_NOT_FULL) == 0) {
+        return (0);
+    }
+    uint16_t addr = MCP_RAM_START + (uint16_t)(mcp_read32(MCP_REG_TXQUA) & 0x0FFFu);
+
+    uint32_t id = frm->Identifier;
+    uint32_t t0;
+    uint32_t t1 = COIfFdLenToDlc(frm->DLC);
+    if (id > 0x7FFu) {
+        t0 = ((id >> 18) & 0x7FFu) | ((id & 0x3FFFFu) << 11);
+        t1 |= MCP_OBJ_IDE;
+    } else {
+        t0 = id;
+    }
+    if ((frm->Flags & CO_IF_FD_FDF) != 0) {
+        t1 |= MCP_OBJ_FDF;
+        if ((frm->Flags & CO_IF_FD_BRS) != 0) {
+            t1 |= MCP_OBJ_BRS;
+        }
+    }
+    for (uint8_t idx = 0; idx < 4; idx++) {
+        obj_[idx]     = (uint8_t)(t0 >> (8 * idx));
+        obj_[4 + idx] = (uint8_t)(t1 >> (8 * idx));
+    }
+    // Message objects are written in words
+    uint8_t len = COIfFdDlcToLen((uint8_t)(t1 & 0x0Fu));
+    for (uint8_t idx = 0; idx < ((len + 3u) & ~3u); idx++) {
+        obj_[8 + idx] = (idx < frm->DLC) ? frm->Data[idx] : 0u;
+    }
+    mcp_transfer(MCP_INS_WRITE, addr, obj_, (uint16_t)(8u + ((len + 3u) & ~3u)));
+    mcp_write8(MCP_REG_TXQCON + 1u, MCP_FIFO_UINC | MCP_FIFO_TXREQ);
+    return (sizeof(CO_IF_FD_FRM));
+};
+
+static int16_t DrvCanRead(CO_IF_FD_FRM *frm) {
+    uint8_t sta;
+    mcp_transfer(MCP_INS_READ, MCP_REG_FIFOSTA1, &sta, 1);
+    if ((sta & MCP_FIFO_NOT_EMPTY) == 0) {
+        // No message received
+        return (0);
+    }
+    uint16_t addr = MCP_RAM_START + (uint16_t)(mcp_read32(MCP_REG_FIFOUA1) & 0x0FFFu);
+    mcp_transfer(MCP_INS_READ, addr, obj_, 8);
+    uint32_t r0 = (uint32_t)obj_[0] | ((uint32_t)obj_[1] << 8) |
+                  ((uint32_t)obj_[2] << 16) | ((uint32_t)obj_[3] << 24);
+    uint32_t r1 = (uint32_t)obj_[4] | ((uint32_t)obj_[5] << 8);
+    uint8_t len = COIfFdDlcToLen((uint8_t)(r1 & 0x0Fu));
+    if ((r1 & MCP_OBJ_FDF) == 0 && len > 8) {
+        len = 8;
+    }
+    if (len > 0) {
+        mcp_transfer(MCP_INS_READ, addr + 8u, frm->Data, len);
+    }
+    mcp_write8(MCP_REG_FIFOCON1 + 1u, MCP_FIFO_UINC);
+
+    if ((r1 & MCP_OBJ_IDE) != 0) {
+        frm->Identifier = ((r0 & 0x7FFu) << 18) | ((r0 >> 11) & 0x3FFFFu);
+    } else {
+        frm->Identifier = r0 & 0x7FFu;
+    }
+    frm->DLC = len;
+    frm->Flags = 0;
+    if ((r1 & MCP_OBJ_FDF) != 0) {
+        frm->Flags |= CO_IF_FD_FDF;
+    }
+    if ((r1 & MCP_OBJ_BRS) != 0) {
+        frm->Flags |= CO_IF_FD_BRS;
+    }
+    if ((r1 & MCP_OBJ_ESI) != 0) {
+        frm->Flags |= CO_IF_FD_ESI;
+    }
+    return (sizeof(CO_IF_FD_FRM));
+};
+
+static void DrvCanReset(void) {
+    printf("[ CAN    ]      Calling Init\n");
+    DrvCanInit();
+};
+
+static void DrvCanClose(void) {
+    printf("[ CAN    ]      Removing CAN FD controller from network\n");
+    if (!mcp_set_mode(MCP_MODE_LISTEN_ONLY)) {
+        printf("[ CAN    ] ****** MCP2518FD: Listen-only failed\n");
+        return;
+    }
+    printf("[ CAN    ]      Removed CAN FD controller from network\n");
+};
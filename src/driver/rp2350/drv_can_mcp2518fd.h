@@ -0,0 +1,69 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CAN_MCP2518FD_H_
+#define CO_CAN_MCP2518FD_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "stdint.h"
+#include "co_if.h"
+#include "co_if_fd.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+// Wiring of the MCP2517FD/MCP2518FD board (same as the MCP2515 board)
+#ifndef MCP2518FD_PIN_CS
+#define MCP2518FD_PIN_CS        20
+#endif
+#ifndef MCP2518FD_PIN_TX
+#define MCP2518FD_PIN_TX        21
+#endif
+#ifndef MCP2518FD_PIN_RX
+#define MCP2518FD_PIN_RX        19
+#endif
+#ifndef MCP2518FD_PIN_SCK
+#define MCP2518FD_PIN_SCK       16
+#endif
+
+// SPI clock and controller oscillator (SYSCLK without PLL)
+#ifndef MCP2518FD_SPI_CLOCK
+#define MCP2518FD_SPI_CLOCK     10000000u
+#endif
+#ifndef MCP2518FD_OSC_HZ
+#define MCP2518FD_OSC_HZ        40000000u
+#endif
+
+/******************************************************************************
+* PUBLIC SYMBOLS
+******************************************************************************/
+
+/* CAN FD driver; use it with COIfFdInit() and COIfFdCanDriver as node driver */
+extern const CO_IF_FD_DRV RP2350MCP2518FDCanDriver;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
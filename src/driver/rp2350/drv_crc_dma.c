@@ -0,0 +1,69 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "hardware/dma.h"
+#include "drv_crc_dma.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static int     dma_chan_ = -1;
+static uint8_t dma_sink_;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+// The sniffer observes the bytes of a memory-to-memory transfer into a
+// dummy byte and accumulates the CRC-16-CCITT (polynomial 0x1021, MSB first)
+// in its data register. With the accumulator seeded with the CRC of the
+// previous segment, the result equals COCrc16Ref().
+
+uint16_t RP2350Crc16Dma(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+    dma_channel_config cfg;
+
+    if (len < CRC_DMA_MIN_LEN) {
+        return COCrc16Slice4(crc, data, len);
+    }
+    if (dma_chan_ < 0) {
+        dma_chan_ = dma_claim_unused_channel(false);
+        if (dma_chan_ < 0) {
+            // All channels in use; stay with the CPU
+            return COCrc16Slice4(crc, data, len);
+        }
+    }
+
+    cfg = dma_channel_get_default_config((uint)dma_chan_);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_sniff_enable(&cfg, true);
+
+    dma_sniffer_set_data_accumulator(crc);
+    dma_sniffer_enable((uint)dma_chan_, DMA_SNIFF_CTRL_CALC_VALUE_CRC16, true);
+    dma_channel_configure((uint)dma_chan_, &cfg, &dma_sink_, data, len, true);
+    dma_channel_wait_for_finish_blocking((uint)dma_chan_);
+    crc = (uint16_t)(dma_sniffer_get_data_accumulator() & 0xFFFFu);
+    dma_sniffer_disable();
+
+    return crc;
+}
@@ -0,0 +1,54 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CRC_DMA_H_
+#define CO_CRC_DMA_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "stdint.h"
+#include "co_crc16.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+// Shorter data is processed by the CPU; the DMA setup costs more than it saves
+#ifndef CRC_DMA_MIN_LEN
+#define CRC_DMA_MIN_LEN         64u
+#endif
+
+/******************************************************************************
+* PUBLIC SYMBOLS
+******************************************************************************/
+
+/* CRC16 provider with the DMA sniffer; selected with CMake option CO_CRC16=DMA.
+ * The function claims a DMA channel on first use and needs the sniffer
+ * exclusively. It must not be called from interrupts.
+ */
+uint16_t RP2350Crc16Dma(uint16_t crc, const uint8_t *data, uint32_t len);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,99 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "stdio.h"
+#include "stdint.h"
+#include "pico/stdlib.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+#include "drv_nvm_flash.h"
+#include "drv_prog_flash.h"
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef struct {
+    uint32_t       offset;
+    const uint8_t *data;
+    uint32_t       size;
+} prog_io_args;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static int16_t DrvProgErase  (uint32_t offset, uint32_t size);
+static int16_t DrvProgProgram(uint32_t offset, const uint8_t *data, uint32_t size);
+
+static void erase_prog_cb_(void *param);
+static void program_prog_cb_(void *param);
+
+/******************************************************************************
+* PUBLIC VARIABLE
+******************************************************************************/
+
+const CO_PROG_FLASH RP2350ProgFlash = {
+    DrvProgErase,
+    DrvProgProgram
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void erase_prog_cb_(void *param) {
+    prog_io_args *args = (prog_io_args *)param;
+
+    flash_range_erase(PROG_FLASH_OFFSET + args->offset, args->size);
+}
+
+static void program_prog_cb_(void *param) {
+    prog_io_args *args = (prog_io_args *)param;
+
+    flash_range_program(PROG_FLASH_OFFSET + args->offset, args->data, args->size);
+}
+
+static int16_t DrvProgErase(uint32_t offset, uint32_t size) {
+    prog_io_args args = { offset, NULL, size };
+
+    if ((offset + size) > PROG_FLASH_SIZE) {
+        return -1;
+    }
+    if (flash_safe_execute(erase_prog_cb_, &args, FLASH_TIMEOUT_MS) != PICO_OK) {
+        printf("[ CAN    ] ****** PROG: Failed to erase flash at %x\n", offset);
+        return -1;
+    }
+    return 0;
+}
+
+static int16_t DrvProgProgram(uint32_t offset, const uint8_t *data, uint32_t size) {
+    prog_io_args args = { offset, data, size };
+
+    // The page is copied from RAM; the SDO buffer never points into XIP
+    if ((offset + size) > PROG_FLASH_SIZE) {
+        return -1;
+    }
+    if (flash_safe_execute(program_prog_cb_, &args, FLASH_TIMEOUT_MS) != PICO_OK) {
+        printf("[ CAN    ] ****** PROG: Failed to program flash at %x\n", offset);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PROG_FLASH_H_
+#define CO_PROG_FLASH_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "stdint.h"
+#include "pico/stdlib.h"
+#include "co_prog.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+// Staging partition for program downloads (object 1F50h), given as offset
+//  from the start of flash. It must be a multiple of 4 kB and must not
+//  overlap the running firmware or the NVM area of drv_nvm_flash.
+#ifndef PROG_FLASH_OFFSET
+#define PROG_FLASH_OFFSET (2*1024*1024)
+#endif
+#ifndef PROG_FLASH_SIZE
+#define PROG_FLASH_SIZE   (1*1024*1024)
+#endif
+
+/******************************************************************************
+* PUBLIC SYMBOLS
+******************************************************************************/
+
+/* Flash driver of the staging partition; used as CO_PROG.Flash with
+ * CO_PROG.Size = PROG_FLASH_SIZE. Erase and program run with
+ * flash_safe_execute(), so flash_safe_execute_core_init() is required
+ * like for the NVM driver.
+ */
+extern const CO_PROG_FLASH RP2350ProgFlash;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,97 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_obj_fast.h"
+
+#if CO_TPDO_DIRTY_WRAP
+#include "co_tpdo_dirty.h"
+#endif
+#if CO_DISPATCH_WRAP
+#include "co_dispatch.h"
+#endif
+#if CO_RPDO_MON_WRAP
+#include "co_rpdo_mon.h"
+#endif
+
+#if CO_OBJ_FAST_WRAP
+
+/******************************************************************************
+* LINKER WRAPPED STACK FUNCTIONS
+******************************************************************************/
+
+CO_ERR __real_COObjRdValue(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width);
+CO_ERR __real_COObjWrValue(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width);
+
+CO_ERR __wrap_COObjRdValue(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width);
+CO_ERR __wrap_COObjWrValue(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  READ VALUE FROM OBJECT ENTRY (WRAPPED)
+*
+* \details  Basic integer types are read with the inlined fast path. All
+*           other types (domains, strings, user types) and all error cases
+*           are passed to the stack function.
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR __wrap_COObjRdValue(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width)
+{
+    if (COObjRdFast(obj, node, value, width) != 0) {
+        return (CO_ERR_NONE);
+    }
+    return (__real_COObjRdValue(obj, node, value, width));
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  WRITE VALUE TO OBJECT ENTRY (WRAPPED)
+*
+* \details  Basic integer types are written with the inlined fast path. All
+*           other types (domains, strings, user types) and all error cases
+*           are passed to the stack function. Successful writes mark the
+*           entry for the TPDO change-of-state tracking, changed COB-IDs
+*           for the rebuild of the dispatch table and changed RPDO event
+*           timers for the deadline monitor.
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR __wrap_COObjWrValue(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width)
+{
+    CO_ERR err = CO_ERR_NONE;
+
+    if (COObjWrFast(obj, node, value, width) == 0) {
+        err = __real_COObjWrValue(obj, node, value, width);
+    }
+#if CO_TPDO_DIRTY_WRAP
+    if (err == CO_ERR_NONE) {
+        COTPdoDirtyMark(node, obj);
+    }
+#endif
+#if CO_DISPATCH_WRAP
+    if (err == CO_ERR_NONE) {
+        CODispatchTouch(obj->Key);
+    }
+#endif
+#if CO_RPDO_MON_WRAP
+    if (err == CO_ERR_NONE) {
+        CORPdoMonTouch(obj->Key);
+    }
+#endif
+    return (err);
+}
+
+#endif  /* #if CO_OBJ_FAST_WRAP */
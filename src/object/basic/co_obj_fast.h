@@ -0,0 +1,261 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_OBJ_FAST_H_
+#define CO_OBJ_FAST_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "co_real32.h"
+#include "co_real64.h"
+#include "co_signed64.h"
+#include "co_unsigned48.h"
+#include "co_unsigned64.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief CHECK FOR BASIC TYPE
+*
+*    This macro evaluates to true, when the object entry (obj) has one of
+*    the basic integer or floating point types with the given access width
+*    (width) in bytes. Types of the same width share the same storage
+*    handling.
+*/
+#define CO_OBJ_IS_BASIC(obj,width)                                         \
+    ((((width) == 8u) && (((obj)->Type == &COTUnsigned64) ||               \
+                          ((obj)->Type == &COTSigned64)   ||               \
+                          ((obj)->Type == &COTReal64)))     ||             \
+     (((width) == 6u) &&  ((obj)->Type == &COTUnsigned48))  ||             \
+     (((width) == 4u) && (((obj)->Type == &COTUnsigned32) ||               \
+                          ((obj)->Type == &COTSigned32)   ||               \
+                          ((obj)->Type == &COTReal32)))     ||             \
+     (((width) == 2u) && (((obj)->Type == &COTUnsigned16) ||               \
+                          ((obj)->Type == &COTSigned16)))   ||             \
+     (((width) == 1u) && (((obj)->Type == &COTUnsigned8)  ||               \
+                          ((obj)->Type == &COTSigned8))))
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  WIDTH OF BASIC OBJECT ENTRY
+*
+* \details  This function returns the value width of an object entry with a
+*           basic integer or floating point type.
+*
+* \param    obj
+*           pointer to the object entry
+*
+* \retval   >0    width of the basic type in bytes
+* \retval   =0    no basic type
+*/
+/*---------------------------------------------------------------------------*/
+static inline uint8_t COObjBasicWidth(const CO_OBJ *obj)
+{
+    if ((obj->Type == &COTUnsigned32) || (obj->Type == &COTSigned32) ||
+        (obj->Type == &COTReal32)) {
+        return (4u);
+    } else if ((obj->Type == &COTUnsigned16) || (obj->Type == &COTSigned16)) {
+        return (2u);
+    } else if ((obj->Type == &COTUnsigned8) || (obj->Type == &COTSigned8)) {
+        return (1u);
+    } else if ((obj->Type == &COTUnsigned64) || (obj->Type == &COTSigned64) ||
+               (obj->Type == &COTReal64)) {
+        return (8u);
+    } else if (obj->Type == &COTUnsigned48) {
+        return (6u);
+    }
+    return (0u);
+}
+
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FAST READ OF BASIC OBJECT ENTRY
+*
+* \details  This function reads the value of an object entry with a basic
+*           type (CO_TUNSIGNED8/16/32/48/64, CO_TSIGNED8/16/32/64 and
+*           CO_TREAL32/64) without calling the type functions. Direct and
+*           referenced storage and the node-id flag are handled like the
+*           type read functions. Values wider than 4 bytes are copied from
+*           the referenced variable; node-id relative entries of these
+*           types and of CO_TREAL32 are left to the type functions.
+*
+* \param    obj
+*           pointer to the object entry
+*
+* \param    node
+*           reference to the parent node
+*
+* \param    value
+*           pointer to the destination variable
+*
+* \param    width
+*           width of the destination variable in bytes
+*
+* \retval   =1    value is read
+* \retval   =0    no basic type or bad arguments; use COObjRdValue()
+*/
+/*---------------------------------------------------------------------------*/
+static inline uint8_t COObjRdFast(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width)
+{
+    uint32_t val;
+
+    if ((obj == NULL) || (node == NULL) || (value == NULL) ||
+        (!CO_OBJ_IS_BASIC(obj, width))) {
+        return (0);
+    }
+
+    if ((CO_IS_NODEID(obj->Key) != 0) && (obj->Type == &COTReal32)) {
+        return (0);                       /* type ignores the node-id flag */
+    }
+    if (width > 4u) {
+        if ((CO_IS_DIRECT(obj->Key) != 0) || (CO_IS_NODEID(obj->Key) != 0)) {
+            return (0);
+        }
+        memcpy(value, (void *)obj->Data, width);
+        return (1);
+    }
+
+    if (CO_IS_DIRECT(obj->Key) != 0) {
+        val = (uint32_t)obj->Data;
+    } else if (width == 4u) {
+        val = *(uint32_t *)(obj->Data);
+    } else if (width == 2u) {
+        val = *(uint16_t *)(obj->Data);
+    } else {
+        val = *(uint8_t *)(obj->Data);
+    }
+    if (CO_IS_NODEID(obj->Key) != 0) {
+        val += node->NodeId;
+    }
+
+    if (width == 4u) {
+        *(uint32_t *)value = val;
+    } else if (width == 2u) {
+        *(uint16_t *)value = (uint16_t)val;
+    } else {
+        *(uint8_t *)value  = (uint8_t)val;
+    }
+    return (1);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FAST WRITE OF BASIC OBJECT ENTRY
+*
+* \details  This function writes the value of an object entry with a basic
+*           type without calling the type functions. Direct and
+*           referenced storage, the node-id flag and the asynchronous TPDO
+*           trigger are handled like the type write functions. The 64-bit
+*           storage of CO_TUNSIGNED48 gets the upper 16 bits cleared.
+*
+* \param    obj
+*           pointer to the object entry
+*
+* \param    node
+*           reference to the parent node
+*
+* \param    value
+*           pointer to the source variable
+*
+* \param    width
+*           width of the source variable in bytes
+*
+* \retval   =1    value is written
+* \retval   =0    no basic type or bad arguments; use COObjWrValue()
+*/
+/*---------------------------------------------------------------------------*/
+static inline uint8_t COObjWrFast(CO_OBJ *obj, CO_NODE *node, void *value, uint8_t width)
+{
+    uint64_t wide;
+    uint32_t val;
+
+    if ((obj == NULL) || (node == NULL) || (value == NULL) ||
+        (!CO_OBJ_IS_BASIC(obj, width))) {
+        return (0);
+    }
+
+    if ((CO_IS_NODEID(obj->Key) != 0) && (obj->Type == &COTReal32)) {
+        return (0);                       /* type ignores the node-id flag */
+    }
+    if (width > 4u) {
+        if ((CO_IS_DIRECT(obj->Key) != 0) || (CO_IS_NODEID(obj->Key) != 0)) {
+            return (0);
+        }
+        wide = 0;                         /* clear upper bytes of U48 */
+        memcpy(&wide, value, width);
+        memcpy((void *)obj->Data, &wide, sizeof(wide));
+        if ((CO_IS_PDOMAP(obj->Key) != 0) &&
+            (CO_IS_ASYNC(obj->Key)  != 0)) {
+            COTPdoTrigObj(node->TPdo, obj);
+        }
+        return (1);
+    }
+
+    if (width == 4u) {
+        val = *(uint32_t *)value;
+    } else if (width == 2u) {
+        val = *(uint16_t *)value;
+    } else {
+        val = *(uint8_t *)value;
+    }
+    if (CO_IS_NODEID(obj->Key) != 0) {
+        val -= node->NodeId;
+    }
+
+    if (width == 4u) {
+        if (CO_IS_DIRECT(obj->Key) != 0) {
+            obj->Data = (CO_DATA)(val);
+        } else {
+            *(uint32_t *)(obj->Data) = val;
+        }
+    } else if (width == 2u) {
+        if (CO_IS_DIRECT(obj->Key) != 0) {
+            obj->Data = (CO_DATA)((uint16_t)val);
+        } else {
+            *(uint16_t *)(obj->Data) = (uint16_t)val;
+        }
+    } else {
+        if (CO_IS_DIRECT(obj->Key) != 0) {
+            obj->Data = (CO_DATA)((uint8_t)val);
+        } else {
+            *(uint8_t *)(obj->Data) = (uint8_t)val;
+        }
+    }
+
+    if ((CO_IS_PDOMAP(obj->Key) != 0) &&
+        (CO_IS_ASYNC(obj->Key)  != 0)) {
+        COTPdoTrigObj(node->TPdo, obj);
+    }
+    return (1);
+}
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
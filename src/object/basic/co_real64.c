@@ -0,0 +1,91 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_real64.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTReal64Size (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTReal64Read (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTReal64Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTReal64 = {
+    COTReal64Size,
+    0,
+    COTReal64Read,
+    COTReal64Write
+};
+
+/******************************************************************************
+* PRIVATE TYPE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTReal64Size(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    (void)obj;
+    (void)node;
+    (void)width;
+
+    return ((uint32_t)8u);
+}
+
+static CO_ERR COTReal64Read(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    double value;
+
+    if ((node == 0) || (size < sizeof(value))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (CO_IS_DIRECT(obj->Key) != 0) {          /* value exceeds object entry */
+        return (CO_ERR_TYPE_RD);
+    }
+    memcpy(&value, (void *)(obj->Data), sizeof(value));
+    memcpy(buffer, &value, sizeof(value));       /* buffer may be unaligned */
+
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTReal64Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    double value;
+
+    if ((node == 0) || (size < sizeof(value))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (CO_IS_DIRECT(obj->Key) != 0) {          /* value exceeds object entry */
+        return (CO_ERR_TYPE_WR);
+    }
+    memcpy(&value, buffer, sizeof(value));       /* buffer may be unaligned */
+    memcpy((void *)(obj->Data), &value, sizeof(value));
+
+    if ((CO_IS_PDOMAP(obj->Key) != 0) &&
+        (CO_IS_ASYNC(obj->Key)  != 0)) {
+        COTPdoTrigObj(node->TPdo, obj);
+    }
+    return (CO_ERR_NONE);
+}
@@ -0,0 +1,115 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_unsigned48.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_UNSIGNED48_MASK   0x0000FFFFFFFFFFFFuLL   /* valid bits of value   */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTUnsigned48Size (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTUnsigned48Read (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTUnsigned48Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTUnsigned48 = {
+    COTUnsigned48Size,
+    0,
+    COTUnsigned48Read,
+    COTUnsigned48Write
+};
+
+/******************************************************************************
+* PRIVATE TYPE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTUnsigned48Size(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    (void)obj;
+    (void)node;
+    (void)width;
+
+    return ((uint32_t)6u);
+}
+
+/* The value is stored in a uint64_t variable. A buffer of 8 bytes gets the
+ * zero-extended value; smaller buffers (PDO, SDO) get the 6 value bytes. */
+static CO_ERR COTUnsigned48Read(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    uint64_t value;
+
+    if ((node == 0) || (size < 6u)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (CO_IS_DIRECT(obj->Key) != 0) {          /* value exceeds object entry */
+        return (CO_ERR_TYPE_RD);
+    }
+    memcpy(&value, (void *)(obj->Data), sizeof(value));
+    if (CO_IS_NODEID(obj->Key) != 0) {
+        value += node->NodeId;
+    }
+    value &= CO_UNSIGNED48_MASK;
+    if (size >= 8u) {
+        memcpy(buffer, &value, 8u);
+    } else {
+        memcpy(buffer, &value, 6u);              /* little endian: low bytes */
+    }
+
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTUnsigned48Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    uint64_t value = 0;
+
+    if ((node == 0) || (size < 6u)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (CO_IS_DIRECT(obj->Key) != 0) {          /* value exceeds object entry */
+        return (CO_ERR_TYPE_WR);
+    }
+    if (size >= 8u) {
+        memcpy(&value, buffer, 8u);
+    } else {
+        memcpy(&value, buffer, 6u);
+    }
+    if (CO_IS_NODEID(obj->Key) != 0) {
+        value -= node->NodeId;
+    }
+    value &= CO_UNSIGNED48_MASK;
+    memcpy((void *)(obj->Data), &value, sizeof(value));
+
+    if ((CO_IS_PDOMAP(obj->Key) != 0) &&
+        (CO_IS_ASYNC(obj->Key)  != 0)) {
+        COTPdoTrigObj(node->TPdo, obj);
+    }
+    return (CO_ERR_NONE);
+}
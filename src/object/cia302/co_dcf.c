@@ -0,0 +1,330 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_dcf.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_DCF_ABORT_MEM       0x05040005u  /* out of memory                  */
+#define CO_DCF_ABORT_RD_ONLY   0x06010002u  /* attempt to write read-only     */
+#define CO_DCF_ABORT_NO_OBJ    0x06020000u  /* object does not exist          */
+#define CO_DCF_ABORT_LEN       0x06070010u  /* data type length mismatch      */
+#define CO_DCF_ABORT_LEN_HIGH  0x06070012u  /* data type length too high      */
+#define CO_DCF_ABORT_LEN_LOW   0x06070013u  /* data type length too low       */
+#define CO_DCF_ABORT_DATA      0x08000020u  /* data cannot be stored          */
+
+#define CO_DCF_HEAD            4u           /* number of entries              */
+#define CO_DCF_ENTRY_HEAD      7u           /* index, subindex and size       */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTDcfSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTDcfCtrl (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint16_t func, uint32_t para);
+static CO_ERR   COTDcfWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+
+static uint32_t CODcfCheck(CO_DCF *dcf, CO_NODE *node);
+static uint32_t CODcfApply(CO_DCF *dcf, CO_NODE *node);
+static uint32_t CODcfWrite(CO_OBJ *obj, CO_NODE *node, const uint8_t *data, uint32_t len);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTDcf = {
+    COTDcfSize,
+    COTDcfCtrl,
+    0,
+    COTDcfWrite
+};
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+static uint32_t CODcfGet(const uint8_t *data, uint8_t len)
+{
+    uint32_t val = 0;
+
+    while (len > 0u) {
+        len--;
+        val = (val << 8) | data[len];
+    }
+    return (val);
+}
+
+static void CODcfPut(uint8_t *data, uint32_t val, uint8_t len)
+{
+    uint8_t n;
+
+    for (n = 0; n < len; n++) {
+        data[n] = (uint8_t)(val >> (8u * n));
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK RECEIVED ENTRIES
+*
+* \details  All completely received entries are checked against the object
+*           dictionary of the node.
+*
+* \retval   =0             all entries are received and checked
+* \retval   =CO_DCF_BUSY   more data is needed
+* \retval   other          SDO abort code of the failed check
+*/
+/*---------------------------------------------------------------------------*/
+static uint32_t CODcfCheck(CO_DCF *dcf, CO_NODE *node)
+{
+    const uint8_t *entry;
+    CO_OBJ        *obj;
+    uint32_t       key;
+    uint32_t       len;
+    uint32_t       size;
+
+    if (dcf->Pos == 0u) {
+        if (dcf->Offset < CO_DCF_HEAD) {
+            return (CO_DCF_BUSY);
+        }
+        dcf->Num = CODcfGet(dcf->Buf, CO_DCF_HEAD);
+        dcf->Pos = CO_DCF_HEAD;
+    }
+    while (dcf->Checked < dcf->Num) {
+        if ((dcf->Offset - dcf->Pos) < CO_DCF_ENTRY_HEAD) {
+            return (CO_DCF_BUSY);
+        }
+        entry = &dcf->Buf[dcf->Pos];
+        len   = CODcfGet(&entry[3], 4);
+        if (len > (dcf->Size - dcf->Pos - CO_DCF_ENTRY_HEAD)) {
+            return (CO_DCF_ABORT_MEM);
+        }
+        if (len > (dcf->Offset - dcf->Pos - CO_DCF_ENTRY_HEAD)) {
+            return (CO_DCF_BUSY);
+        }
+
+        key = CO_DEV(CODcfGet(&entry[0], 2), entry[2]);
+        obj = CODictFind(&node->Dict, key);
+        if ((obj == 0) || (CO_GET_IDX(key) == CO_DCF_IDX)) {
+            return (CO_DCF_ABORT_NO_OBJ);
+        }
+        if (CO_IS_WRITE(obj->Key) == 0) {
+            return (CO_DCF_ABORT_RD_ONLY);
+        }
+        if (len == 0u) {
+            return (CO_DCF_ABORT_LEN);
+        }
+        size = COObjGetSize(obj, node, len);
+        if (size < len) {
+            return (CO_DCF_ABORT_LEN_HIGH);
+        } else if ((size > len) &&
+                   (obj->Type != CO_TDOMAIN) && (obj->Type != CO_TSTRING)) {
+            return (CO_DCF_ABORT_LEN_LOW);      /* domains may be shorter */
+        }
+        dcf->Pos += CO_DCF_ENTRY_HEAD + len;
+        dcf->Checked++;
+    }
+    if (dcf->Offset > dcf->Pos) {
+        return (CO_DCF_ABORT_LEN_HIGH);     /* data behind the last entry */
+    }
+    return (0u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  APPLY CHECKED ENTRIES
+*
+* \details  The checked entries are written in the order of the concise
+*           DCF. The pass stops with the first failed write; the entries
+*           before the failed entry stay written.
+*
+* \retval   =0     all entries are written
+* \retval   other  SDO abort code of the failed write
+*/
+/*---------------------------------------------------------------------------*/
+static uint32_t CODcfApply(CO_DCF *dcf, CO_NODE *node)
+{
+    const uint8_t *entry;
+    CO_OBJ        *obj;
+    uint32_t       pos = CO_DCF_HEAD;
+    uint32_t       len;
+    uint32_t       n;
+    uint32_t       code;
+
+    for (n = 0; n < dcf->Num; n++) {
+        entry = &dcf->Buf[pos];
+        len   = CODcfGet(&entry[3], 4);
+        obj   = CODictFind(&node->Dict, CO_DEV(CODcfGet(&entry[0], 2), entry[2]));
+        code  = CODcfWrite(obj, node, &entry[CO_DCF_ENTRY_HEAD], len);
+        if (code != 0u) {
+            return (code);
+        }
+        pos += CO_DCF_ENTRY_HEAD + len;
+    }
+    return (0u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  WRITE ENTRY
+*
+* \details  Values with 1, 2 or 4 bytes are written like the SDO server
+*           writes expedited values. Other sizes, domains and strings are
+*           written with the type functions, starting at offset 0.
+*/
+/*---------------------------------------------------------------------------*/
+static uint32_t CODcfWrite(CO_OBJ *obj, CO_NODE *node, const uint8_t *data, uint32_t len)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t  val8;
+    CO_ERR   err;
+
+    if ((obj->Type != CO_TDOMAIN) && (obj->Type != CO_TSTRING) &&
+        ((len == 1u) || (len == 2u) || (len == 4u))) {
+        val32 = CODcfGet(data, (uint8_t)len);
+        if (len == 4u) {
+            err = COObjWrValue(obj, node, &val32, 4);
+        } else if (len == 2u) {
+            val16 = (uint16_t)val32;
+            err   = COObjWrValue(obj, node, &val16, 2);
+        } else {
+            val8 = (uint8_t)val32;
+            err  = COObjWrValue(obj, node, &val8, 1);
+        }
+    } else if ((obj->Type != 0) && (obj->Type->Write != 0)) {
+        if (obj->Type->Ctrl != 0) {
+            (void)obj->Type->Ctrl(obj, node, CO_CTRL_SET_OFF, 0);
+        }
+        err = obj->Type->Write(obj, node, (void *)data, len);
+    } else {
+        err = CO_ERR_TYPE_WR;
+    }
+    return ((err == CO_ERR_NONE) ? 0u : CO_DCF_ABORT_DATA);
+}
+
+/******************************************************************************
+* PRIVATE TYPE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTDcfSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    CO_DCF  *dcf = (CO_DCF *)(obj->Data);
+    uint32_t result;
+
+    (void)node;
+
+    if (dcf == 0) {
+        return (0u);
+    }
+    dcf->Total = width;                   /* size announced by the client   */
+    result = dcf->Size;
+    if ((width > 0u) && (width < result)) {
+        result = width;
+    }
+    return (result);
+}
+
+static CO_ERR COTDcfCtrl(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint16_t func, uint32_t para)
+{
+    CO_DCF *dcf = (CO_DCF *)(obj->Data);
+
+    (void)node;
+
+    if ((dcf == 0) || (func != CO_CTRL_SET_OFF)) {
+        return (CO_ERR_TYPE_CTRL);
+    }
+    if (para == 0u) {
+        dcf->Offset  = 0;                 /* a new download starts the DCF  */
+        dcf->Pos     = 0;
+        dcf->Num     = 0;
+        dcf->Checked = 0;
+        dcf->Result  = CO_DCF_BUSY;
+    } else if (para != dcf->Offset) {
+        return (CO_ERR_TYPE_CTRL);        /* the DCF is received in order   */
+    }
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTDcfWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_DCF  *dcf = (CO_DCF *)(obj->Data);
+    uint32_t code;
+
+    if ((node == 0) || (dcf == 0) || (dcf->Buf == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (dcf->Result != CO_DCF_BUSY) {
+        code = CO_DCF_ABORT_LEN_HIGH;     /* DCF finished or failed before  */
+    } else if (size > (dcf->Size - dcf->Offset)) {
+        code = CO_DCF_ABORT_MEM;
+    } else {
+        memcpy(&dcf->Buf[dcf->Offset], buffer, size);
+        dcf->Offset += size;
+        code = CODcfCheck(dcf, node);
+        if (code == CO_DCF_BUSY) {
+            if ((dcf->Total == 0u) || (dcf->Offset < dcf->Total)) {
+                return (CO_ERR_NONE);
+            }
+            code = CO_DCF_ABORT_LEN_LOW;  /* download ends within an entry  */
+        }
+        if (code == 0u) {
+            code = CODcfApply(dcf, node);
+        }
+    }
+    dcf->Result = code;
+    if (code != 0u) {
+        COObjTypeUserSDOAbort(obj, node, code);
+        return (CO_ERR_TYPE_WR);
+    }
+    return (CO_ERR_NONE);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+uint32_t CODcfBuild(const CO_DCF_ENTRY *entry, uint32_t num, uint8_t *buf, uint32_t size)
+{
+    uint32_t pos = CO_DCF_HEAD;
+    uint32_t n;
+
+    if ((buf == 0) || (size < CO_DCF_HEAD) || ((entry == 0) && (num > 0u))) {
+        return (0u);
+    }
+    CODcfPut(buf, num, 4);
+    for (n = 0; n < num; n++) {
+        if ((entry[n].Size == 0u) || (entry[n].Data == 0) ||
+            (entry[n].Size > (size - pos)) ||
+            ((size - pos - entry[n].Size) < CO_DCF_ENTRY_HEAD)) {
+            return (0u);
+        }
+        CODcfPut(&buf[pos],     CO_GET_IDX(entry[n].Key), 2);
+        CODcfPut(&buf[pos + 2], CO_GET_SUB(entry[n].Key), 1);
+        CODcfPut(&buf[pos + 3], entry[n].Size, 4);
+        memcpy(&buf[pos + CO_DCF_ENTRY_HEAD], entry[n].Data, entry[n].Size);
+        pos += CO_DCF_ENTRY_HEAD + entry[n].Size;
+    }
+    return (pos);
+}
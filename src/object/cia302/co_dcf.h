@@ -0,0 +1,136 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_DCF_H_
+#define CO_DCF_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_TDCF  ((CO_OBJ_TYPE *)&COTDcf)   /*!< concise DCF (1F22h)        */
+
+/*! \brief CONCISE DCF INDEX
+*
+*    Object index of the concise DCF. The subindex is the node-id of the
+*    configured node.
+*/
+#define CO_DCF_IDX             0x1F22u
+
+/*! \brief DOWNLOAD RESULT
+*
+*    Value of CO_DCF.Result, while a concise DCF is received and not
+*    complete yet.
+*/
+#define CO_DCF_BUSY            0xFFFFFFFFu
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief CONCISE DCF
+*
+*    This structure is the data of the object entry 1F22h of the node. The
+*    buffer is set by the application; the other members are managed by
+*    the object type. The buffer size limits the size of a concise DCF.
+*/
+typedef struct CO_DCF_T {
+    uint8_t  *Buf;             /*!< buffer for the received concise DCF     */
+    uint32_t  Size;            /*!< buffer size in bytes                    */
+    uint32_t  Total;           /*!< announced download size, 0: unknown     */
+    uint32_t  Offset;          /*!< number of received bytes                */
+    uint32_t  Pos;             /*!< end of the checked entries              */
+    uint32_t  Num;             /*!< number of entries                       */
+    uint32_t  Checked;         /*!< number of checked entries               */
+    uint32_t  Result;          /*!< 0, CO_DCF_BUSY or SDO abort code        */
+} CO_DCF;
+
+/*! \brief CONCISE DCF ENTRY
+*
+*    One stored configuration value for CODcfBuild(). The value is in
+*    CANopen byte order (little endian).
+*/
+typedef struct CO_DCF_ENTRY_T {
+    uint32_t       Key;        /*!< CO_DEV(index, subindex)                 */
+    uint32_t       Size;       /*!< value size in bytes                     */
+    const uint8_t *Data;       /*!< value                                   */
+} CO_DCF_ENTRY;
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE CONCISE DCF
+*
+*    This type is a write-only domain for the object 1F22h. The received
+*    concise DCF (number of entries, then index, subindex, size and value
+*    of each entry) is collected in the buffer. Each entry is checked on
+*    arrival: the object must exist, be writable and match the size
+*    (domains and strings may be shorter). The first failed check aborts
+*    the transfer. A download, which ends with the announced size before
+*    the last entry is complete, is aborted as well. When the last entry
+*    is received, all entries are written in one pass, so a concise DCF
+*    is either applied completely or not at all; only a failing type
+*    write function stops the pass and leaves the preceding entries
+*    written.
+*/
+extern const CO_OBJ_TYPE COTDcf;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BUILD CONCISE DCF
+*
+* \details  This function generates a concise DCF from the stored
+*           configuration. The result is downloaded as one domain into the
+*           object 1F22h of the configured node, e.g. with
+*           COCSdoRequestBlockDownload().
+*
+* \param    entry
+*           list of configuration values
+*
+* \param    num
+*           number of configuration values
+*
+* \param    buf
+*           destination buffer
+*
+* \param    size
+*           size of the destination buffer in bytes
+*
+* \retval   >0    size of the concise DCF in bytes
+* \retval   =0    bad argument or buffer too small
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t CODcfBuild(const CO_DCF_ENTRY *entry, uint32_t num, uint8_t *buf, uint32_t size);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,292 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_prog.h"
+#include "co_crc16.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_PROG_ABORT_HW       0x06060000u  /* access failed, hardware error  */
+#define CO_PROG_ABORT_LEN      0x06070012u  /* data type length too high      */
+#define CO_PROG_ABORT_RANGE    0x06090030u  /* value range exceeded           */
+#define CO_PROG_ABORT_DATA     0x08000020u  /* data cannot be stored          */
+#define CO_PROG_ABORT_STATE    0x08000022u  /* not possible in device state   */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTProgDataSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTProgDataCtrl (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint16_t func, uint32_t para);
+static CO_ERR   COTProgDataWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static uint32_t COTProgCtrlSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTProgCtrlRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTProgCtrlWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static uint32_t COTProgStatSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTProgStatRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+
+static void     COProgClear (CO_PROG *prog);
+static int16_t  COProgPage  (CO_PROG *prog, uint32_t offset, const uint8_t *data);
+static int16_t  COProgFinish(CO_PROG *prog);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTProgData = {
+    COTProgDataSize,
+    COTProgDataCtrl,
+    0,
+    COTProgDataWrite
+};
+
+const CO_OBJ_TYPE COTProgCtrl = {
+    COTProgCtrlSize,
+    0,
+    COTProgCtrlRead,
+    COTProgCtrlWrite
+};
+
+const CO_OBJ_TYPE COTProgStat = {
+    COTProgStatSize,
+    0,
+    COTProgStatRead,
+    0
+};
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+static void COProgClear(CO_PROG *prog)
+{
+    prog->Offset = 0;
+    prog->Erased = 0;
+    prog->Crc    = 0;
+    prog->Status = CO_PROG_OK;
+}
+
+static int16_t COProgPage(CO_PROG *prog, uint32_t offset, const uint8_t *data)
+{
+    uint32_t end;
+
+    end = offset + CO_PROG_PAGE + CO_PROG_AHEAD;
+    if (end > prog->Size) {
+        end = prog->Size;
+    }
+    while (prog->Erased < end) {
+        if (prog->Flash->Erase(prog->Erased, CO_PROG_SECTOR) < 0) {
+            return (-1);
+        }
+        prog->Erased += CO_PROG_SECTOR;
+    }
+    return (prog->Flash->Program(offset, data, CO_PROG_PAGE));
+}
+
+static int16_t COProgFinish(CO_PROG *prog)
+{
+    uint32_t pos;
+
+    pos = prog->Offset % CO_PROG_PAGE;
+    if (pos != 0u) {
+        /* erased flash keeps the padding, so the page may be continued */
+        memset(&prog->Page[pos], 0xFF, CO_PROG_PAGE - pos);
+        if (COProgPage(prog, prog->Offset - pos, prog->Page) < 0) {
+            prog->Status = CO_PROG_ERR_WRITE;
+            return (-1);
+        }
+    }
+    if ((prog->Offset < 2u) || (prog->Crc != 0u)) {
+        prog->Status = CO_PROG_ERR_FORMAT;
+        return (-1);
+    }
+    return (0);
+}
+
+/******************************************************************************
+* PRIVATE TYPE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTProgDataSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    CO_PROG *prog = (CO_PROG *)(obj->Data);
+    uint32_t result;
+
+    (void)node;
+
+    if (prog == 0) {
+        return (0u);
+    }
+    result = prog->Size;
+    if ((width > 0u) && (width < result)) {
+        result = width;
+    }
+    return (result);
+}
+
+static CO_ERR COTProgDataCtrl(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint16_t func, uint32_t para)
+{
+    CO_PROG *prog = (CO_PROG *)(obj->Data);
+
+    (void)node;
+
+    if ((prog == 0) || (func != CO_CTRL_SET_OFF)) {
+        return (CO_ERR_TYPE_CTRL);
+    }
+    if (para == 0u) {
+        if (prog->State == CO_PROG_STOP) {
+            COProgClear(prog);            /* a new download starts the image */
+        }
+    } else if (para != prog->Offset) {
+        return (CO_ERR_TYPE_CTRL);        /* the flash is written in order   */
+    }
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTProgDataWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_PROG       *prog = (CO_PROG *)(obj->Data);
+    const uint8_t *src  = (const uint8_t *)buffer;
+    uint32_t       pos;
+    uint32_t       num;
+
+    if ((node == 0) || (prog == 0) || (prog->Flash == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (prog->State != CO_PROG_STOP) {
+        COObjTypeUserSDOAbort(obj, node, CO_PROG_ABORT_STATE);
+        return (CO_ERR_TYPE_WR);
+    }
+    if (size > (prog->Size - prog->Offset)) {
+        prog->Status = CO_PROG_ERR_ADDR;
+        COObjTypeUserSDOAbort(obj, node, CO_PROG_ABORT_LEN);
+        return (CO_ERR_TYPE_WR);
+    }
+
+    prog->Crc = COCrc16(prog->Crc, src, size);
+    while (size > 0u) {
+        pos = prog->Offset % CO_PROG_PAGE;
+        num = CO_PROG_PAGE - pos;
+        if (num > size) {
+            num = size;
+        }
+        memcpy(&prog->Page[pos], src, num);
+        if (((pos + num) == CO_PROG_PAGE) &&
+            (COProgPage(prog, prog->Offset - pos, prog->Page) < 0)) {
+            prog->Status = CO_PROG_ERR_WRITE;
+            COObjTypeUserSDOAbort(obj, node, CO_PROG_ABORT_HW);
+            return (CO_ERR_TYPE_WR);
+        }
+        prog->Offset += num;
+        src          += num;
+        size         -= num;
+    }
+    return (CO_ERR_NONE);
+}
+
+static uint32_t COTProgCtrlSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    (void)obj;
+    (void)node;
+    (void)width;
+
+    return ((uint32_t)1u);
+}
+
+static CO_ERR COTProgCtrlRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_PROG *prog = (CO_PROG *)(obj->Data);
+
+    if ((node == 0) || (prog == 0) || (size < 1u)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    *(uint8_t *)buffer = prog->State;
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTProgCtrlWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_PROG *prog = (CO_PROG *)(obj->Data);
+    uint8_t  cmd;
+
+    if ((node == 0) || (prog == 0) || (size < 1u)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    cmd = *(uint8_t *)buffer;
+
+    if (cmd == CO_PROG_STOP) {
+        prog->State = CO_PROG_STOP;
+    } else if ((cmd == CO_PROG_START) || (cmd == CO_PROG_RESET)) {
+        if ((cmd == CO_PROG_START) && (prog->State == CO_PROG_START)) {
+            return (CO_ERR_NONE);
+        }
+        prog->State = CO_PROG_STOP;
+        if ((prog->Flash == 0) || (COProgFinish(prog) < 0)) {
+            COObjTypeUserSDOAbort(obj, node, CO_PROG_ABORT_DATA);
+            return (CO_ERR_TYPE_WR);
+        }
+        if ((prog->Start != 0) && (prog->Start(prog) < 0)) {
+            prog->Status = CO_PROG_ERR_NONE;
+            COObjTypeUserSDOAbort(obj, node, CO_PROG_ABORT_DATA);
+            return (CO_ERR_TYPE_WR);
+        }
+        prog->State = CO_PROG_START;
+    } else if (cmd == CO_PROG_CLEAR) {
+        if (prog->State != CO_PROG_STOP) {
+            COObjTypeUserSDOAbort(obj, node, CO_PROG_ABORT_STATE);
+            return (CO_ERR_TYPE_WR);
+        }
+        COProgClear(prog);
+    } else {
+        COObjTypeUserSDOAbort(obj, node, CO_PROG_ABORT_RANGE);
+        return (CO_ERR_TYPE_WR);
+    }
+    return (CO_ERR_NONE);
+}
+
+static uint32_t COTProgStatSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    (void)obj;
+    (void)node;
+    (void)width;
+
+    return ((uint32_t)4u);
+}
+
+static CO_ERR COTProgStatRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_PROG *prog = (CO_PROG *)(obj->Data);
+    uint32_t value;
+
+    if ((node == 0) || (prog == 0) || (size < sizeof(value))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    value = (uint32_t)(prog->Status & 0x7Fu) << 1;
+    if ((prog->Offset > 0u) && (prog->State == CO_PROG_STOP) &&
+        (prog->Status == CO_PROG_OK)) {
+        value |= 1u;                      /* program download in progress   */
+    }
+    memcpy(buffer, &value, sizeof(value));    /* buffer may be unaligned */
+    return (CO_ERR_NONE);
+}
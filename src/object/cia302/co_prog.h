@@ -0,0 +1,150 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PROG_H_
+#define CO_PROG_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_TPROG_DATA  ((CO_OBJ_TYPE *)&COTProgData)  /*!< program data (1F50h)    */
+#define CO_TPROG_CTRL  ((CO_OBJ_TYPE *)&COTProgCtrl)  /*!< program control (1F51h) */
+#define CO_TPROG_STAT  ((CO_OBJ_TYPE *)&COTProgStat)  /*!< flash status (1F57h)    */
+
+/*! \brief FLASH GEOMETRY
+*
+*    The program data is written in pages of CO_PROG_PAGE bytes; sectors of
+*    CO_PROG_SECTOR bytes are erased before the first page is written. The
+*    defaults match the QSPI flash of the RP2350.
+*/
+#ifndef CO_PROG_PAGE
+#define CO_PROG_PAGE           256u
+#endif
+#ifndef CO_PROG_SECTOR
+#define CO_PROG_SECTOR         4096u
+#endif
+
+/*! \brief ERASE AHEAD
+*
+*    Number of bytes behind the current page, which are erased in advance.
+*    The sector erase is done before the data of the next sector arrives,
+*    so it does not stall the page writes of a sector.
+*/
+#ifndef CO_PROG_AHEAD
+#define CO_PROG_AHEAD          CO_PROG_SECTOR
+#endif
+
+/*! \brief PROGRAM CONTROL COMMANDS (1F51h) */
+#define CO_PROG_STOP           0u  /*!< stop program                          */
+#define CO_PROG_START          1u  /*!< check and start program               */
+#define CO_PROG_RESET          2u  /*!< stop and start program                */
+#define CO_PROG_CLEAR          3u  /*!< discard program data                  */
+
+/*! \brief FLASH STATUS (1F57h, bit 1..7) */
+#define CO_PROG_OK             0u  /*!< no error                              */
+#define CO_PROG_ERR_NONE       1u  /*!< no valid program available            */
+#define CO_PROG_ERR_FORMAT     3u  /*!< data format error (CRC)               */
+#define CO_PROG_ERR_WRITE      5u  /*!< flash write error                     */
+#define CO_PROG_ERR_ADDR       6u  /*!< general address error (image size)    */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_PROG_T;
+
+/*! \brief FLASH DRIVER
+*
+*    The functions work with offsets in the staging partition. Erase()
+*    is called with sector aligned areas, Program() with single pages.
+*    Both functions return 0 on success and <0 on errors.
+*/
+typedef struct CO_PROG_FLASH_T {
+    int16_t (*Erase)  (uint32_t offset, uint32_t size);
+    int16_t (*Program)(uint32_t offset, const uint8_t *data, uint32_t size);
+} CO_PROG_FLASH;
+
+/*! \brief PROGRAM START CALLBACK
+*
+*    This function is called with the checked program after the command
+*    CO_PROG_START. It activates the staged image (e.g. marks it for the
+*    boot loader) and returns 0, or returns <0 to reject the start.
+*/
+typedef int16_t (*CO_PROG_FUNC)(struct CO_PROG_T *prog);
+
+/*! \brief PROGRAM DOWNLOAD
+*
+*    This structure is the data of the object entries 1F50h, 1F51h and
+*    1F57h of a program. The configuration members are set by the
+*    application; the other members are managed by the object types.
+*/
+typedef struct CO_PROG_T {
+    const CO_PROG_FLASH *Flash;   /*!< flash driver of staging partition   */
+    uint32_t             Size;    /*!< partition size (multiple of sector) */
+    CO_PROG_FUNC         Start;   /*!< program start callback, or NULL     */
+    uint32_t             Offset;  /*!< number of received bytes            */
+    uint32_t             Erased;  /*!< end of the erased area              */
+    uint16_t             Crc;     /*!< CRC of the received bytes           */
+    uint8_t              Status;  /*!< flash status (CO_PROG_OK, ..ERR_x)  */
+    uint8_t              State;   /*!< program state (STOP or START)       */
+    uint8_t              Page[CO_PROG_PAGE]; /*!< incomplete page          */
+} CO_PROG;
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE PROGRAM DATA
+*
+*    This type is a write-only domain for the object 1F50h, which streams
+*    the program data into the staging partition. The data is collected
+*    in the page buffer and each full page is written at once; the last
+*    page is written, when the program is started. The image ends with its CRC (CiA 301 block transfer CRC
+*    of all preceding bytes, high byte first), so the CRC of the complete
+*    image is 0.
+*/
+extern const CO_OBJ_TYPE COTProgData;
+
+/*! \brief OBJECT TYPE PROGRAM CONTROL
+*
+*    This type is the UNSIGNED8 object 1F51h. Reading returns the program
+*    state, writing executes the program control command.
+*/
+extern const CO_OBJ_TYPE COTProgCtrl;
+
+/*! \brief OBJECT TYPE FLASH STATUS
+*
+*    This type is the read-only UNSIGNED32 object 1F57h. Bit 0 is set
+*    while program data is received, bit 1..7 hold the flash status.
+*/
+extern const CO_OBJ_TYPE COTProgStat;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
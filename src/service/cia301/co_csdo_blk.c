@@ -0,0 +1,674 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_csdo_blk.h"
+#include "co_crc16.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* transfer states */
+#define CO_CSDO_BLK_IDLE         0u    /* no block transfer                  */
+#define CO_CSDO_BLK_DN_INIT      1u    /* wait for download initiate response*/
+#define CO_CSDO_BLK_DN_ACK       2u    /* wait for acknowledge of block      */
+#define CO_CSDO_BLK_DN_END       3u    /* wait for download end response     */
+#define CO_CSDO_BLK_UP_INIT      4u    /* wait for upload initiate response  */
+#define CO_CSDO_BLK_UP_SEG       5u    /* receive segments of block          */
+#define CO_CSDO_BLK_UP_END       6u    /* wait for upload end request        */
+
+/* abort codes */
+#define CO_CSDO_BLK_ERR_TIMEOUT  0x05040000u
+#define CO_CSDO_BLK_ERR_CMD      0x05040001u
+#define CO_CSDO_BLK_ERR_SIZE     0x05040002u
+#define CO_CSDO_BLK_ERR_SEQ      0x05040003u
+#define CO_CSDO_BLK_ERR_CRC      0x05040004u
+#define CO_CSDO_BLK_ERR_MEM      0x05040005u
+#define CO_CSDO_BLK_ERR_LEN      0x06070010u
+
+#define CO_CSDO_BLK_COBID_OFF    0x80000000u
+#define CO_CSDO_BLK_SEG_LEN      7u    /* data bytes per segment             */
+#define CO_CSDO_BLK_SIZE_MAX     127u
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* block transfer state of an SDO client */
+typedef struct CO_CSDO_BLK_T {
+    CO_CSDO            *CSdo;      /* SDO client                            */
+    CO_CSDO_CALLBACK_T  Call;      /* completion callback                   */
+    uint8_t            *Buf;       /* data buffer                           */
+    uint32_t            Size;      /* download size or upload buffer size   */
+    uint32_t            Total;     /* upload size indicated by the server   */
+    uint32_t            Pos;       /* transferred bytes                     */
+    uint32_t            Ticks;     /* response timeout in timer ticks       */
+    int16_t             Tmr;       /* timeout timer action                  */
+    uint16_t            Idx;       /* index in the server                   */
+    uint8_t             Sub;       /* subindex in the server                */
+    uint8_t             State;     /* transfer state                        */
+    uint8_t             BlkSize;   /* segments per block                    */
+    uint8_t             Seq;       /* last sent or accepted segment         */
+    uint8_t             Crc;       /* CRC agreed with the server            */
+    uint8_t             Last;      /* last segment is received              */
+    uint8_t             Seg[CO_CSDO_BLK_SEG_LEN]; /* data of last segment   */
+    uint8_t             CfgSize;   /* configured upload block size          */
+    uint8_t             CfgCrc;    /* configured CRC support                */
+    uint8_t             Adapt;     /* adapted upload block size             */
+    uint8_t             Loss;      /* sequence error in current block       */
+    uint32_t            Start;     /* clock at start of transfer            */
+    CO_CSDO_BLK_XFER    Xfer;      /* report of the transfer                */
+} CO_CSDO_BLK;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled block transfers and number of running transfers */
+static CO_NODE          *BlkNode = 0;
+static uint8_t           BlkBusy = 0;
+
+/* tick counter for the transfer duration */
+static CO_CSDO_BLK_CLOCK BlkClock = 0;
+
+/* block transfer state of the SDO clients */
+static CO_CSDO_BLK       BlkCSdo[CO_CSDO_N];
+
+/* block transfer counters */
+static CO_CSDO_BLK_STAT  BlkStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void COCSdoBlkTimeout(void *parg);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BLOCK TRANSFER STATE OF SDO CLIENT
+*/
+/*---------------------------------------------------------------------------*/
+static CO_CSDO_BLK *COCSdoBlkGet(CO_CSDO *csdo)
+{
+    if ((BlkNode == 0) || (csdo < &BlkNode->CSdo[0]) ||
+        (csdo >= &BlkNode->CSdo[CO_CSDO_N])) {
+        return (0);
+    }
+    return (&BlkCSdo[csdo - &BlkNode->CSdo[0]]);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  PREPARE REQUEST TO SERVER
+*
+* \details  The frame is cleared and gets the identifier and the command
+*           byte; COCSdoBlkMux() adds the multiplexer of the transfer.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkFrm(CO_CSDO_BLK *blk, CO_IF_FRM *frm, uint8_t cmd)
+{
+    memset(frm, 0, sizeof(CO_IF_FRM));
+    CO_SET_ID  (frm, blk->CSdo->TxId);
+    CO_SET_DLC (frm, 8);
+    CO_SET_BYTE(frm, cmd, 0);
+}
+
+static void COCSdoBlkMux(CO_CSDO_BLK *blk, CO_IF_FRM *frm)
+{
+    CO_SET_WORD(frm, blk->Idx, 1);
+    CO_SET_BYTE(frm, blk->Sub, 3);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RESTART RESPONSE TIMEOUT
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkTmrStart(CO_CSDO_BLK *blk)
+{
+    if (blk->Tmr >= 0) {
+        (void)COTmrDelete(&BlkNode->Tmr, blk->Tmr);
+    }
+    blk->Tmr = COTmrCreate(&BlkNode->Tmr, blk->Ticks, 0, COCSdoBlkTimeout, blk);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FINISH BLOCK TRANSFER
+*
+* \details  The transfer is stopped and the callback is called with the
+*           abort code (0: success).
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkFinish(CO_CSDO_BLK *blk, uint32_t code)
+{
+    if (blk->Tmr >= 0) {
+        (void)COTmrDelete(&BlkNode->Tmr, blk->Tmr);
+        blk->Tmr = -1;
+    }
+    blk->State = CO_CSDO_BLK_IDLE;
+    BlkBusy--;
+    if (BlkClock != 0) {
+        blk->Xfer.Time = BlkClock() - blk->Start;
+    }
+    if (code == 0) {
+        BlkStat.Transfers++;
+    } else {
+        BlkStat.Aborted++;
+    }
+    if (blk->Call != 0) {
+        blk->Call(blk->CSdo, blk->Idx, blk->Sub, code);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ABORT BLOCK TRANSFER
+*
+* \details  The abort request is sent to the server and the transfer is
+*           finished with the abort code.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkAbort(CO_CSDO_BLK *blk, uint32_t code)
+{
+    CO_IF_FRM frm;
+
+    COCSdoBlkFrm(blk, &frm, 0x80);
+    COCSdoBlkMux(blk, &frm);
+    CO_SET_LONG(&frm, code, 4);
+    (void)COIfCanSend(&BlkNode->If, &frm);
+    COCSdoBlkFinish(blk, code);
+}
+
+static void COCSdoBlkTimeout(void *parg)
+{
+    CO_CSDO_BLK *blk = (CO_CSDO_BLK *)parg;
+
+    blk->Tmr = -1;                              /* one-shot timer is gone  */
+    if (blk->State != CO_CSDO_BLK_IDLE) {
+        COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_TIMEOUT);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  START BLOCK TRANSFER
+*/
+/*---------------------------------------------------------------------------*/
+static CO_ERR COCSdoBlkStart(CO_CSDO_BLK *blk, CO_CSDO *csdo, uint32_t key,
+                             uint8_t *buf, uint32_t size,
+                             CO_CSDO_CALLBACK_T callback, uint32_t timeout)
+{
+    if ((buf == 0) || (timeout == 0) || (timeout > 0xFFFFu)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if ((blk->State != CO_CSDO_BLK_IDLE) ||
+        ((csdo->TxId & CO_CSDO_BLK_COBID_OFF) != 0) ||
+        ((csdo->RxId & CO_CSDO_BLK_COBID_OFF) != 0)) {
+        return (CO_ERR_SDO_OFF);
+    }
+    blk->CSdo  = csdo;
+    blk->Call  = callback;
+    blk->Buf   = buf;
+    blk->Size  = size;
+    blk->Total = 0;
+    blk->Pos   = 0;
+    blk->Ticks = COTmrGetTicks(&BlkNode->Tmr, (uint16_t)timeout, CO_TMR_UNIT_1MS);
+    blk->Idx   = CO_GET_IDX(key);
+    blk->Sub   = CO_GET_SUB(key);
+    blk->Seq   = 0;
+    blk->Crc   = 0;
+    blk->Last  = 0;
+    blk->Loss  = 0;
+    blk->Start = (BlkClock != 0) ? BlkClock() : 0;
+    memset(&blk->Xfer, 0, sizeof(CO_CSDO_BLK_XFER));
+    BlkBusy++;
+    return (CO_ERR_NONE);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REPORT BLOCK SIZE
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkReport(CO_CSDO_BLK *blk)
+{
+    blk->Xfer.BlkSize = blk->BlkSize;
+    if ((blk->Xfer.MinSize == 0) || (blk->BlkSize < blk->Xfer.MinSize)) {
+        blk->Xfer.MinSize = blk->BlkSize;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ADAPT UPLOAD BLOCK SIZE
+*
+* \details  The size of the next block is halved after a block with lost
+*           segments and increased by CO_CSDO_BLK_AIMD_INC after a complete
+*           block, limited to the configured block size.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkAdapt(CO_CSDO_BLK *blk)
+{
+#if CO_CSDO_BLK_AIMD_INC > 0
+    uint32_t size = blk->BlkSize;
+
+    if (blk->Loss != 0) {
+        size = size / 2u;
+        if (size == 0) {
+            size = 1u;
+        }
+    } else {
+        size += CO_CSDO_BLK_AIMD_INC;
+        if (size > blk->CfgSize) {
+            size = blk->CfgSize;
+        }
+    }
+    blk->BlkSize = (uint8_t)size;
+    blk->Adapt   = (uint8_t)size;
+    COCSdoBlkReport(blk);
+#endif
+    blk->Loss = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND DOWNLOAD BLOCK
+*
+* \details  The segments of the next block are sent, starting at the
+*           acknowledged position.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkDnBlock(CO_CSDO_BLK *blk)
+{
+    CO_IF_FRM frm;
+    uint32_t  pos = blk->Pos;
+    uint32_t  len;
+    uint8_t   seq = 0;
+
+    while ((seq < blk->BlkSize) && (pos < blk->Size)) {
+        seq++;
+        len = blk->Size - pos;
+        if (len > CO_CSDO_BLK_SEG_LEN) {
+            len = CO_CSDO_BLK_SEG_LEN;
+        }
+        COCSdoBlkFrm(blk, &frm, ((pos + len) >= blk->Size) ? (uint8_t)(0x80u | seq) : seq);
+        memcpy(&frm.Data[1], &blk->Buf[pos], len);
+        (void)COIfCanSend(&BlkNode->If, &frm);
+        pos += len;
+    }
+    BlkStat.Segments   += seq;
+    blk->Xfer.Segments += seq;
+    blk->Seq   = seq;
+    blk->State = CO_CSDO_BLK_DN_ACK;
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  DOWNLOAD RESPONSE
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkDnResponse(CO_CSDO_BLK *blk, CO_IF_FRM *frm)
+{
+    CO_IF_FRM frm_end;
+    uint8_t   cmd = CO_GET_BYTE(frm, 0);
+    uint8_t   ack;
+    uint16_t  crc = 0;
+    uint8_t   n;
+
+    if (blk->State == CO_CSDO_BLK_DN_INIT) {
+        if (((cmd & 0xE3u) != 0xA0u) ||
+            (CO_GET_WORD(frm, 1) != blk->Idx) || (CO_GET_BYTE(frm, 3) != blk->Sub)) {
+            COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_CMD);
+            return;
+        }
+        blk->BlkSize = CO_GET_BYTE(frm, 4);
+        blk->Crc     = ((blk->CfgCrc != 0) && ((cmd & 0x04u) != 0)) ? 1u : 0u;
+
+    } else if (blk->State == CO_CSDO_BLK_DN_ACK) {
+        ack = CO_GET_BYTE(frm, 1);
+        if (cmd != 0xA2u) {
+            COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_CMD);
+            return;
+        }
+        if (ack > blk->Seq) {
+            COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_SEQ);
+            return;
+        }
+        BlkStat.Repeated   += (uint32_t)(blk->Seq - ack);
+        blk->Xfer.Repeated += (uint32_t)(blk->Seq - ack);
+        blk->Xfer.Blocks++;
+        blk->Pos += (uint32_t)ack * CO_CSDO_BLK_SEG_LEN;
+        if (blk->Pos > blk->Size) {
+            blk->Pos = blk->Size;
+        }
+        blk->BlkSize = CO_GET_BYTE(frm, 2);
+        if (blk->Pos >= blk->Size) {            /* all data acknowledged   */
+            if (blk->Crc != 0) {
+                crc = COCrc16(0, blk->Buf, blk->Size);
+            }
+            n = (uint8_t)((CO_CSDO_BLK_SEG_LEN - (blk->Size % CO_CSDO_BLK_SEG_LEN)) %
+                          CO_CSDO_BLK_SEG_LEN);
+            COCSdoBlkFrm(blk, &frm_end, (uint8_t)(0xC1u | (n << 2)));
+            CO_SET_WORD(&frm_end, crc, 1);
+            (void)COIfCanSend(&BlkNode->If, &frm_end);
+            blk->State = CO_CSDO_BLK_DN_END;
+            COCSdoBlkTmrStart(blk);
+            return;
+        }
+
+    } else {                                    /* CO_CSDO_BLK_DN_END      */
+        if (cmd != 0xA1u) {
+            COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_CMD);
+        } else {
+            COCSdoBlkFinish(blk, 0);
+        }
+        return;
+    }
+
+    if ((blk->BlkSize == 0) || (blk->BlkSize > CO_CSDO_BLK_SIZE_MAX)) {
+        COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_SIZE);
+        return;
+    }
+    COCSdoBlkReport(blk);
+    COCSdoBlkDnBlock(blk);
+    COCSdoBlkTmrStart(blk);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  UPLOAD SEGMENT
+*
+* \details  Segments in sequence are stored; the data of the last segment
+*           is kept until the end request gives its length. Segments out of
+*           sequence are dropped and repeated by the server after the
+*           acknowledge of the block.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkUpSegment(CO_CSDO_BLK *blk, CO_IF_FRM *frm)
+{
+    CO_IF_FRM frm_ack;
+    uint8_t   cmd  = CO_GET_BYTE(frm, 0);
+    uint8_t   seq  = cmd & 0x7Fu;
+    uint8_t   last = cmd & 0x80u;
+
+    if (seq == (uint8_t)(blk->Seq + 1u)) {
+        if (last != 0) {
+            memcpy(blk->Seg, &frm->Data[1], CO_CSDO_BLK_SEG_LEN);
+            blk->Last = 1;
+        } else {
+            if ((blk->Size - blk->Pos) < CO_CSDO_BLK_SEG_LEN) {
+                COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_MEM);
+                return;
+            }
+            memcpy(&blk->Buf[blk->Pos], &frm->Data[1], CO_CSDO_BLK_SEG_LEN);
+            blk->Pos += CO_CSDO_BLK_SEG_LEN;
+        }
+        blk->Seq = seq;
+        BlkStat.Segments++;
+        blk->Xfer.Segments++;
+    } else {
+        BlkStat.Repeated++;
+        blk->Xfer.Repeated++;
+        blk->Loss = 1;
+    }
+
+    if ((last != 0) || (seq >= blk->BlkSize)) { /* end of block            */
+        blk->Xfer.Blocks++;
+        COCSdoBlkAdapt(blk);
+        COCSdoBlkFrm(blk, &frm_ack, 0xA2u);
+        CO_SET_BYTE(&frm_ack, blk->Seq, 1);
+        CO_SET_BYTE(&frm_ack, blk->BlkSize, 2);
+        (void)COIfCanSend(&BlkNode->If, &frm_ack);
+        blk->Seq = 0;
+        if (blk->Last != 0) {
+            blk->State = CO_CSDO_BLK_UP_END;
+        }
+    }
+    COCSdoBlkTmrStart(blk);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  UPLOAD RESPONSE
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoBlkUpResponse(CO_CSDO_BLK *blk, CO_IF_FRM *frm)
+{
+    CO_IF_FRM frm_rsp;
+    uint8_t   cmd = CO_GET_BYTE(frm, 0);
+    uint32_t  len;
+
+    if (blk->State == CO_CSDO_BLK_UP_SEG) {
+        COCSdoBlkUpSegment(blk, frm);
+        return;
+    }
+
+    if (blk->State == CO_CSDO_BLK_UP_INIT) {
+        if (((cmd & 0xE1u) != 0xC0u) ||
+            (CO_GET_WORD(frm, 1) != blk->Idx) || (CO_GET_BYTE(frm, 3) != blk->Sub)) {
+            COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_CMD);
+            return;
+        }
+        if ((cmd & 0x02u) != 0) {               /* size indicated          */
+            blk->Total = CO_GET_LONG(frm, 4);
+            if (blk->Total > blk->Size) {
+                COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_MEM);
+                return;
+            }
+        }
+        blk->Crc = ((blk->CfgCrc != 0) && ((cmd & 0x04u) != 0)) ? 1u : 0u;
+        COCSdoBlkFrm(blk, &frm_rsp, 0xA3u);     /* start upload            */
+        (void)COIfCanSend(&BlkNode->If, &frm_rsp);
+        blk->State = CO_CSDO_BLK_UP_SEG;
+        COCSdoBlkTmrStart(blk);
+        return;
+    }
+
+    if ((cmd & 0xE3u) != 0xC1u) {               /* CO_CSDO_BLK_UP_END      */
+        COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_CMD);
+        return;
+    }
+    len = CO_CSDO_BLK_SEG_LEN - ((cmd >> 2) & 0x07u);
+    if ((blk->Size - blk->Pos) < len) {
+        COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_MEM);
+        return;
+    }
+    memcpy(&blk->Buf[blk->Pos], blk->Seg, len);
+    blk->Pos += len;
+    if ((blk->Total != 0) && (blk->Pos != blk->Total)) {
+        COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_LEN);
+        return;
+    }
+    if ((blk->Crc != 0) && (COCrc16(0, blk->Buf, blk->Pos) != CO_GET_WORD(frm, 1))) {
+        COCSdoBlkAbort(blk, CO_CSDO_BLK_ERR_CRC);
+        return;
+    }
+    COCSdoBlkFrm(blk, &frm_rsp, 0xA1u);         /* end response            */
+    (void)COIfCanSend(&BlkNode->If, &frm_rsp);
+    COCSdoBlkFinish(blk, 0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COCSdoBlkInit(CO_NODE *node, CO_CSDO_BLK_CLOCK clock)
+{
+    uint8_t n;
+
+    if (BlkNode != 0) {
+        for (n = 0; n < CO_CSDO_N; n++) {
+            if (BlkCSdo[n].Tmr >= 0) {
+                (void)COTmrDelete(&BlkNode->Tmr, BlkCSdo[n].Tmr);
+            }
+        }
+    }
+    for (n = 0; n < CO_CSDO_N; n++) {
+        memset(&BlkCSdo[n], 0, sizeof(CO_CSDO_BLK));
+        BlkCSdo[n].Tmr     = -1;
+        BlkCSdo[n].CfgSize = CO_CSDO_BLK_SIZE;
+        BlkCSdo[n].CfgCrc  = CO_CSDO_BLK_CRC;
+        BlkCSdo[n].Adapt   = CO_CSDO_BLK_SIZE;
+    }
+    memset(&BlkStat, 0, sizeof(BlkStat));
+    BlkBusy  = 0;
+    BlkClock = clock;
+    BlkNode  = node;
+}
+
+/*
+* see function definition
+*/
+CO_ERR COCSdoBlkSetup(CO_CSDO *csdo, uint8_t size, uint8_t crc)
+{
+    CO_CSDO_BLK *blk = COCSdoBlkGet(csdo);
+
+    if ((blk == 0) || (size == 0) || (size > CO_CSDO_BLK_SIZE_MAX)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    blk->CfgSize = size;
+    blk->CfgCrc  = (crc != 0) ? 1u : 0u;
+    blk->Adapt   = size;
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+CO_ERR COCSdoRequestBlockDownload(CO_CSDO *csdo,
+                                  uint32_t key,
+                                  uint8_t *buf,
+                                  uint32_t size,
+                                  CO_CSDO_CALLBACK_T callback,
+                                  uint32_t timeout)
+{
+    CO_CSDO_BLK *blk = COCSdoBlkGet(csdo);
+    CO_IF_FRM    frm;
+    CO_ERR       err;
+
+    if ((blk == 0) || (size == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    err = COCSdoBlkStart(blk, csdo, key, buf, size, callback, timeout);
+    if (err != CO_ERR_NONE) {
+        return (err);
+    }
+    COCSdoBlkFrm(blk, &frm, (blk->CfgCrc != 0) ? 0xC6u : 0xC2u);
+    COCSdoBlkMux(blk, &frm);
+    CO_SET_LONG(&frm, size, 4);
+    (void)COIfCanSend(&BlkNode->If, &frm);
+    blk->State = CO_CSDO_BLK_DN_INIT;
+    COCSdoBlkTmrStart(blk);
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+CO_ERR COCSdoRequestBlockUpload(CO_CSDO *csdo,
+                                uint32_t key,
+                                uint8_t *buf,
+                                uint32_t size,
+                                CO_CSDO_CALLBACK_T callback,
+                                uint32_t timeout)
+{
+    CO_CSDO_BLK *blk = COCSdoBlkGet(csdo);
+    CO_IF_FRM    frm;
+    CO_ERR       err;
+
+    if (blk == 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+    err = COCSdoBlkStart(blk, csdo, key, buf, size, callback, timeout);
+    if (err != CO_ERR_NONE) {
+        return (err);
+    }
+    blk->BlkSize = blk->Adapt;
+    COCSdoBlkReport(blk);
+    COCSdoBlkFrm(blk, &frm, (blk->CfgCrc != 0) ? 0xA4u : 0xA0u);
+    COCSdoBlkMux(blk, &frm);
+    CO_SET_BYTE(&frm, blk->BlkSize, 4);
+    CO_SET_BYTE(&frm, 0, 5);                    /* no protocol switch      */
+    (void)COIfCanSend(&BlkNode->If, &frm);
+    blk->State = CO_CSDO_BLK_UP_INIT;
+    COCSdoBlkTmrStart(blk);
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+uint32_t COCSdoBlkSize(CO_CSDO *csdo)
+{
+    CO_CSDO_BLK *blk = COCSdoBlkGet(csdo);
+
+    if (blk == 0) {
+        return (0);
+    }
+    return (blk->Pos);
+}
+
+/*
+* see function definition
+*/
+const CO_CSDO_BLK_XFER *COCSdoBlkXfer(CO_CSDO *csdo)
+{
+    CO_CSDO_BLK *blk = COCSdoBlkGet(csdo);
+
+    if (blk == 0) {
+        return (0);
+    }
+    return (&blk->Xfer);
+}
+
+/*
+* see function definition
+*/
+int16_t COCSdoBlkReceive(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_CSDO_BLK *blk;
+    uint8_t      n;
+
+    if ((BlkBusy == 0) || (cif != &BlkNode->If)) {
+        return (0);
+    }
+    for (n = 0; n < CO_CSDO_N; n++) {
+        blk = &BlkCSdo[n];
+        if ((blk->State == CO_CSDO_BLK_IDLE) ||
+            (CO_GET_ID(frm) != blk->CSdo->RxId)) {
+            continue;
+        }
+        if (CO_GET_BYTE(frm, 0) == 0x80u) {     /* abort by server         */
+            COCSdoBlkFinish(blk, CO_GET_LONG(frm, 4));
+        } else if (blk->State <= CO_CSDO_BLK_DN_END) {
+            COCSdoBlkDnResponse(blk, frm);
+        } else {
+            COCSdoBlkUpResponse(blk, frm);
+        }
+        return (1);
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+const CO_CSDO_BLK_STAT *COCSdoBlkStat(void)
+{
+    return (&BlkStat);
+}
+
+#endif  /* #if USE_CSDO */
@@ -0,0 +1,295 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CSDO_BLK_H_
+#define CO_CSDO_BLK_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief DEFAULT BLOCK SIZE
+*
+*    Number of segments per block (1..127), which the client requests for
+*    block uploads. The block size of downloads is given by the server.
+*/
+#ifndef CO_CSDO_BLK_SIZE
+#define CO_CSDO_BLK_SIZE       127u
+#endif
+
+/*! \brief DEFAULT CRC SUPPORT
+*
+*    The client offers the CRC of the block transfer to the server (1) or
+*    not (0). The CRC is used, when both sides support it.
+*/
+#ifndef CO_CSDO_BLK_CRC
+#define CO_CSDO_BLK_CRC        1u
+#endif
+
+/*! \brief BLOCK SIZE ADAPTATION
+*
+*    The block size of uploads follows the sequence errors (AIMD): a block
+*    with lost segments halves the size of the next block, a complete block
+*    increases it by CO_CSDO_BLK_AIMD_INC up to the configured block size.
+*    The reached size is kept for the next upload of the client. The value
+*    0 disables the adaptation.
+*/
+#ifndef CO_CSDO_BLK_AIMD_INC
+#define CO_CSDO_BLK_AIMD_INC   4u
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief SDO CLIENT BLOCK TRANSFER STATISTICS
+*
+*    Counters of the block transfers since COCSdoBlkInit().
+*/
+typedef struct CO_CSDO_BLK_STAT_T {
+    uint32_t Transfers;        /*!< successfully finished transfers         */
+    uint32_t Aborted;          /*!< transfers aborted or timed out          */
+    uint32_t Segments;         /*!< sent or accepted segments               */
+    uint32_t Repeated;         /*!< segments to repeat (not acknowledged)   */
+} CO_CSDO_BLK_STAT;
+
+/*! \brief SDO CLIENT BLOCK TRANSFER REPORT
+*
+*    Counters of the current or last block transfer of an SDO client. The
+*    block size of downloads is given by the server.
+*/
+typedef struct CO_CSDO_BLK_XFER_T {
+    uint32_t Segments;         /*!< sent or accepted segments               */
+    uint32_t Repeated;         /*!< segments to repeat (not acknowledged)   */
+    uint32_t Time;             /*!< duration in clock ticks                 */
+    uint16_t Blocks;           /*!< acknowledged blocks                     */
+    uint8_t  BlkSize;          /*!< block size of the last block            */
+    uint8_t  MinSize;          /*!< smallest block size                     */
+} CO_CSDO_BLK_XFER;
+
+/*! \brief SDO CLIENT BLOCK TRANSFER CLOCK FUNCTION
+*
+*    Returns a free running tick counter (e.g. microseconds).
+*/
+typedef uint32_t (*CO_CSDO_BLK_CLOCK)(void);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT SDO CLIENT BLOCK TRANSFERS
+*
+* \details  This function enables the block transfers of the SDO clients of
+*           the given node. It must be called after CONodeInit(). Running
+*           block transfers are dropped without callback; the block size
+*           and CRC support of all clients are set to CO_CSDO_BLK_SIZE and
+*           CO_CSDO_BLK_CRC.
+*
+*           While a block transfer is running, the responses of the server
+*           are consumed before the stack processes the received frame (see
+*           CO_CSDO_BLK_WRAP). The stack functions of the same SDO client
+*           must not be used during this time.
+*
+* \param    node
+*           reference to the node; NULL disables the block transfers
+*
+* \param    clock
+*           tick counter for the transfer duration; NULL disables the
+*           measurement
+*/
+/*---------------------------------------------------------------------------*/
+void COCSdoBlkInit(CO_NODE *node, CO_CSDO_BLK_CLOCK clock);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SETUP SDO CLIENT BLOCK TRANSFERS
+*
+* \details  This function changes the block size of uploads and the CRC
+*           support for the next block transfers of the SDO client. The
+*           adapted block size starts again with the given size.
+*
+* \param    csdo
+*           pointer to the SDO client
+*
+* \param    size
+*           maximal number of segments per upload block (1..127)
+*
+* \param    crc
+*           offer the CRC to the server (1) or not (0)
+*
+* \retval   =CO_ERR_NONE       settings changed
+* \retval   =CO_ERR_BAD_ARG    bad client or block size
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR COCSdoBlkSetup(CO_CSDO *csdo, uint8_t size, uint8_t crc);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REQUEST SDO BLOCK DOWNLOAD
+*
+* \details  This function starts the block download of the buffer into the
+*           object entry of the server. The function returns after the
+*           initiate request; the transfer continues with the responses of
+*           the server and finishes with the callback. The abort code of the
+*           callback is 0 on success. The buffer must be kept until the
+*           callback is called.
+*
+* \param    csdo
+*           pointer to the SDO client
+*
+* \param    key
+*           object entry key (CO_DEV(index, subindex)) in the server
+*
+* \param    buf
+*           pointer to the data
+*
+* \param    size
+*           number of bytes to download (at least 1)
+*
+* \param    callback
+*           completion callback, or NULL
+*
+* \param    timeout
+*           timeout of each server response in ms
+*
+* \retval   =CO_ERR_NONE       transfer started
+* \retval   =CO_ERR_BAD_ARG    bad argument
+* \retval   =CO_ERR_SDO_OFF    client disabled or busy with a block transfer
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR COCSdoRequestBlockDownload(CO_CSDO *csdo,
+                                  uint32_t key,
+                                  uint8_t *buf,
+                                  uint32_t size,
+                                  CO_CSDO_CALLBACK_T callback,
+                                  uint32_t timeout);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REQUEST SDO BLOCK UPLOAD
+*
+* \details  This function starts the block upload of the object entry of
+*           the server into the buffer. The function returns after the
+*           initiate request; the transfer continues with the segments of
+*           the server and finishes with the callback. The abort code of the
+*           callback is 0 on success; COCSdoBlkSize() returns the number of
+*           received bytes. A domain, which exceeds the buffer, is aborted
+*           with 05040005h (out of memory).
+*
+* \param    csdo
+*           pointer to the SDO client
+*
+* \param    key
+*           object entry key (CO_DEV(index, subindex)) in the server
+*
+* \param    buf
+*           pointer to the receive buffer
+*
+* \param    size
+*           size of the receive buffer in bytes
+*
+* \param    callback
+*           completion callback, or NULL
+*
+* \param    timeout
+*           timeout of each server response in ms
+*
+* \retval   =CO_ERR_NONE       transfer started
+* \retval   =CO_ERR_BAD_ARG    bad argument
+* \retval   =CO_ERR_SDO_OFF    client disabled or busy with a block transfer
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR COCSdoRequestBlockUpload(CO_CSDO *csdo,
+                                uint32_t key,
+                                uint8_t *buf,
+                                uint32_t size,
+                                CO_CSDO_CALLBACK_T callback,
+                                uint32_t timeout);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SIZE OF LAST BLOCK TRANSFER
+*
+* \details  This function returns the number of bytes, which are
+*           transferred with the current or last block transfer of the SDO
+*           client. For downloads, only acknowledged segments are counted.
+*
+* \param    csdo
+*           pointer to the SDO client
+*
+* \return   number of transferred bytes
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t COCSdoBlkSize(CO_CSDO *csdo);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REPORT OF LAST BLOCK TRANSFER
+*
+* \details  This function returns the counters of the current or last block
+*           transfer of the SDO client. The report is complete, when the
+*           callback of the transfer is called.
+*
+* \param    csdo
+*           pointer to the SDO client
+*
+* \retval   >0    reference to the report
+* \retval   =0    bad client or block transfers disabled
+*/
+/*---------------------------------------------------------------------------*/
+const CO_CSDO_BLK_XFER *COCSdoBlkXfer(CO_CSDO *csdo);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE BLOCK TRANSFER RESPONSE
+*
+* \details  This function processes a received frame, when it is the
+*           response of a server to a running block transfer. It is called
+*           for each frame, which is read from the CAN interface (see
+*           CO_CSDO_BLK_WRAP).
+*
+* \param    cif
+*           CAN interface of the received frame
+*
+* \param    frm
+*           received CAN frame
+*
+* \retval   =1    frame is consumed by a block transfer
+* \retval   =0    frame is not a block transfer response
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COCSdoBlkReceive(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SDO CLIENT BLOCK TRANSFER STATISTICS
+*
+* \details  This function returns the counters of the block transfers.
+*
+* \return   reference to the statistics
+*/
+/*---------------------------------------------------------------------------*/
+const CO_CSDO_BLK_STAT *COCSdoBlkStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
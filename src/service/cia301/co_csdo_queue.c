@@ -0,0 +1,406 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_csdo_queue.h"
+#include "co_csdo_blk.h"
+#include "co_dispatch.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_CSDO_QUEUE_COBID_OFF  0x80000000u
+
+/* busy flag of an SDO server in the node bitmap */
+#define CO_CSDO_QUEUE_BUSY(id)   (QueueBusy[(id) >> 5] & (1uL << ((id) & 0x1Fu)))
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled queue, kick timer and callback nesting */
+static CO_NODE            *QueueNode = 0;
+static int16_t             QueueTmr  = -1;
+static uint8_t             QueueCall = 0;
+
+/* waiting requests (FIFO) */
+static CO_CSDO_REQ        *QueueHead = 0;
+static CO_CSDO_REQ        *QueueTail = 0;
+
+/* running request of each SDO client and the clients used by the queue */
+static CO_CSDO_REQ        *QueueRun[CO_CSDO_N];
+static uint8_t             QueueUse[CO_CSDO_N];
+
+/* SDO servers with running transfer (bitmap of node-ids) */
+static uint32_t            QueueBusy[4];
+
+/* queue counters */
+static CO_CSDO_QUEUE_STAT  QueueStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void COCSdoQueueKick(void);
+static void COCSdoQueueTimer(void *parg);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SWITCH CLIENT TO SERVER
+*
+* \details  The server node-id of the stack client is changed; the COB-IDs
+*           are moved by the difference of the node-ids, like the stack
+*           derives them from 1280h+n. The dictionary entry is updated for
+*           SDO accesses and the dispatch table.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoQueueTarget(uint8_t num, uint8_t nodeId)
+{
+    CO_CSDO *csdo = &QueueNode->CSdo[num];
+
+    if (csdo->NodeId == nodeId) {
+        return;
+    }
+    csdo->TxId   = (csdo->TxId - csdo->NodeId) + nodeId;
+    csdo->RxId   = (csdo->RxId - csdo->NodeId) + nodeId;
+    csdo->NodeId = nodeId;
+    (void)CODictWrByte(&QueueNode->Dict, CO_DEV(0x1280u + num, 3), nodeId);
+    CODispatchTouch(CO_DEV(0x1280u + num, 3));
+    QueueStat.Retargets++;
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SERVER BUSY FLAG
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoQueueBusy(uint8_t nodeId, uint8_t busy)
+{
+    if (busy != 0) {
+        QueueBusy[nodeId >> 5] |=  (1uL << (nodeId & 0x1Fu));
+    } else {
+        QueueBusy[nodeId >> 5] &= ~(1uL << (nodeId & 0x1Fu));
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FINISH REQUEST
+*
+* \details  The callback of the request is called with the abort code.
+*           Requests, which are submitted within the callback, are started
+*           by the kick timer.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoQueueDone(CO_CSDO_REQ *req, uint32_t code)
+{
+    req->Code  = code;
+    req->State = CO_CSDO_REQ_IDLE;
+    if (code == 0) {
+        QueueStat.Finished++;
+    } else {
+        QueueStat.Failed++;
+    }
+    if (req->Call != 0) {
+        QueueCall++;
+        req->Call(req, code);
+        QueueCall--;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  TRANSFER FINISHED (CLIENT CALLBACK)
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoQueueFinished(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code)
+{
+    CO_CSDO_REQ *req;
+    uint8_t      num;
+
+    (void)index;
+    (void)sub;
+    if ((QueueNode == 0) || (csdo < &QueueNode->CSdo[0]) ||
+        (csdo >= &QueueNode->CSdo[CO_CSDO_N])) {
+        return;
+    }
+    num = (uint8_t)(csdo - &QueueNode->CSdo[0]);
+    req = QueueRun[num];
+    if (req == 0) {
+        return;
+    }
+    QueueRun[num] = 0;
+    QueueStat.Running--;
+    COCSdoQueueBusy(req->NodeId, 0);
+
+    /* the client is released after this callback; start the next request
+     * with the kick timer */
+    if ((QueueHead != 0) && (QueueTmr < 0)) {
+        QueueTmr = COTmrCreate(&QueueNode->Tmr, 1, 0, COCSdoQueueTimer, 0);
+    }
+    COCSdoQueueDone(req, code);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  START REQUEST ON CLIENT
+*/
+/*---------------------------------------------------------------------------*/
+static CO_ERR COCSdoQueueStart(CO_CSDO_REQ *req, uint8_t num)
+{
+    CO_CSDO *csdo = &QueueNode->CSdo[num];
+    CO_ERR   err;
+
+    COCSdoQueueTarget(num, req->NodeId);
+    QueueRun[num] = req;
+    req->State    = CO_CSDO_REQ_RUNNING;
+    if (req->Type == CO_CSDO_REQ_UPLOAD) {
+        err = COCSdoRequestUpload(csdo, req->Key, req->Buf, req->Size,
+                                  COCSdoQueueFinished, req->Timeout);
+    } else if (req->Type == CO_CSDO_REQ_DOWNLOAD) {
+        err = COCSdoRequestDownload(csdo, req->Key, req->Buf, req->Size,
+                                    COCSdoQueueFinished, req->Timeout);
+    } else if (req->Type == CO_CSDO_REQ_BLK_UPLOAD) {
+        err = COCSdoRequestBlockUpload(csdo, req->Key, req->Buf, req->Size,
+                                       COCSdoQueueFinished, req->Timeout);
+    } else {
+        err = COCSdoRequestBlockDownload(csdo, req->Key, req->Buf, req->Size,
+                                         COCSdoQueueFinished, req->Timeout);
+    }
+    if (err != CO_ERR_NONE) {
+        QueueRun[num] = 0;
+        return (err);
+    }
+    QueueStat.Running++;
+    COCSdoQueueBusy(req->NodeId, 1);
+    return (CO_ERR_NONE);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FREE CLIENT FOR SERVER
+*
+* \details  A free client, which is already connected to the server, is
+*           preferred to avoid a switch of the COB-IDs.
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COCSdoQueueFree(uint8_t nodeId)
+{
+    int16_t free = -1;
+    uint8_t n;
+
+    for (n = 0; n < CO_CSDO_N; n++) {
+        if ((QueueUse[n] == 0) || (QueueRun[n] != 0)) {
+            continue;
+        }
+        if (QueueNode->CSdo[n].NodeId == nodeId) {
+            return ((int16_t)n);
+        }
+        if (free < 0) {
+            free = (int16_t)n;
+        }
+    }
+    return (free);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  START WAITING REQUESTS
+*
+* \details  The queue is scanned in submit order. Requests to servers with
+*           a running transfer are skipped, so they keep their order.
+*/
+/*---------------------------------------------------------------------------*/
+static void COCSdoQueueKick(void)
+{
+    CO_CSDO_REQ *req;
+    CO_CSDO_REQ *prev = 0;
+    CO_CSDO_REQ *next;
+    int16_t      num;
+
+    req = QueueHead;
+    while ((req != 0) && (QueueStat.Running < CO_CSDO_N)) {
+        next = req->Next;
+        if (CO_CSDO_QUEUE_BUSY(req->NodeId) != 0) {
+            prev = req;
+            req  = next;
+            continue;
+        }
+        num = COCSdoQueueFree(req->NodeId);
+        if (num < 0) {
+            break;
+        }
+        if (prev == 0) {                        /* unlink from queue       */
+            QueueHead = next;
+        } else {
+            prev->Next = next;
+        }
+        if (QueueTail == req) {
+            QueueTail = prev;
+        }
+        req->Next = 0;
+        QueueStat.Pending--;
+        if (COCSdoQueueStart(req, (uint8_t)num) != CO_ERR_NONE) {
+            COCSdoQueueDone(req, CO_CSDO_REQ_ERR_START);
+        }
+        req = next;
+    }
+}
+
+static void COCSdoQueueTimer(void *parg)
+{
+    (void)parg;
+    QueueTmr = -1;                              /* one-shot timer is gone  */
+    if (QueueNode != 0) {
+        COCSdoQueueKick();
+    }
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COCSdoQueueInit(CO_NODE *node)
+{
+    int16_t used = 0;
+    uint8_t n;
+
+    if ((QueueNode != 0) && (QueueTmr >= 0)) {
+        (void)COTmrDelete(&QueueNode->Tmr, QueueTmr);
+    }
+    QueueTmr  = -1;
+    QueueCall = 0;
+    QueueHead = 0;
+    QueueTail = 0;
+    for (n = 0; n < 4; n++) {
+        QueueBusy[n] = 0;
+    }
+    QueueStat.Submitted  = 0;
+    QueueStat.Finished   = 0;
+    QueueStat.Failed     = 0;
+    QueueStat.Retargets  = 0;
+    QueueStat.Pending    = 0;
+    QueueStat.MaxPending = 0;
+    QueueStat.Running    = 0;
+
+    QueueNode = node;
+    for (n = 0; n < CO_CSDO_N; n++) {
+        QueueRun[n] = 0;
+        QueueUse[n] = 0;
+        if ((node != 0) &&
+            ((node->CSdo[n].TxId & CO_CSDO_QUEUE_COBID_OFF) == 0) &&
+            ((node->CSdo[n].RxId & CO_CSDO_QUEUE_COBID_OFF) == 0)) {
+            QueueUse[n] = 1;
+            used++;
+        }
+    }
+    if (node == 0) {
+        return (-1);
+    }
+    return (used);
+}
+
+/*
+* see function definition
+*/
+CO_ERR COCSdoQueueSubmit(CO_CSDO_REQ *req,
+                         uint8_t type,
+                         uint8_t nodeId,
+                         uint32_t key,
+                         uint8_t *buf,
+                         uint32_t size,
+                         CO_CSDO_REQ_FUNC func,
+                         uint32_t timeout)
+{
+    if (QueueNode == 0) {
+        return (CO_ERR_SDO_OFF);
+    }
+    if ((req == 0) || (req->State != CO_CSDO_REQ_IDLE) ||
+        (type > CO_CSDO_REQ_BLK_DOWNLOAD) ||
+        (nodeId < 1) || (nodeId > 127) || (buf == 0)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    req->Next    = 0;
+    req->Call    = func;
+    req->Buf     = buf;
+    req->Size    = size;
+    req->Key     = key;
+    req->Timeout = timeout;
+    req->Code    = 0;
+    req->NodeId  = nodeId;
+    req->Type    = type;
+    req->State   = CO_CSDO_REQ_QUEUED;
+
+    if (QueueTail == 0) {
+        QueueHead = req;
+    } else {
+        QueueTail->Next = req;
+    }
+    QueueTail = req;
+    QueueStat.Submitted++;
+    QueueStat.Pending++;
+    if (QueueStat.Pending > QueueStat.MaxPending) {
+        QueueStat.MaxPending = QueueStat.Pending;
+    }
+
+    if (QueueCall == 0) {
+        COCSdoQueueKick();
+    } else if (QueueTmr < 0) {
+        QueueTmr = COTmrCreate(&QueueNode->Tmr, 1, 0, COCSdoQueueTimer, 0);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COCSdoQueueCancel(CO_CSDO_REQ *req)
+{
+    CO_CSDO_REQ *prev = 0;
+    CO_CSDO_REQ *cur  = QueueHead;
+
+    while (cur != 0) {
+        if (cur == req) {
+            if (prev == 0) {
+                QueueHead = cur->Next;
+            } else {
+                prev->Next = cur->Next;
+            }
+            if (QueueTail == cur) {
+                QueueTail = prev;
+            }
+            cur->Next  = 0;
+            cur->State = CO_CSDO_REQ_IDLE;
+            QueueStat.Pending--;
+            return (0);
+        }
+        prev = cur;
+        cur  = cur->Next;
+    }
+    return (-1);
+}
+
+/*
+* see function definition
+*/
+const CO_CSDO_QUEUE_STAT *COCSdoQueueStat(void)
+{
+    return (&QueueStat);
+}
+
+#endif  /* #if USE_CSDO */
@@ -0,0 +1,203 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CSDO_QUEUE_H_
+#define CO_CSDO_QUEUE_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_CSDO_REQ_UPLOAD       0u    /*!< expedited or segmented upload   */
+#define CO_CSDO_REQ_DOWNLOAD     1u    /*!< expedited or segmented download */
+#define CO_CSDO_REQ_BLK_UPLOAD   2u    /*!< block upload (CO_CSDO_BLK)      */
+#define CO_CSDO_REQ_BLK_DOWNLOAD 3u    /*!< block download (CO_CSDO_BLK)    */
+
+#define CO_CSDO_REQ_IDLE         0u    /*!< request not submitted           */
+#define CO_CSDO_REQ_QUEUED       1u    /*!< request waits for a client      */
+#define CO_CSDO_REQ_RUNNING      2u    /*!< transfer is running             */
+
+/*! \brief REQUEST START FAILED
+*
+*    Abort code of requests, which are finished without transfer, because
+*    the SDO client rejected the request (general error).
+*/
+#define CO_CSDO_REQ_ERR_START    0x08000000u
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_CSDO_REQ_T;
+
+/*! \brief SDO REQUEST CALLBACK
+*
+*    Called once, when the transfer of the request is finished. The abort
+*    code is 0 on success. The request may be submitted again from within
+*    the callback.
+*/
+typedef void (*CO_CSDO_REQ_FUNC)(struct CO_CSDO_REQ_T *req, uint32_t code);
+
+/*! \brief SDO REQUEST
+*
+*    A transfer request of the SDO client queue. The memory is provided by
+*    the application and must be kept until the callback is called.
+*/
+typedef struct CO_CSDO_REQ_T {
+    struct CO_CSDO_REQ_T *Next;    /*!< next queued request (internal)      */
+    CO_CSDO_REQ_FUNC      Call;    /*!< completion callback                 */
+    void                 *Para;    /*!< application parameter               */
+    uint8_t              *Buf;     /*!< data buffer                         */
+    uint32_t              Size;    /*!< data or buffer size in bytes        */
+    uint32_t              Key;     /*!< object entry key in the server      */
+    uint32_t              Timeout; /*!< response timeout in ms              */
+    uint32_t              Code;    /*!< abort code of the finished transfer */
+    uint8_t               NodeId;  /*!< node-id of the SDO server           */
+    uint8_t               Type;    /*!< transfer type (CO_CSDO_REQ_xxx)     */
+    uint8_t               State;   /*!< request state (CO_CSDO_REQ_xxx)     */
+} CO_CSDO_REQ;
+
+/*! \brief SDO CLIENT QUEUE STATISTICS
+*
+*    Counters of the SDO client queue since COCSdoQueueInit().
+*/
+typedef struct CO_CSDO_QUEUE_STAT_T {
+    uint32_t Submitted;        /*!< accepted requests                       */
+    uint32_t Finished;         /*!< successfully finished requests          */
+    uint32_t Failed;           /*!< aborted or rejected requests            */
+    uint32_t Retargets;        /*!< client switched to another server       */
+    uint16_t Pending;          /*!< requests waiting for a client           */
+    uint16_t MaxPending;       /*!< maximum of waiting requests             */
+    uint8_t  Running;          /*!< transfers in progress                   */
+} CO_CSDO_QUEUE_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT SDO CLIENT QUEUE
+*
+* \details  This function enables the request queue for the SDO clients of
+*           the given node. It must be called after CONodeInit(). All
+*           enabled SDO clients (1280h+n) are used by the queue; they must
+*           not be used with the stack functions anymore. Queued requests
+*           of a previous initialization are dropped without callback.
+*
+*           The requests are started in submit order on the free clients.
+*           Requests to the same server are serialized, requests to
+*           different servers run in parallel. A client is switched to
+*           another server by changing its server node-id (1280h+n:3) and
+*           the COB-IDs of the client.
+*
+* \param    node
+*           reference to the node; NULL disables the queue
+*
+* \retval   >=0    number of SDO clients used by the queue
+* \retval   <0     queue disabled
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COCSdoQueueInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SUBMIT SDO REQUEST
+*
+* \details  This function appends a transfer request to the queue. The
+*           transfer is started immediately, when a client is free and no
+*           other transfer to the server is running. Requests, which are
+*           submitted within a callback, are started with the next timer
+*           tick.
+*
+* \param    req
+*           pointer to the request memory
+*
+* \param    type
+*           transfer type (CO_CSDO_REQ_UPLOAD, .._DOWNLOAD, .._BLK_UPLOAD or
+*           .._BLK_DOWNLOAD)
+*
+* \param    nodeId
+*           node-id of the SDO server (1..127)
+*
+* \param    key
+*           object entry key (CO_DEV(index, subindex)) in the server
+*
+* \param    buf
+*           pointer to the data buffer
+*
+* \param    size
+*           data size (download) or buffer size (upload) in bytes
+*
+* \param    func
+*           completion callback, or NULL
+*
+* \param    timeout
+*           response timeout in ms
+*
+* \retval   =CO_ERR_NONE       request queued or started
+* \retval   =CO_ERR_BAD_ARG    bad argument or request already submitted
+* \retval   =CO_ERR_SDO_OFF    queue disabled
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR COCSdoQueueSubmit(CO_CSDO_REQ *req,
+                         uint8_t type,
+                         uint8_t nodeId,
+                         uint32_t key,
+                         uint8_t *buf,
+                         uint32_t size,
+                         CO_CSDO_REQ_FUNC func,
+                         uint32_t timeout);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CANCEL QUEUED SDO REQUEST
+*
+* \details  This function removes a request, which waits for a client,
+*           from the queue. The callback is not called. Running transfers
+*           can't be cancelled.
+*
+* \param    req
+*           pointer to the request
+*
+* \retval   =0    request removed
+* \retval   <0    request is not waiting in the queue
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COCSdoQueueCancel(CO_CSDO_REQ *req);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SDO CLIENT QUEUE STATISTICS
+*
+* \details  This function returns the counters of the SDO client queue.
+*
+* \return   reference to the statistics
+*/
+/*---------------------------------------------------------------------------*/
+const CO_CSDO_QUEUE_STAT *COCSdoQueueStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,474 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_mpdo.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#if (CO_MPDO_SLOTS < 2u) || ((CO_MPDO_SLOTS & (CO_MPDO_SLOTS - 1u)) != 0u)
+#error "CO_MPDO_SLOTS must be a power of two"
+#endif
+
+/* COB-ID flag: MPDO direction not used */
+#define CO_MPDO_OFF            0x80000000uL
+
+/* dispatch key of sender node-id (0 for DAM), index and subindex */
+#define CO_MPDO_KEY(src,idx,sub)                                           \
+    (((uint32_t)(src) << 24) | ((uint32_t)(idx) << 8) | (uint32_t)(sub))
+
+/* multiplicative hash (golden ratio) of dispatch key */
+#define CO_MPDO_HASH(key)                                                  \
+    ((uint32_t)((uint32_t)(key) * 0x9E3779B1uL) >> MPdoShift)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* dispatch table slot (Key = 0: free) */
+typedef struct CO_MPDO_SLOT_T {
+    uint32_t  Key;
+    CO_OBJ   *Obj;
+    uint8_t   Size;
+} CO_MPDO_SLOT;
+
+/* scanner table entry */
+typedef struct CO_MPDO_SCAN_T {
+    CO_OBJ   *Obj;
+    uint8_t   Size;
+} CO_MPDO_SCAN;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled MPDOs and the used COB-IDs */
+static CO_NODE  *MPdoNode = 0;
+static uint32_t  MPdoRxId = CO_MPDO_OFF;
+static uint32_t  MPdoTxId = CO_MPDO_OFF;
+
+/* dispatch table of the consumer */
+static CO_MPDO_SLOT MPdoSlot[CO_MPDO_SLOTS];
+static uint8_t      MPdoShift    = 32;
+static uint8_t      MPdoMaxProbe = 0;
+
+/* scanner table of the producer */
+static CO_MPDO_SCAN MPdoScan[CO_MPDO_SCAN_N];
+static uint16_t     MPdoScanNum = 0;
+
+/* MPDO counters */
+static CO_MPDO_STAT MPdoStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SIZE OF MAPPABLE OBJECT
+*
+* \details  Returns the size of the object entry, when the value fits into
+*           the 4 data bytes of a MPDO; otherwise 0.
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t COMPdoSize(CO_OBJ *obj)
+{
+    uint32_t size;
+
+    if ((obj == 0) || (CO_IS_PDOMAP(obj->Key) == 0)) {
+        return (0);
+    }
+    size = COObjGetSize(obj, MPdoNode, 0);
+    if ((size == 0) || (size > 4u)) {
+        return (0);
+    }
+    return ((uint8_t)size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ADD DISPATCH ENTRY
+*
+* \details  Inserts the key with linear probing. An existing key is
+*           replaced. One slot is always kept free to terminate lookups.
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COMPdoAdd(uint32_t key, CO_OBJ *obj, uint8_t size, uint16_t *used)
+{
+    uint32_t hash  = CO_MPDO_HASH(key);
+    uint8_t  probe = 1;
+
+    while ((MPdoSlot[hash].Key != 0) && (MPdoSlot[hash].Key != key)) {
+        hash = (hash + 1u) & (CO_MPDO_SLOTS - 1u);
+        if (probe < 0xFFu) {
+            probe++;
+        }
+    }
+    if (MPdoSlot[hash].Key == 0) {
+        if ((uint32_t)(*used + 1u) >= CO_MPDO_SLOTS) {
+            return (-1);
+        }
+        (*used)++;
+    }
+    MPdoSlot[hash].Key  = key;
+    MPdoSlot[hash].Obj  = obj;
+    MPdoSlot[hash].Size = size;
+    if (probe > MPdoMaxProbe) {
+        MPdoMaxProbe = probe;
+    }
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  LOOKUP DISPATCH ENTRY
+*
+* \details  Returns the slot with the given key; at most MaxProbe slots are
+*           compared.
+*/
+/*---------------------------------------------------------------------------*/
+static CO_MPDO_SLOT *COMPdoSlot(uint32_t key)
+{
+    uint32_t hash  = CO_MPDO_HASH(key);
+    uint8_t  probe = MPdoMaxProbe;
+
+    while (probe > 0) {
+        if (MPdoSlot[hash].Key == key) {
+            return (&MPdoSlot[hash]);
+        }
+        if (MPdoSlot[hash].Key == 0) {
+            break;
+        }
+        hash = (hash + 1u) & (CO_MPDO_SLOTS - 1u);
+        probe--;
+    }
+    return ((CO_MPDO_SLOT *)0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ADD OBJECT DISPATCHING LISTS
+*
+* \details  Each entry (UNSIGNED64) holds the block size (bit 56-63), the
+*           local index (bit 40-55) and subindex (bit 32-39), the sender
+*           index (bit 16-31) and subindex (bit 8-15) and the sender
+*           node-id (bit 0-7).
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COMPdoAddDispatch(uint16_t *used)
+{
+    CO_DICT  *cod = &MPdoNode->Dict;
+    CO_OBJ   *obj;
+    CO_OBJ   *loc;
+    uint64_t  entry;
+    uint16_t  list;
+    uint8_t   num;
+    uint8_t   sub;
+    uint8_t   blk;
+    uint8_t   n;
+    uint8_t   size;
+
+    for (list = 0; list < CO_MPDO_DISP_NUM; list++) {
+        if (CODictRdByte(cod, CO_DEV(CO_MPDO_DISP_IDX + list, 0), &num) != CO_ERR_NONE) {
+            continue;
+        }
+        for (sub = 1; (sub <= num) && (sub < 0xFFu); sub++) {
+            obj = CODictFind(cod, CO_DEV(CO_MPDO_DISP_IDX + list, sub));
+            if ((obj == 0) ||
+                (COObjRdValue(obj, MPdoNode, &entry, sizeof(entry)) != CO_ERR_NONE)) {
+                continue;
+            }
+            blk = (uint8_t)(entry >> 56);
+            if (blk == 0) {
+                blk = 1;
+            }
+            for (n = 0; n < blk; n++) {
+                loc  = CODictFind(cod, CO_DEV((uint16_t)(entry >> 40),
+                                              (uint8_t)(entry >> 32) + n));
+                size = COMPdoSize(loc);
+                if (size == 0) {
+                    continue;
+                }
+                if (COMPdoAdd(CO_MPDO_KEY((uint8_t)entry & 0x7Fu,
+                                          (uint16_t)(entry >> 16),
+                                          (uint8_t)((uint8_t)(entry >> 8) + n)),
+                              loc, size, used) < 0) {
+                    return (-1);
+                }
+            }
+        }
+    }
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BUILD SCANNER TABLE
+*
+* \details  Each entry (UNSIGNED32) of the object scanner lists holds the
+*           block size (bit 24-31), the index (bit 8-23) and the subindex
+*           (bit 0-7) of the objects to send.
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COMPdoAddScan(void)
+{
+    CO_DICT  *cod = &MPdoNode->Dict;
+    CO_OBJ   *obj;
+    uint32_t  entry;
+    uint16_t  list;
+    uint8_t   num;
+    uint8_t   sub;
+    uint8_t   blk;
+    uint8_t   n;
+    uint8_t   size;
+
+    MPdoScanNum = 0;
+    for (list = 0; list < CO_MPDO_SCAN_NUM; list++) {
+        if (CODictRdByte(cod, CO_DEV(CO_MPDO_SCAN_IDX + list, 0), &num) != CO_ERR_NONE) {
+            continue;
+        }
+        for (sub = 1; (sub <= num) && (sub < 0xFFu); sub++) {
+            if (CODictRdLong(cod, CO_DEV(CO_MPDO_SCAN_IDX + list, sub), &entry) != CO_ERR_NONE) {
+                continue;
+            }
+            blk = (uint8_t)(entry >> 24);
+            if (blk == 0) {
+                blk = 1;
+            }
+            for (n = 0; n < blk; n++) {
+                obj  = CODictFind(cod, CO_DEV((uint16_t)(entry >> 8),
+                                              (uint8_t)entry + n));
+                size = COMPdoSize(obj);
+                if (size == 0) {
+                    continue;
+                }
+                if (MPdoScanNum >= CO_MPDO_SCAN_N) {
+                    return (-1);
+                }
+                MPdoScan[MPdoScanNum].Obj  = obj;
+                MPdoScan[MPdoScanNum].Size = size;
+                MPdoScanNum++;
+            }
+        }
+    }
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND MPDO
+*
+* \details  Builds and sends the MPDO with the address byte and the value
+*           of the object entry.
+*/
+/*---------------------------------------------------------------------------*/
+static CO_ERR COMPdoSend(uint8_t addr, CO_OBJ *obj, uint8_t size)
+{
+    CO_IF_FRM frm;
+    uint32_t  val = 0;
+
+    if (COObjRdValue(obj, MPdoNode, &val, size) != CO_ERR_NONE) {
+        return (CO_ERR_TPDO_MAP_OBJ);
+    }
+    CO_SET_ID  (&frm, MPdoTxId);
+    CO_SET_DLC (&frm, 8);
+    CO_SET_BYTE(&frm, addr, 0);
+    CO_SET_WORD(&frm, CO_GET_IDX(obj->Key), 1);
+    CO_SET_BYTE(&frm, CO_GET_SUB(obj->Key), 3);
+    CO_SET_LONG(&frm, val, 4);                  /* value in low bytes (LE) */
+    (void)COIfCanSend(&MPdoNode->If, &frm);
+    MPdoStat.Tx++;
+
+    return (CO_ERR_NONE);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COMPdoInit(CO_NODE *node, uint32_t rxid, uint32_t txid)
+{
+    MPdoStat.Rx   = 0;
+    MPdoStat.Tx   = 0;
+    MPdoStat.Miss = 0;
+    MPdoRxId      = rxid;
+    MPdoTxId      = txid;
+    MPdoNode      = node;
+
+    return (COMPdoBuild());
+}
+
+/*
+* see function definition
+*/
+int16_t COMPdoBuild(void)
+{
+    CO_OBJ   *obj;
+    uint32_t  pos;
+    uint32_t  size = CO_MPDO_SLOTS;
+    uint16_t  used = 0;
+    uint8_t   bits = 0;
+    uint8_t   width;
+
+    for (pos = 0; pos < CO_MPDO_SLOTS; pos++) {
+        MPdoSlot[pos].Key = 0;
+    }
+    MPdoMaxProbe = 0;
+    MPdoScanNum  = 0;
+    if (MPdoNode == 0) {
+        return (-1);
+    }
+    while (size > 1u) {
+        size >>= 1;
+        bits++;
+    }
+    MPdoShift = (uint8_t)(32u - bits);
+
+    if ((MPdoRxId & CO_MPDO_OFF) == 0) {
+        obj = MPdoNode->Dict.Root;             /* destination address mode */
+        for (pos = 0; pos < MPdoNode->Dict.Num; pos++, obj++) {
+            if (CO_IS_WRITE(obj->Key) == 0) {
+                continue;
+            }
+            width = COMPdoSize(obj);
+            if (width == 0) {
+                continue;
+            }
+            if (COMPdoAdd(CO_MPDO_KEY(0, CO_GET_IDX(obj->Key), CO_GET_SUB(obj->Key)),
+                          obj, width, &used) < 0) {
+                return (-1);
+            }
+        }
+        if (COMPdoAddDispatch(&used) < 0) {    /* source address mode */
+            return (-1);
+        }
+    }
+    if ((MPdoTxId & CO_MPDO_OFF) == 0) {
+        if (COMPdoAddScan() < 0) {
+            return (-1);
+        }
+    }
+    return ((int16_t)used);
+}
+
+/*
+* see function definition
+*/
+CO_OBJ *COMPdoFind(uint8_t src, uint16_t idx, uint8_t sub)
+{
+    CO_MPDO_SLOT *slot;
+
+    slot = COMPdoSlot(CO_MPDO_KEY(src, idx, sub));
+    if (slot == 0) {
+        return ((CO_OBJ *)0);
+    }
+    return (slot->Obj);
+}
+
+/*
+* see function definition
+*/
+int16_t COMPdoReceive(CO_IF_FRM *frm)
+{
+    CO_MPDO_SLOT *slot;
+    uint32_t      val;
+    uint8_t       addr;
+
+    if ((MPdoNode == 0) || ((MPdoRxId & CO_MPDO_OFF) != 0) ||
+        (CO_GET_ID(frm) != MPdoRxId) || (CO_GET_DLC(frm) != 8)) {
+        return (0);
+    }
+    if (CONmtGetMode(&MPdoNode->Nmt) != CO_OPERATIONAL) {
+        return (0);
+    }
+    addr = CO_GET_BYTE(frm, 0);
+    if ((addr & CO_MPDO_DAM) != 0) {
+        addr &= 0x7Fu;
+        if ((addr != 0) && (addr != MPdoNode->NodeId)) {
+            return (0);                     /* MPDO for another node */
+        }
+        addr = 0;
+    }
+    slot = COMPdoSlot(CO_MPDO_KEY(addr, CO_GET_WORD(frm, 1), CO_GET_BYTE(frm, 3)));
+    if (slot == 0) {
+        MPdoStat.Miss++;
+        return (0);
+    }
+    val = CO_GET_LONG(frm, 4);                  /* value in low bytes (LE) */
+    (void)COObjWrValue(slot->Obj, MPdoNode, &val, slot->Size);
+    MPdoStat.Rx++;
+
+    return (1);
+}
+
+/*
+* see function definition
+*/
+int16_t COMPdoIfReceive(CO_IF *cif, CO_IF_FRM *frm)
+{
+    if ((MPdoNode == 0) || (cif != &MPdoNode->If)) {
+        return (0);
+    }
+    return (COMPdoReceive(frm));
+}
+
+/*
+* see function definition
+*/
+CO_ERR COMPdoDamSend(CO_OBJ *obj, uint8_t dest)
+{
+    uint8_t size;
+
+    if ((MPdoNode == 0) || ((MPdoTxId & CO_MPDO_OFF) != 0) ||
+        (CONmtGetMode(&MPdoNode->Nmt) != CO_OPERATIONAL)) {
+        return (CO_ERR_TPDO_COM_OFF);
+    }
+    size = COMPdoSize(obj);
+    if ((size == 0) || (dest > 0x7Fu)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    return (COMPdoSend((uint8_t)(CO_MPDO_DAM | dest), obj, size));
+}
+
+/*
+* see function definition
+*/
+int16_t COMPdoSamSend(void)
+{
+    int16_t  sent = 0;
+    uint16_t n;
+
+    if ((MPdoNode == 0) || ((MPdoTxId & CO_MPDO_OFF) != 0) ||
+        (CONmtGetMode(&MPdoNode->Nmt) != CO_OPERATIONAL)) {
+        return (-1);
+    }
+    for (n = 0; n < MPdoScanNum; n++) {
+        if (COMPdoSend(MPdoNode->NodeId & 0x7Fu, MPdoScan[n].Obj, MPdoScan[n].Size) == CO_ERR_NONE) {
+            sent++;
+        }
+    }
+    return (sent);
+}
+
+/*
+* see function definition
+*/
+const CO_MPDO_STAT *COMPdoStat(void)
+{
+    return (&MPdoStat);
+}
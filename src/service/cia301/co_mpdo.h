@@ -0,0 +1,211 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_MPDO_H_
+#define CO_MPDO_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#ifndef CO_MPDO_SLOTS
+#define CO_MPDO_SLOTS      512u    /*!< dispatch table slots (power of two) */
+#endif
+
+#ifndef CO_MPDO_SCAN_N
+#define CO_MPDO_SCAN_N      64u    /*!< objects in the scanner table        */
+#endif
+
+#define CO_MPDO_DAM        0x80u   /*!< destination address mode (byte 0)   */
+
+#define CO_MPDO_SCAN_IDX   0x1FA0u /*!< first object scanner list           */
+#define CO_MPDO_SCAN_NUM   48u     /*!< number of object scanner lists      */
+#define CO_MPDO_DISP_IDX   0x1FD0u /*!< first object dispatching list       */
+#define CO_MPDO_DISP_NUM   48u     /*!< number of object dispatching lists  */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief MPDO STATISTICS
+*
+*    Counters of the multiplexed PDOs since COMPdoInit().
+*/
+typedef struct CO_MPDO_STAT_T {
+    uint32_t Rx;               /*!< received and dispatched MPDOs           */
+    uint32_t Tx;               /*!< transmitted MPDOs                       */
+    uint32_t Miss;             /*!< received MPDOs without dispatch entry   */
+} CO_MPDO_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT MPDO PRODUCER AND CONSUMER
+*
+* \details  This function enables the multiplexed PDOs for the given node
+*           and builds the dispatch and scanner tables (see COMPdoBuild()).
+*           It must be called after CONodeInit(). The MPDOs use their own
+*           CAN identifiers, because the PDO mapping of the stack supports
+*           no mapping with 0xFE (SAM) or 0xFF (DAM) entries.
+*
+* \param    node
+*           reference to the node; NULL disables the MPDOs
+*
+* \param    rxid
+*           COB-ID of received MPDOs (bit 31 set: no consumer)
+*
+* \param    txid
+*           COB-ID of transmitted MPDOs (bit 31 set: no producer)
+*
+* \retval   >=0    number of dispatch table entries
+* \retval   <0     tables not usable (see COMPdoBuild())
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COMPdoInit(CO_NODE *node, uint32_t rxid, uint32_t txid);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BUILD MPDO TABLES
+*
+* \details  This function builds the dispatch table of the consumer and the
+*           scanner table of the producer from the object dictionary:
+*           - destination address mode: all writable, PDO mappable object
+*             entries with up to 4 bytes
+*           - source address mode: the object dispatching lists
+*             (1FD0h..1FFFh)
+*           - producer: the object scanner lists (1FA0h..1FCFh)
+*
+*           Call this function again after changing one of these lists.
+*
+* \retval   >=0    number of dispatch table entries
+* \retval   <0     MPDOs disabled or too many entries for CO_MPDO_SLOTS
+*                  or CO_MPDO_SCAN_N
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COMPdoBuild(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FIND MPDO DISPATCH ENTRY
+*
+* \details  This function looks up the local object entry for a received
+*           MPDO in the dispatch table.
+*
+* \param    src
+*           sender node-id (source address mode) or 0 (destination
+*           address mode)
+*
+* \param    idx
+*           index in the MPDO
+*
+* \param    sub
+*           subindex in the MPDO
+*
+* \retval   >0    local object entry
+* \retval   =0    no dispatch entry
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ *COMPdoFind(uint8_t src, uint16_t idx, uint8_t sub);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE MPDO
+*
+* \details  This function writes the value of a received MPDO into the
+*           local object entry. Frames with other identifiers are ignored.
+*
+* \param    frm
+*           received CAN frame
+*
+* \retval   =1    MPDO is dispatched
+* \retval   =0    no MPDO for this node or no dispatch entry
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COMPdoReceive(CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE FRAME OF CAN INTERFACE
+*
+* \details  This function passes a frame, which is read from the CAN
+*           interface of the MPDO node, to COMPdoReceive(). Frames of other
+*           interfaces are ignored. With CO_MPDO_WRAP, the function is called
+*           by the wrapped stack function COIfCanRead().
+*
+* \param    cif
+*           CAN interface, which received the frame
+*
+* \param    frm
+*           received CAN frame
+*
+* \retval   =1    MPDO is dispatched
+* \retval   =0    frame is left to the stack
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COMPdoIfReceive(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND MPDO IN DESTINATION ADDRESS MODE
+*
+* \details  This function sends the value of the given object entry to the
+*           same index and subindex in the object dictionary of the
+*           destination node.
+*
+* \param    obj
+*           object entry with up to 4 bytes
+*
+* \param    dest
+*           destination node-id; 0 for all nodes
+*
+* \retval   =CO_ERR_NONE    MPDO is sent
+* \retval   !=CO_ERR_NONE   producer disabled, not operational or bad object
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR COMPdoDamSend(CO_OBJ *obj, uint8_t dest);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND MPDOS IN SOURCE ADDRESS MODE
+*
+* \details  This function sends one MPDO for each object entry in the
+*           object scanner lists.
+*
+* \retval   >=0    number of sent MPDOs
+* \retval   <0     producer disabled or not operational
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COMPdoSamSend(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET MPDO STATISTICS
+*
+* \retval   reference to the MPDO counters
+*/
+/*---------------------------------------------------------------------------*/
+const CO_MPDO_STAT *COMPdoStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
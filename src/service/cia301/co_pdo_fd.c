@@ -0,0 +1,261 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_pdo_fd.h"
+#include "co_pdo_plan.h"
+#include "co_obj_fast.h"
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "FD PDOs copy object memory as CANopen (little endian) byte order"
+#endif
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* COB-ID flag: PDO not valid */
+#define CO_PDO_FD_OFF          0x80000000uL
+
+/* COB-ID bits of the CAN identifier */
+#define CO_PDO_FD_ID_MASK      0x1FFFFFFFuL
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* copy plan of a FD PDO (Id = CO_PDO_FD_OFF: not valid) */
+typedef struct CO_PDO_FD_PLAN_T {
+    CO_PDO_OP  Op[CO_PDO_FD_MAP_N];
+    uint32_t   Id;
+    uint8_t    OpNum;
+    uint8_t    Size;
+} CO_PDO_FD_PLAN;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled FD PDOs */
+static CO_NODE *FdNode = 0;
+
+/* plans of the FD TPDOs and FD RPDOs */
+static CO_PDO_FD_PLAN FdTPdo[CO_PDO_FD_N];
+static CO_PDO_FD_PLAN FdRPdo[CO_PDO_FD_N];
+
+/* FD PDO counters */
+static CO_PDO_FD_STAT FdStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  COMPILE FD PDO PLAN
+*
+* \details  Compiles the mapping record into copy operations; adjacent
+*           object memory is merged into a single operation. Objects, which
+*           trigger TPDOs on write, are not mapped into RPDOs, because the
+*           plan bypasses the type functions.
+*
+* \retval   =1    plan is valid
+* \retval   =0    PDO not valid or mapping not usable
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COPdoFdCompile(CO_PDO_FD_PLAN *plan, uint16_t com, uint16_t map, uint8_t rx)
+{
+    CO_DICT   *cod = &FdNode->Dict;
+    CO_OBJ    *obj;
+    CO_PDO_OP *op;
+    uint8_t   *ptr;
+    uint32_t   id;
+    uint32_t   entry;
+    uint8_t    num;
+    uint8_t    width;
+    uint8_t    n;
+
+    plan->Id    = CO_PDO_FD_OFF;
+    plan->OpNum = 0;
+    plan->Size  = 0;
+    if ((CODictRdLong(cod, CO_DEV(com, 1), &id) != CO_ERR_NONE) ||
+        ((id & CO_PDO_FD_OFF) != 0)) {
+        return (0);
+    }
+    if ((CODictRdByte(cod, CO_DEV(map, 0), &num) != CO_ERR_NONE) ||
+        (num > CO_PDO_FD_MAP_N)) {
+        return (0);
+    }
+
+    for (n = 1; n <= num; n++) {
+        if (CODictRdLong(cod, CO_DEV(map, n), &entry) != CO_ERR_NONE) {
+            return (0);
+        }
+        obj = CODictFind(cod, CO_DEV((uint16_t)(entry >> 16), (uint8_t)(entry >> 8)));
+        if (obj == 0) {
+            return (0);
+        }
+        width = COObjBasicWidth(obj);
+        if ((width == 0) ||                           /* no basic type      */
+            (((uint32_t)width * 8u) != (entry & 0xFFu)) ||
+            (CO_IS_NODEID(obj->Key) != 0) ||          /* value is modified  */
+            ((rx != 0) && (CO_IS_ASYNC(obj->Key) != 0)) ||
+            ((plan->Size + width) > CO_IF_FD_DLEN)) {
+            return (0);
+        }
+        if (CO_IS_DIRECT(obj->Key) != 0) {
+            if (width > sizeof(CO_DATA)) {            /* no direct storage  */
+                return (0);
+            }
+            ptr = (uint8_t *)&obj->Data;
+        } else {
+            ptr = (uint8_t *)obj->Data;
+        }
+
+        op = (plan->OpNum > 0) ? &plan->Op[plan->OpNum - 1] : (CO_PDO_OP *)0;
+        if ((op != 0) && ((op->Ptr + op->Width) == ptr)) {
+            op->Width += width;                       /* adjacent memory    */
+        } else {
+            op        = &plan->Op[plan->OpNum];
+            op->Ptr   = ptr;
+            op->Pos   = plan->Size;
+            op->Width = width;
+            plan->OpNum++;
+        }
+        plan->Size += width;
+    }
+    plan->Id = id & CO_PDO_FD_ID_MASK;
+    return (1);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COPdoFdInit(CO_NODE *node)
+{
+    FdStat.Rx    = 0;
+    FdStat.Tx    = 0;
+    FdStat.Short = 0;
+    FdNode       = node;
+
+    return (COPdoFdBuild());
+}
+
+/*
+* see function definition
+*/
+int16_t COPdoFdBuild(void)
+{
+    int16_t  used = 0;
+    uint16_t n;
+
+    for (n = 0; n < CO_PDO_FD_N; n++) {
+        FdTPdo[n].Id = CO_PDO_FD_OFF;
+        FdRPdo[n].Id = CO_PDO_FD_OFF;
+    }
+    if (FdNode == 0) {
+        return (-1);
+    }
+    for (n = 0; n < CO_PDO_FD_N; n++) {
+        used += COPdoFdCompile(&FdTPdo[n], CO_PDO_FD_TCOM + n, CO_PDO_FD_TMAP + n, 0);
+        used += COPdoFdCompile(&FdRPdo[n], CO_PDO_FD_RCOM + n, CO_PDO_FD_RMAP + n, 1);
+    }
+    return (used);
+}
+
+/*
+* see function definition
+*/
+CO_ERR COPdoFdTx(uint8_t num)
+{
+    CO_PDO_FD_PLAN *plan;
+    CO_PDO_OP      *op;
+    CO_IF_FD_FRM    frm;
+    uint8_t         n;
+
+    if ((FdNode == 0) || (num >= CO_PDO_FD_N)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    plan = &FdTPdo[num];
+    if (((plan->Id & CO_PDO_FD_OFF) != 0) ||
+        (CONmtGetMode(&FdNode->Nmt) != CO_OPERATIONAL)) {
+        return (CO_ERR_TPDO_COM_OFF);
+    }
+    frm.Identifier = plan->Id;
+    frm.DLC        = plan->Size;
+    frm.Flags      = CO_IF_FD_FDF | CO_IF_FD_BRS;
+    for (n = 0; n < plan->OpNum; n++) {
+        op = &plan->Op[n];
+        memcpy(&frm.Data[op->Pos], op->Ptr, op->Width);
+    }
+    if (COIfFdSend(&frm) <= 0) {
+        return (CO_ERR_IF_CAN_SEND);
+    }
+    FdStat.Tx++;
+
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COPdoFdReceive(CO_IF_FD_FRM *frm)
+{
+    CO_PDO_FD_PLAN *plan = 0;
+    CO_PDO_OP      *op;
+    uint8_t         n;
+
+    if ((FdNode == 0) || (frm == 0) ||
+        (CONmtGetMode(&FdNode->Nmt) != CO_OPERATIONAL)) {
+        return (0);
+    }
+    for (n = 0; n < CO_PDO_FD_N; n++) {
+        if (FdRPdo[n].Id == frm->Identifier) {
+            plan = &FdRPdo[n];
+            break;
+        }
+    }
+    if (plan == 0) {
+        return (0);
+    }
+    if (frm->DLC < plan->Size) {
+        FdStat.Short++;
+        return (0);
+    }
+    for (n = 0; n < plan->OpNum; n++) {
+        op = &plan->Op[n];
+        memcpy(op->Ptr, &frm->Data[op->Pos], op->Width);
+    }
+    FdStat.Rx++;
+
+    return (1);
+}
+
+/*
+* see function definition
+*/
+const CO_PDO_FD_STAT *COPdoFdStat(void)
+{
+    return (&FdStat);
+}
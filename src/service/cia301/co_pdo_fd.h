@@ -0,0 +1,148 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PDO_FD_H_
+#define CO_PDO_FD_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "co_if_fd.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#ifndef CO_PDO_FD_N
+#define CO_PDO_FD_N          4u    /*!< number of FD TPDOs and FD RPDOs     */
+#endif
+
+#define CO_PDO_FD_MAP_N     64u    /*!< mapped objects per FD PDO           */
+
+#define CO_PDO_FD_RCOM   0x5400u   /*!< first FD RPDO communication record  */
+#define CO_PDO_FD_RMAP   0x5600u   /*!< first FD RPDO mapping record        */
+#define CO_PDO_FD_TCOM   0x5800u   /*!< first FD TPDO communication record  */
+#define CO_PDO_FD_TMAP   0x5A00u   /*!< first FD TPDO mapping record        */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief FD PDO STATISTICS
+*
+*    Counters of the FD PDOs since COPdoFdInit().
+*/
+typedef struct CO_PDO_FD_STAT_T {
+    uint32_t Rx;               /*!< received and written FD RPDOs           */
+    uint32_t Tx;               /*!< transmitted FD TPDOs                    */
+    uint32_t Short;            /*!< FD RPDOs shorter than the mapping       */
+} CO_PDO_FD_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT FD PDOS
+*
+* \details  This function enables the FD PDOs for the given node and builds
+*           the copy plans (see COPdoFdBuild()). It must be called after
+*           CONodeInit(). Pass COPdoFdReceive() as receive function to
+*           COIfFdInit().
+*
+* \param    node
+*           reference to the node; NULL disables the FD PDOs
+*
+* \retval   >=0    number of usable FD PDOs
+* \retval   <0     FD PDOs disabled
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COPdoFdInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BUILD FD PDO PLANS
+*
+* \details  This function compiles the FD PDO records into copy plans. The
+*           records follow the PDO records of CiA 1301 with up to
+*           CO_PDO_FD_MAP_N mapping entries and 64 data bytes:
+*           - communication: subindex 1 holds the COB-ID (bit 31 set: PDO
+*             not valid)
+*           - mapping: subindex 0 holds the number of entries, subindex
+*             1..64 the mapped objects (index, subindex, length in bits)
+*
+*           The records are placed at CO_PDO_FD_RCOM/RMAP (RPDOs) and
+*           CO_PDO_FD_TCOM/TMAP (TPDOs), because the stack handles the
+*           standard PDO records with up to 8 mapping entries only. Mapped
+*           objects must have a basic type without the node-id flag.
+*           Call this function again after changing one of these records.
+*
+* \retval   >=0    number of usable FD PDOs
+* \retval   <0     FD PDOs disabled
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COPdoFdBuild(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND FD TPDO
+*
+* \details  This function packs the mapped values into a CAN FD frame and
+*           sends it with COIfFdSend(). The bit rate switch is requested.
+*
+* \param    num
+*           FD TPDO number (0..CO_PDO_FD_N-1)
+*
+* \retval   =CO_ERR_NONE    FD TPDO is sent
+* \retval   !=CO_ERR_NONE   FD TPDO not valid, not operational or the
+*                           frame is not sent
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR COPdoFdTx(uint8_t num);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE FD RPDO
+*
+* \details  This function writes the data of a received CAN FD frame into
+*           the mapped objects of the FD RPDO with the same COB-ID.
+*
+* \param    frm
+*           received CAN FD frame
+*
+* \retval   =1    FD RPDO is written
+* \retval   =0    no FD RPDO for this frame, not operational or the frame
+*                 is shorter than the mapping
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COPdoFdReceive(CO_IF_FD_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET FD PDO STATISTICS
+*
+* \retval   reference to the FD PDO counters
+*/
+/*---------------------------------------------------------------------------*/
+const CO_PDO_FD_STAT *COPdoFdStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
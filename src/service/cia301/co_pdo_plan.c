@@ -0,0 +1,392 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_pdo_plan.h"
+#include "co_obj_fast.h"
+#include "co_dispatch.h"
+
+#if CO_TPDO_DIRTY_WRAP
+#include "co_tpdo_dirty.h"
+#endif
+#if CO_PDO_SCHED_WRAP
+#include "co_pdo_sched.h"
+#endif
+#if CO_RPDO_MON_WRAP
+#include "co_rpdo_mon.h"
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "PDO plans copy object memory as CANopen (little endian) byte order"
+#endif
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_PDO_PLAN_COBID_OFF   0x80000000uL   /* PDO does not exist / invalid */
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/*! \brief RPDO PLAN
+*
+*    The RPDO plan needs the transmission type object to detect
+*    synchronous RPDOs, which are buffered by the stack.
+*/
+typedef struct CO_RPDO_PLAN_T {
+    CO_PDO_PLAN  Plan;         /* copy operations                           */
+    CO_OBJ      *Type;         /* transmission type object (140x:2)         */
+} CO_RPDO_PLAN;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled PDO plans */
+static CO_NODE *PlanNode = 0;
+
+/* plans for all TPDOs of the node */
+static CO_PDO_PLAN TPdoPlan[CO_TPDO_N];
+
+/* plans for all RPDOs of the node */
+static CO_RPDO_PLAN RPdoPlan[CO_RPDO_N];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  UPDATE PDO PLAN
+*
+* \details  Compile the plan, when it is not compiled yet or the object list
+*           of the PDO differs from the compiled object list.
+*
+* \retval   >0    valid plan
+* \retval   =0    PDO needs the stack functions
+*/
+/*---------------------------------------------------------------------------*/
+static CO_PDO_PLAN *COPdoPlanUpdate(CO_PDO_PLAN *plan, CO_OBJ **map, uint8_t num)
+{
+    if ((plan->State == CO_PDO_PLAN_NONE) ||
+        (plan->ObjNum != num) ||
+        (memcmp(&plan->Map[0], map, (uint32_t)num * sizeof(CO_OBJ *)) != 0)) {
+        (void)COPdoPlanCompile(plan, map, num);
+    }
+    return ((plan->State == CO_PDO_PLAN_VALID) ? plan : (CO_PDO_PLAN *)0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COPdoPlanInit(CO_NODE *node)
+{
+    uint32_t n;
+
+    for (n = 0; n < CO_TPDO_N; n++) {
+        TPdoPlan[n].State = CO_PDO_PLAN_NONE;
+    }
+    for (n = 0; n < CO_RPDO_N; n++) {
+        RPdoPlan[n].Plan.State = CO_PDO_PLAN_NONE;
+        RPdoPlan[n].Type       = 0;
+    }
+    PlanNode = node;
+}
+
+/*
+* see function definition
+*/
+uint8_t COPdoPlanCompile(CO_PDO_PLAN *plan, CO_OBJ **map, uint8_t num)
+{
+    CO_OBJ    *obj;
+    CO_PDO_OP *op;
+    uint8_t   *ptr;
+    uint8_t    width;
+    uint8_t    n;
+
+    plan->State  = CO_PDO_PLAN_STACK;
+    plan->OpNum  = 0;
+    plan->Size   = 0;
+    plan->ObjNum = num;
+    if ((num == 0) || (num > 8)) {
+        return (plan->State);
+    }
+    for (n = 0; n < num; n++) {
+        plan->Map[n] = map[n];
+    }
+
+    for (n = 0; n < num; n++) {
+        obj = map[n];
+        if (obj == 0) {
+            return (plan->State);
+        }
+        width = COObjBasicWidth(obj);
+        if ((width == 0) ||                           /* no basic type      */
+            (CO_IS_NODEID(obj->Key) != 0) ||          /* value is modified  */
+            (CO_IS_ASYNC(obj->Key)  != 0) ||          /* write triggers PDO */
+            ((plan->Size + width) > 8)) {
+            return (plan->State);
+        }
+        if (CO_IS_DIRECT(obj->Key) != 0) {
+            if (width > sizeof(CO_DATA)) {            /* no direct storage  */
+                return (plan->State);
+            }
+            ptr = (uint8_t *)&obj->Data;
+        } else {
+            ptr = (uint8_t *)obj->Data;
+        }
+
+        op = (plan->OpNum > 0) ? &plan->Op[plan->OpNum - 1] : (CO_PDO_OP *)0;
+        if ((op != 0) && ((op->Ptr + op->Width) == ptr)) {
+            op->Width += width;                       /* adjacent memory    */
+        } else {
+            op        = &plan->Op[plan->OpNum];
+            op->Ptr   = ptr;
+            op->Pos   = plan->Size;
+            op->Width = width;
+            plan->OpNum++;
+        }
+        plan->Size += width;
+    }
+    plan->State = CO_PDO_PLAN_VALID;
+
+    return (plan->State);
+}
+
+/*
+* see function definition
+*/
+void COPdoPlanPack(const CO_PDO_PLAN *plan, uint8_t *data)
+{
+    const CO_PDO_OP *op  = &plan->Op[0];
+    const CO_PDO_OP *end = &plan->Op[plan->OpNum];
+
+    while (op < end) {
+        switch (op->Width) {
+            case 1:  data[op->Pos] = *op->Ptr;                  break;
+            case 2:  memcpy(&data[op->Pos], op->Ptr, 2);        break;
+            case 4:  memcpy(&data[op->Pos], op->Ptr, 4);        break;
+            default: memcpy(&data[op->Pos], op->Ptr, op->Width); break;
+        }
+        op++;
+    }
+}
+
+/*
+* see function definition
+*/
+void COPdoPlanUnpack(const CO_PDO_PLAN *plan, const uint8_t *data)
+{
+    const CO_PDO_OP *op  = &plan->Op[0];
+    const CO_PDO_OP *end = &plan->Op[plan->OpNum];
+
+    while (op < end) {
+        switch (op->Width) {
+            case 1:  *op->Ptr = data[op->Pos];                  break;
+            case 2:  memcpy(op->Ptr, &data[op->Pos], 2);        break;
+            case 4:  memcpy(op->Ptr, &data[op->Pos], 4);        break;
+            default: memcpy(op->Ptr, &data[op->Pos], op->Width); break;
+        }
+        op++;
+    }
+}
+
+/*
+* see function definition
+*/
+CO_PDO_PLAN *COTPdoPlanGet(CO_TPDO *pdo)
+{
+    uint32_t n;
+
+    if ((PlanNode == 0) || (pdo == 0) || (pdo->Node != PlanNode)) {
+        return ((CO_PDO_PLAN *)0);
+    }
+    n = (uint32_t)(pdo - &PlanNode->TPdo[0]);
+    if (n >= CO_TPDO_N) {
+        return ((CO_PDO_PLAN *)0);
+    }
+    return (COPdoPlanUpdate(&TPdoPlan[n], &pdo->Map[0], pdo->ObjNum));
+}
+
+/*
+* see function definition
+*/
+CO_PDO_PLAN *CORPdoPlanGet(uint32_t id)
+{
+    CO_RPDO      *pdo;
+    CO_RPDO_PLAN *rp;
+    uint8_t       type;
+    uint16_t      inst;
+    uint32_t      n;
+    uint32_t      end = CO_RPDO_N;
+
+    if (PlanNode == 0) {
+        return ((CO_PDO_PLAN *)0);
+    }
+    switch (CODispatchFind(id, &inst)) {
+        case CO_DISPATCH_OFF:
+            n = 0;                               /* search all RPDOs        */
+            break;
+        case CO_DISPATCH_RPDO:
+            n   = inst;                          /* check the table entry   */
+            end = (uint32_t)inst + 1u;
+            break;
+        default:
+            return ((CO_PDO_PLAN *)0);
+    }
+    for (; n < end; n++) {
+        pdo = &PlanNode->RPdo[n];
+        if ((pdo->ObjNum == 0) || (pdo->Identifier != id)) {
+            continue;
+        }
+        rp = &RPdoPlan[n];
+        if (rp->Type == 0) {
+            rp->Type = CODictFind(&PlanNode->Dict, CO_DEV(0x1400 + n, 2));
+        }
+        if ((rp->Type == 0) ||
+            (COObjRdFast(rp->Type, PlanNode, &type, 1) == 0) ||
+            (type < 254)) {
+            return ((CO_PDO_PLAN *)0);                /* synchronous RPDO */
+        }
+        return (COPdoPlanUpdate(&rp->Plan, &pdo->Map[0], pdo->ObjNum));
+    }
+    return ((CO_PDO_PLAN *)0);
+}
+
+/*
+* see function definition
+*/
+void COTPdoRdWide(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
+{
+    if ((PlanNode == 0) || (obj == 0) || ((pos + size) > 8u)) {
+        return;
+    }
+    (void)COObjRdValue(obj, PlanNode, &frm->Data[pos], size);
+}
+
+/*
+* see function definition
+*/
+void CORPdoWrWide(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
+{
+    if ((PlanNode == 0) || (obj == 0) || ((pos + size) > 8u)) {
+        return;
+    }
+    (void)COObjWrValue(obj, PlanNode, &frm->Data[pos], size);
+}
+
+#if CO_PDO_PLAN_WRAP
+
+/******************************************************************************
+* LINKER WRAPPED STACK FUNCTIONS
+******************************************************************************/
+
+void    __real_COTPdoTx(CO_TPDO *pdo);
+int16_t __real_COPdoReceive(CO_IF_FRM *frm);
+
+void    __wrap_COTPdoTx(CO_TPDO *pdo);
+int16_t __wrap_COPdoReceive(CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  TRANSMIT TPDO (WRAPPED)
+*
+* \details  TPDOs without inhibit and event timer are packed with the plan
+*           and sent directly. All other TPDOs, and TPDOs with an invalid
+*           COB-ID, are passed to the stack function, which handles the
+*           timers and the checks. With the PDO scheduler, a TPDO within
+*           its inhibit time is deferred first.
+*/
+/*---------------------------------------------------------------------------*/
+void __wrap_COTPdoTx(CO_TPDO *pdo)
+{
+    CO_PDO_PLAN *plan;
+    CO_NODE     *node;
+    CO_IF_FRM    frm;
+
+#if CO_PDO_SCHED_WRAP
+    if (COPdoSchedTx(pdo) != 0) {
+        return;                          /* deferred to end of inhibit time */
+    }
+#endif
+    plan = COTPdoPlanGet(pdo);
+    if ((plan == 0) || (pdo->Inhibit != 0) || (pdo->Event != 0) ||
+        ((pdo->Identifier & CO_PDO_PLAN_COBID_OFF) != 0)) {
+        __real_COTPdoTx(pdo);
+        return;
+    }
+    node = pdo->Node;
+    if (CONmtGetMode(&node->Nmt) != CO_OPERATIONAL) {
+        return;
+    }
+
+    memset(&frm, 0, sizeof(frm));
+    CO_SET_ID (&frm, pdo->Identifier);
+    CO_SET_DLC(&frm, plan->Size);
+    COPdoPlanPack(plan, &frm.Data[0]);
+
+    COPdoTransmit(&frm);
+    (void)COIfCanSend(&node->If, &frm);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE PDO (WRAPPED)
+*
+* \details  The application callback is called first and may suppress the
+*           write as before. Asynchronous RPDOs with a valid plan are then
+*           unpacked with the plan and the write of the stack is suppressed.
+*           Short frames are passed to the stack for the error handling.
+*           With the RPDO monitor, each reception restarts the deadline of
+*           the RPDO first.
+*/
+/*---------------------------------------------------------------------------*/
+int16_t __wrap_COPdoReceive(CO_IF_FRM *frm)
+{
+    CO_PDO_PLAN *plan;
+#if CO_TPDO_DIRTY_WRAP
+    uint8_t      n;
+#endif
+
+#if CO_RPDO_MON_WRAP
+    CORPdoMonRx(CO_GET_ID(frm));
+#endif
+    if (__real_COPdoReceive(frm) != 0) {
+        return (1);
+    }
+    plan = CORPdoPlanGet(CO_GET_ID(frm));
+    if ((plan == 0) || (CO_GET_DLC(frm) < plan->Size)) {
+        return (0);
+    }
+    COPdoPlanUnpack(plan, &frm->Data[0]);
+#if CO_TPDO_DIRTY_WRAP
+    for (n = 0; n < plan->ObjNum; n++) {
+        COTPdoDirtyMark(PlanNode, plan->Map[n]);
+    }
+#endif
+
+    return (1);
+}
+
+#endif  /* #if CO_PDO_PLAN_WRAP */
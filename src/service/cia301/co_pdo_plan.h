@@ -0,0 +1,227 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PDO_PLAN_H_
+#define CO_PDO_PLAN_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_PDO_PLAN_NONE     0u    /*!< plan not compiled yet               */
+#define CO_PDO_PLAN_VALID    1u    /*!< plan is usable                      */
+#define CO_PDO_PLAN_STACK    2u    /*!< mapping needs the stack functions   */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief PDO PLAN OPERATION
+*
+*    One copy operation between the PDO frame and the object memory.
+*/
+typedef struct CO_PDO_OP_T {
+    uint8_t *Ptr;              /*!< object memory                           */
+    uint8_t  Pos;              /*!< byte position in PDO frame              */
+    uint8_t  Width;            /*!< number of bytes to copy                 */
+} CO_PDO_OP;
+
+/*! \brief PDO PLAN
+*
+*    This structure holds the flat list of copy operations for a PDO and
+*    the mapping, for which the plan is compiled.
+*/
+typedef struct CO_PDO_PLAN_T {
+    CO_OBJ    *Map[8];         /*!< compiled mapping (stack object list)    */
+    CO_PDO_OP  Op[8];          /*!< copy operations                         */
+    uint8_t    ObjNum;         /*!< number of mapped objects                */
+    uint8_t    OpNum;          /*!< number of copy operations               */
+    uint8_t    Size;           /*!< PDO payload size in bytes               */
+    uint8_t    State;          /*!< plan state (CO_PDO_PLAN_xxx)            */
+} CO_PDO_PLAN;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT PDO PLANS
+*
+* \details  This function enables the PDO plans for the given node. It must
+*           be called after CONodeInit(). All plans are compiled on their
+*           first use and whenever the PDO mapping changes.
+*
+*           With CO_PDO_PLAN_WRAP, the plans are used by the wrapped stack
+*           functions COTPdoTx() and COPdoReceive(), e.g. for synchronous
+*           TPDOs and all RPDOs. The linker does not redirect calls within
+*           the stack module co_tpdo.c, so TPDOs, which are sent by
+*           COTPdoTrigPdo(), COTPdoTrigObj() or the event timer of the
+*           stack, are packed by the stack. With CO_PDO_SCHED_WRAP these
+*           triggers and timers are taken over by the PDO scheduler and use
+*           the plans as well (see COPdoSchedTx()).
+*
+* \param    node
+*           reference to the node; NULL disables all plans
+*/
+/*---------------------------------------------------------------------------*/
+void COPdoPlanInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  COMPILE PDO PLAN
+*
+* \details  This function compiles the list of mapped objects into copy
+*           operations. Basic integer types with direct or referenced
+*           storage are supported; adjacent object memory is merged into a
+*           single operation. Empty mappings, mappings with other types,
+*           node-id dependent values or asynchronous TPDO triggers are
+*           marked to be handled by the stack (CO_PDO_PLAN_STACK).
+*
+* \param    plan
+*           reference to the PDO plan
+*
+* \param    map
+*           list of mapped objects
+*
+* \param    num
+*           number of mapped objects
+*
+* \return   new state of the plan
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t COPdoPlanCompile(CO_PDO_PLAN *plan, CO_OBJ **map, uint8_t num);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  PACK PDO FRAME
+*
+* \details  This function copies the object values into the PDO frame data
+*           with the compiled plan.
+*
+* \param    plan
+*           reference to the valid PDO plan
+*
+* \param    data
+*           PDO frame data (8 bytes)
+*/
+/*---------------------------------------------------------------------------*/
+void COPdoPlanPack(const CO_PDO_PLAN *plan, uint8_t *data);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  UNPACK PDO FRAME
+*
+* \details  This function copies the PDO frame data into the object values
+*           with the compiled plan.
+*
+* \param    plan
+*           reference to the valid PDO plan
+*
+* \param    data
+*           PDO frame data (8 bytes)
+*/
+/*---------------------------------------------------------------------------*/
+void COPdoPlanUnpack(const CO_PDO_PLAN *plan, const uint8_t *data);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET TPDO PLAN
+*
+* \details  This function returns the up-to-date plan of the given TPDO. The
+*           plan is recompiled, when the mapping of the TPDO is changed.
+*
+* \param    pdo
+*           reference to the TPDO
+*
+* \retval   >0    valid plan
+* \retval   =0    plans disabled or TPDO needs the stack functions
+*/
+/*---------------------------------------------------------------------------*/
+CO_PDO_PLAN *COTPdoPlanGet(CO_TPDO *pdo);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET RPDO PLAN
+*
+* \details  This function returns the up-to-date plan of the asynchronous
+*           RPDO with the given CAN identifier. Synchronous RPDOs are left
+*           to the stack, which buffers them until the next SYNC.
+*
+* \param    id
+*           CAN identifier of the received frame
+*
+* \retval   >0    valid plan
+* \retval   =0    plans disabled, no matching RPDO or RPDO needs the stack
+*/
+/*---------------------------------------------------------------------------*/
+CO_PDO_PLAN *CORPdoPlanGet(uint32_t id);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  READ WIDE VALUE INTO TPDO
+*
+* \details  This function copies a mapped value with 5..8 bytes from the
+*           object entry into the TPDO frame. It is the default of the
+*           stack callback COTpdoReadData() for TPDOs, which are not sent
+*           with a plan. The node of COPdoPlanInit() is used.
+*
+* \param    frm
+*           TPDO frame
+*
+* \param    pos
+*           byte position of the value in the frame
+*
+* \param    size
+*           mapped size in bytes
+*
+* \param    obj
+*           mapped object entry
+*/
+/*---------------------------------------------------------------------------*/
+void COTPdoRdWide(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  WRITE WIDE VALUE FROM RPDO
+*
+* \details  This function copies a mapped value with 5..8 bytes from the
+*           RPDO frame into the object entry. It is the default of the
+*           stack callback CORpdoWriteData() for RPDOs, which are not
+*           received with a plan. The node of COPdoPlanInit() is used.
+*
+* \param    frm
+*           RPDO frame
+*
+* \param    pos
+*           byte position of the value in the frame
+*
+* \param    size
+*           mapped size in bytes
+*
+* \param    obj
+*           mapped object entry
+*/
+/*---------------------------------------------------------------------------*/
+void CORPdoWrWide(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,478 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_pdo_sched.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* COB-ID bit of a disabled TPDO */
+#define CO_PDO_SCHED_COBID_OFF     0x80000000uL
+
+/* tick a is before tick b (wrap-around safe) */
+#define CO_PDO_SCHED_BEFORE(a,b)   ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* timing state of a TPDO (all times in scheduler ticks) */
+typedef struct CO_PDO_SCHED_PDO_T {
+    uint32_t Free;             /* end of the inhibit time                   */
+    uint32_t EvDue;            /* expiry of the event timer                 */
+    uint32_t Due;              /* deadline in the heap                      */
+    uint16_t Inhibit;          /* inhibit time                              */
+    uint16_t Event;            /* event time                                */
+    uint16_t Pos;              /* position in heap + 1 (0: not in heap)     */
+    uint8_t  Used;             /* timing by the scheduler                   */
+    uint8_t  Pending;          /* triggered within the inhibit time         */
+} CO_PDO_SCHED_PDO;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled scheduler, tick length in 100us and cyclic timer */
+static CO_NODE  *SchedNode   = 0;
+static uint16_t  SchedTick   = 1;
+static int16_t   SchedTmr    = -1;
+static uint32_t  SchedNow    = 0;
+static uint8_t   SchedActive = 0;
+
+/* timing state and min-heap of deadlines (TPDO numbers) */
+static CO_PDO_SCHED_PDO SchedPdo[CO_TPDO_N];
+static uint16_t         SchedHeap[CO_TPDO_N];
+static uint16_t         SchedHeapNum = 0;
+
+/* TPDOs, which are due in the current tick */
+static uint16_t         SchedDue[CO_TPDO_N];
+
+/* scheduler counters */
+static CO_PDO_SCHED_STAT SchedStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  COMPARE HEAP ENTRIES
+*
+* \details  Earlier deadline first; equal deadlines in COB-ID order.
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t COPdoSchedLess(uint16_t a, uint16_t b)
+{
+    if (SchedPdo[a].Due != SchedPdo[b].Due) {
+        return (CO_PDO_SCHED_BEFORE(SchedPdo[a].Due, SchedPdo[b].Due) ? 1u : 0u);
+    }
+    return ((SchedNode->TPdo[a].Identifier < SchedNode->TPdo[b].Identifier) ? 1u : 0u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  HEAP OPERATIONS
+*
+* \details  Place TPDO n at the heap position pos and restore the heap
+*           order upwards or downwards from the given position.
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoSchedPlace(uint16_t pos, uint16_t n)
+{
+    SchedHeap[pos]  = n;
+    SchedPdo[n].Pos = (uint16_t)(pos + 1u);
+}
+
+static void COPdoSchedUp(uint16_t pos)
+{
+    uint16_t n = SchedHeap[pos];
+    uint16_t parent;
+
+    while (pos > 0) {
+        parent = (uint16_t)((pos - 1u) / 2u);
+        if (COPdoSchedLess(n, SchedHeap[parent]) == 0) {
+            break;
+        }
+        COPdoSchedPlace(pos, SchedHeap[parent]);
+        pos = parent;
+    }
+    COPdoSchedPlace(pos, n);
+}
+
+static void COPdoSchedDown(uint16_t pos)
+{
+    uint16_t n = SchedHeap[pos];
+    uint16_t child;
+
+    for (;;) {
+        child = (uint16_t)(2u * pos + 1u);
+        if (child >= SchedHeapNum) {
+            break;
+        }
+        if (((child + 1u) < SchedHeapNum) &&
+            (COPdoSchedLess(SchedHeap[child + 1u], SchedHeap[child]) != 0)) {
+            child++;
+        }
+        if (COPdoSchedLess(SchedHeap[child], n) == 0) {
+            break;
+        }
+        COPdoSchedPlace(pos, SchedHeap[child]);
+        pos = child;
+    }
+    COPdoSchedPlace(pos, n);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REMOVE TPDO FROM HEAP
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoSchedRemove(uint16_t n)
+{
+    uint16_t pos;
+    uint16_t last;
+
+    if (SchedPdo[n].Pos == 0) {
+        return;
+    }
+    pos             = (uint16_t)(SchedPdo[n].Pos - 1u);
+    SchedPdo[n].Pos = 0;
+    SchedHeapNum--;
+    if (pos < SchedHeapNum) {                /* move last entry into gap */
+        last = SchedHeap[SchedHeapNum];
+        COPdoSchedPlace(pos, last);
+        COPdoSchedUp(pos);
+        COPdoSchedDown((uint16_t)(SchedPdo[last].Pos - 1u));
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  UPDATE DEADLINE OF TPDO
+*
+* \details  A pending TPDO is due at the end of its inhibit time. Otherwise
+*           the event timer defines the deadline, but not before the end of
+*           the inhibit time. TPDOs without deadline are not in the heap.
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoSchedUpdate(uint16_t n)
+{
+    CO_PDO_SCHED_PDO *st = &SchedPdo[n];
+    uint16_t          pos;
+
+    if ((st->Used == 0) || ((st->Pending == 0) && (st->Event == 0))) {
+        COPdoSchedRemove(n);
+        return;
+    }
+    if (st->Pending != 0) {
+        st->Due = st->Free;
+    } else if (CO_PDO_SCHED_BEFORE(st->EvDue, st->Free)) {
+        st->Due = st->Free;
+    } else {
+        st->Due = st->EvDue;
+    }
+
+    if (st->Pos == 0) {
+        pos = SchedHeapNum;
+        SchedHeapNum++;
+    } else {
+        pos = (uint16_t)(st->Pos - 1u);
+    }
+    COPdoSchedPlace(pos, n);
+    COPdoSchedUp(pos);
+    COPdoSchedDown((uint16_t)(st->Pos - 1u));
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RESTART TIMING AFTER TRANSMISSION
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoSchedSent(uint16_t n)
+{
+    CO_PDO_SCHED_PDO *st = &SchedPdo[n];
+
+    st->Free    = SchedNow + st->Inhibit;
+    st->EvDue   = SchedNow + st->Event;
+    st->Pending = 0;
+    COPdoSchedUpdate(n);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  TAKE OVER TPDO TIMING
+*
+* \details  The inhibit time and event time of an asynchronous TPDO are
+*           moved into the scheduler. The TPDO timers of the stack are
+*           deleted, and the cleared TPDO settings keep the stack from
+*           creating new ones.
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoSchedTake(uint16_t n)
+{
+    CO_PDO_SCHED_PDO *st  = &SchedPdo[n];
+    CO_TPDO          *pdo = &SchedNode->TPdo[n];
+    uint8_t           type;
+
+    if (st->Used != 0) {
+        st->Used = 0;
+        SchedStat.Adopted--;
+    }
+    st->Pending = 0;
+    if ((CODictRdByte(&SchedNode->Dict, CO_DEV(0x1800u + n, 2), &type) != CO_ERR_NONE) ||
+        (type < 254u) ||
+        ((pdo->Inhibit == 0) && (pdo->Event == 0))) {
+        COPdoSchedUpdate(n);
+        return;
+    }
+
+    st->Inhibit = (uint16_t)((pdo->Inhibit + SchedTick - 1u) / SchedTick);
+    st->Event   = (uint16_t)(((uint32_t)pdo->Event * 10u + SchedTick - 1u) / SchedTick);
+    if (pdo->EvTmr >= 0) {
+        (void)COTmrDelete(&SchedNode->Tmr, pdo->EvTmr);
+        pdo->EvTmr = -1;
+    }
+    if (pdo->InTmr >= 0) {
+        (void)COTmrDelete(&SchedNode->Tmr, pdo->InTmr);
+        pdo->InTmr = -1;
+    }
+    pdo->Inhibit = 0;
+    pdo->Event   = 0;
+
+    st->Used  = 1;
+    st->Free  = SchedNow;
+    st->EvDue = SchedNow + st->Event;
+    SchedStat.Adopted++;
+    COPdoSchedUpdate(n);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SCHEDULER TICK
+*
+* \details  Collects all TPDOs with expired deadline, sorts them by COB-ID
+*           and sends them in one batch.
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoSchedTimer(void *parg)
+{
+    uint16_t num = 0;
+    uint16_t n;
+    uint16_t i;
+    uint16_t j;
+
+    (void)parg;
+    SchedNow++;
+    SchedStat.Ticks++;
+
+    while ((SchedHeapNum > 0) &&
+           (!CO_PDO_SCHED_BEFORE(SchedNow, SchedPdo[SchedHeap[0]].Due))) {
+        n = SchedHeap[0];
+        COPdoSchedRemove(n);
+        SchedDue[num] = n;
+        num++;
+    }
+    if (num == 0) {
+        return;
+    }
+
+    for (i = 1; i < num; i++) {                /* insertion sort by COB-ID */
+        n = SchedDue[i];
+        j = i;
+        while ((j > 0) && (SchedNode->TPdo[SchedDue[j - 1u]].Identifier >
+                           SchedNode->TPdo[n].Identifier)) {
+            SchedDue[j] = SchedDue[j - 1u];
+            j--;
+        }
+        SchedDue[j] = n;
+    }
+
+    SchedActive = 1;
+    for (i = 0; i < num; i++) {
+        SchedPdo[SchedDue[i]].Pending = 0;
+        COTPdoTx(&SchedNode->TPdo[SchedDue[i]]);
+    }
+    SchedActive = 0;
+    for (i = 0; i < num; i++) {
+        COPdoSchedSent(SchedDue[i]);
+    }
+
+    SchedStat.Frames += num;
+    if (num > SchedStat.Batch) {
+        SchedStat.Batch = num;
+    }
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COPdoSchedInit(CO_NODE *node, uint16_t tick)
+{
+    uint32_t cycle;
+    uint16_t n;
+
+    if ((SchedNode != 0) && (SchedTmr >= 0)) {
+        (void)COTmrDelete(&SchedNode->Tmr, SchedTmr);
+    }
+    SchedTmr           = -1;
+    SchedNode          = 0;
+    SchedNow           = 0;
+    SchedActive        = 0;
+    SchedHeapNum       = 0;
+    SchedStat.Ticks    = 0;
+    SchedStat.Frames   = 0;
+    SchedStat.Deferred = 0;
+    SchedStat.Batch    = 0;
+    SchedStat.Adopted  = 0;
+    for (n = 0; n < CO_TPDO_N; n++) {
+        SchedPdo[n].Used    = 0;
+        SchedPdo[n].Pending = 0;
+        SchedPdo[n].Pos     = 0;
+    }
+    if ((node == 0) || (tick == 0)) {
+        return (-1);
+    }
+
+    cycle = COTmrGetTicks(&node->Tmr, tick, CO_TMR_UNIT_100US);
+    if (cycle == 0) {
+        cycle = 1;
+    }
+    SchedTmr = COTmrCreate(&node->Tmr, cycle, cycle, COPdoSchedTimer, 0);
+    if (SchedTmr < 0) {
+        return (-1);
+    }
+    SchedTick = tick;
+    SchedNode = node;
+    for (n = 0; n < CO_TPDO_N; n++) {
+        COPdoSchedTake(n);
+    }
+    return ((int16_t)SchedStat.Adopted);
+}
+
+/*
+* see function definition
+*/
+int16_t COPdoSchedTx(CO_TPDO *pdo)
+{
+    CO_PDO_SCHED_PDO *st;
+    uint32_t          n;
+
+    if ((SchedNode == 0) || (pdo->Node != SchedNode) || (pdo < &SchedNode->TPdo[0])) {
+        return (0);
+    }
+    n = (uint32_t)(pdo - &SchedNode->TPdo[0]);
+    if (n >= CO_TPDO_N) {
+        return (0);
+    }
+    if ((pdo->Inhibit != 0) || (pdo->Event != 0)) {
+        COPdoSchedTake((uint16_t)n);          /* reconfigured by the stack */
+    }
+    st = &SchedPdo[n];
+    if ((st->Used == 0) || (SchedActive != 0)) {
+        return (0);
+    }
+    if (CO_PDO_SCHED_BEFORE(SchedNow, st->Free)) {
+        if (st->Pending == 0) {
+            st->Pending = 1;
+            COPdoSchedUpdate((uint16_t)n);
+        }
+        SchedStat.Deferred++;
+        return (1);
+    }
+    COPdoSchedSent((uint16_t)n);
+    return (0);
+}
+
+/*
+* see function definition
+*/
+const CO_PDO_SCHED_STAT *COPdoSchedStat(void)
+{
+    return (&SchedStat);
+}
+
+#if CO_PDO_SCHED_WRAP
+
+/******************************************************************************
+* LINKER WRAPPED STACK FUNCTIONS
+******************************************************************************/
+
+void __real_COTPdoTrigPdo(CO_TPDO *pdo, uint16_t num);
+void __real_COTPdoTrigObj(CO_TPDO *pdo, CO_OBJ *obj);
+
+void __wrap_COTPdoTrigPdo(CO_TPDO *pdo, uint16_t num);
+void __wrap_COTPdoTrigObj(CO_TPDO *pdo, CO_OBJ *obj);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  TRIGGER TPDO (WRAPPED)
+*
+* \details  The stack function calls its transmit function internally,
+*           which bypasses the wrapped COTPdoTx(). A TPDO with timing by
+*           the scheduler is therefore passed to COTPdoTx() here, so the
+*           trigger is deferred within the inhibit time. All other TPDOs
+*           are passed to the stack function.
+*/
+/*---------------------------------------------------------------------------*/
+void __wrap_COTPdoTrigPdo(CO_TPDO *pdo, uint16_t num)
+{
+    CO_TPDO *tpdo;
+
+    if ((SchedNode == 0) || (pdo != &SchedNode->TPdo[0]) || (num >= CO_TPDO_N)) {
+        __real_COTPdoTrigPdo(pdo, num);
+        return;
+    }
+    tpdo = &pdo[num];
+    if ((tpdo->Inhibit != 0) || (tpdo->Event != 0)) {
+        COPdoSchedTake(num);                  /* reconfigured by the stack */
+    }
+    if (SchedPdo[num].Used == 0) {
+        __real_COTPdoTrigPdo(pdo, num);
+        return;
+    }
+    if ((tpdo->Identifier & CO_PDO_SCHED_COBID_OFF) == 0) {
+        COTPdoTx(tpdo);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  TRIGGER TPDOS OF OBJECT ENTRY (WRAPPED)
+*
+* \details  Each TPDO of the scheduler node, which maps the given object
+*           entry, is triggered with the wrapped COTPdoTrigPdo().
+*/
+/*---------------------------------------------------------------------------*/
+void __wrap_COTPdoTrigObj(CO_TPDO *pdo, CO_OBJ *obj)
+{
+    uint16_t num;
+    uint8_t  on;
+
+    if ((SchedNode == 0) || (pdo != &SchedNode->TPdo[0])) {
+        __real_COTPdoTrigObj(pdo, obj);
+        return;
+    }
+    for (num = 0; num < CO_TPDO_N; num++) {
+        for (on = 0; on < pdo[num].ObjNum; on++) {
+            if (pdo[num].Map[on] == obj) {
+                __wrap_COTPdoTrigPdo(pdo, num);
+                break;
+            }
+        }
+    }
+}
+
+#endif  /* #if CO_PDO_SCHED_WRAP */
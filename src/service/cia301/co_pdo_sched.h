@@ -0,0 +1,111 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PDO_SCHED_H_
+#define CO_PDO_SCHED_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief PDO SCHEDULER STATISTICS
+*
+*    Counters of the PDO scheduler since COPdoSchedInit().
+*/
+typedef struct CO_PDO_SCHED_STAT_T {
+    uint32_t Ticks;            /*!< handled scheduler ticks                 */
+    uint32_t Frames;           /*!< TPDOs sent by the scheduler             */
+    uint32_t Deferred;         /*!< triggers delayed by the inhibit time    */
+    uint16_t Batch;            /*!< largest number of TPDOs in one tick     */
+    uint16_t Adopted;          /*!< TPDOs with timing by the scheduler      */
+} CO_PDO_SCHED_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT PDO SCHEDULER
+*
+* \details  This function enables the PDO scheduler for the given node. It
+*           must be called after CONodeInit(). The scheduler takes over the
+*           inhibit time and the event timer of all asynchronous TPDOs
+*           (type 254/255): the stack timers of these TPDOs are deleted and
+*           all deadlines are kept in a min-heap, which is checked by a
+*           single cyclic stack timer. A TPDO, which is reconfigured by the
+*           stack (e.g. write to 1800h+n:3/5 or NMT reset), is taken over
+*           again with its next transmission.
+*
+*           All TPDOs, which are due in the same scheduler tick, are sent
+*           in a batch ordered by COB-ID (lowest identifier first).
+*
+* \param    node
+*           reference to the node; NULL disables the scheduler
+*
+* \param    tick
+*           scheduler tick in 100us; the inhibit times and event timers
+*           are rounded up to this resolution
+*
+* \retval   >=0    number of TPDOs with timing by the scheduler
+* \retval   <0     scheduler disabled or timer not available
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COPdoSchedInit(CO_NODE *node, uint16_t tick);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SCHEDULE TPDO TRANSMISSION
+*
+* \details  This function is called for each TPDO transmission. A TPDO
+*           within its inhibit time is marked pending and sent by the
+*           scheduler at the end of the inhibit time; multiple triggers
+*           within the inhibit time result in a single transmission. With
+*           CO_PDO_SCHED_WRAP, the function is called by the wrapped stack
+*           function COTPdoTx(); the triggers COTPdoTrigPdo() and
+*           COTPdoTrigObj() are wrapped as well, because the stack sends
+*           from there without the wrapped COTPdoTx().
+*
+* \param    pdo
+*           reference to the TPDO
+*
+* \retval   =0    send TPDO now
+* \retval   =1    TPDO transmission is deferred
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COPdoSchedTx(CO_TPDO *pdo);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET PDO SCHEDULER STATISTICS
+*
+* \retval   reference to the scheduler counters
+*/
+/*---------------------------------------------------------------------------*/
+const CO_PDO_SCHED_STAT *COPdoSchedStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
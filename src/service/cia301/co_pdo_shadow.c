@@ -0,0 +1,363 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_pdo_shadow.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_PDO_SHADOW_RMAP   0x1600u       /* first RPDO mapping record    */
+#define CO_PDO_SHADOW_TMAP   0x1A00u       /* first TPDO mapping record    */
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* staged mapping (Map = 0: free) */
+typedef struct CO_PDO_SHADOW_SLOT_T {
+    CO_OBJ   *Obj[8];
+    uint32_t  Entry[8];
+    uint16_t  Map;
+    uint8_t   Num;
+} CO_PDO_SHADOW_SLOT;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTShadowMapSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTShadowMapRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTShadowMapWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTShadowMap = {
+    COTShadowMapSize,
+    0,
+    COTShadowMapRead,
+    COTShadowMapWrite
+};
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled shadow mappings */
+static CO_NODE *ShadowNode = 0;
+
+/* staged mappings */
+static CO_PDO_SHADOW_SLOT ShadowSlot[CO_PDO_SHADOW_N];
+static uint8_t            ShadowNum = 0;
+
+/* shadow mapping counters */
+static CO_PDO_SHADOW_STAT ShadowStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK SHADOW MAPPING
+*
+* \details  Resolves the mapping entries into the object entries and
+*           checks them like the mapping types of the stack. Objects with
+*           the asynchronous TPDO trigger are not accepted for TPDOs,
+*           because the trigger links of the stack are built by the
+*           mapping types only.
+*/
+/*---------------------------------------------------------------------------*/
+static CO_ERR COPdoShadowCheck(uint16_t map, const uint32_t *entry, uint8_t num, CO_OBJ **obj)
+{
+    CO_DICT  *cod = &ShadowNode->Dict;
+    uint32_t  bits = 0;
+    uint32_t  size;
+    uint8_t   rx;
+    uint8_t   n;
+
+    if ((num > 8u) || ((num > 0u) && (entry == 0))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if ((map >= CO_PDO_SHADOW_RMAP) && (map < (CO_PDO_SHADOW_RMAP + CO_RPDO_N))) {
+        rx = 1;
+    } else if ((map >= CO_PDO_SHADOW_TMAP) && (map < (CO_PDO_SHADOW_TMAP + CO_TPDO_N))) {
+        rx = 0;
+    } else {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (CODictFind(cod, CO_DEV(map, 0)) == 0) {
+        return (CO_ERR_OBJ_NOT_FOUND);
+    }
+
+    for (n = 0; n < num; n++) {
+        if (CODictFind(cod, CO_DEV(map, n + 1u)) == 0) {
+            return (CO_ERR_OBJ_NOT_FOUND);        /* no record entry        */
+        }
+        obj[n] = CODictFind(cod, CO_DEV((uint16_t)(entry[n] >> 16),
+                                        (uint8_t)(entry[n] >> 8)));
+        if ((obj[n] == 0) || (CO_IS_PDOMAP(obj[n]->Key) == 0)) {
+            return (CO_ERR_OBJ_MAP_TYPE);
+        }
+        if ((rx != 0) ? (CO_IS_WRITE(obj[n]->Key) == 0) :
+                        ((CO_IS_READ(obj[n]->Key) == 0) ||
+                         (CO_IS_ASYNC(obj[n]->Key) != 0))) {
+            return (CO_ERR_OBJ_MAP_TYPE);
+        }
+        size = COObjGetSize(obj[n], ShadowNode, 0);
+        if ((size * 8u) != (entry[n] & 0xFFu)) {
+            return (CO_ERR_OBJ_MAP_LEN);
+        }
+        bits += size * 8u;
+        if (bits > 64u) {
+            return (CO_ERR_OBJ_MAP_LEN);
+        }
+    }
+    return (CO_ERR_NONE);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  PUT MAPPING RECORD VALUE
+*
+* \details  Writes the storage of a mapping record entry without the type
+*           functions, which accept changes only with an invalid COB-ID.
+*           The number of entries (sub 0) is an unsigned8, the entries are
+*           unsigned32 values.
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoShadowPut(CO_OBJ *obj, uint32_t val, uint8_t width)
+{
+    if (CO_IS_DIRECT(obj->Key) != 0) {
+        obj->Data = (CO_DATA)val;
+    } else if (width == 1u) {
+        *(uint8_t *)(obj->Data) = (uint8_t)val;
+    } else {
+        *(uint32_t *)(obj->Data) = val;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  APPLY STAGED MAPPING
+*
+* \details  Updates the mapping record and the object list of the PDO.
+*/
+/*---------------------------------------------------------------------------*/
+static void COPdoShadowApply(CO_PDO_SHADOW_SLOT *slot)
+{
+    CO_DICT  *cod = &ShadowNode->Dict;
+    CO_TPDO  *tpdo;
+    CO_RPDO  *rpdo;
+    uint8_t   n;
+
+    for (n = 0; n < slot->Num; n++) {
+        COPdoShadowPut(CODictFind(cod, CO_DEV(slot->Map, n + 1u)), slot->Entry[n], 4u);
+    }
+    COPdoShadowPut(CODictFind(cod, CO_DEV(slot->Map, 0)), slot->Num, 1u);
+
+    if (slot->Map >= CO_PDO_SHADOW_TMAP) {
+        tpdo = &ShadowNode->TPdo[slot->Map - CO_PDO_SHADOW_TMAP];
+        for (n = 0; n < slot->Num; n++) {
+            tpdo->Map[n] = slot->Obj[n];
+        }
+        tpdo->ObjNum = slot->Num;
+    } else {
+        rpdo = &ShadowNode->RPdo[slot->Map - CO_PDO_SHADOW_RMAP];
+        for (n = 0; n < slot->Num; n++) {
+            rpdo->Map[n] = slot->Obj[n];
+        }
+        rpdo->ObjNum = slot->Num;
+    }
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COPdoShadowInit(CO_NODE *node)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_PDO_SHADOW_N; n++) {
+        ShadowSlot[n].Map = 0;
+    }
+    ShadowNum           = 0;
+    ShadowStat.Staged   = 0;
+    ShadowStat.Rejected = 0;
+    ShadowStat.Swapped  = 0;
+    ShadowNode          = node;
+}
+
+/*
+* see function definition
+*/
+CO_ERR COPdoShadowStage(uint16_t map, const uint32_t *entry, uint8_t num)
+{
+    CO_PDO_SHADOW_SLOT *slot = 0;
+    CO_OBJ             *obj[8];
+    CO_ERR              err;
+    uint8_t             n;
+
+    if (ShadowNode == 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+    err = COPdoShadowCheck(map, entry, num, &obj[0]);
+    if (err != CO_ERR_NONE) {
+        ShadowStat.Rejected++;
+        return (err);
+    }
+
+    for (n = 0; n < CO_PDO_SHADOW_N; n++) {
+        if (ShadowSlot[n].Map == map) {
+            slot = &ShadowSlot[n];                /* replace staged mapping */
+            break;
+        }
+        if ((slot == 0) && (ShadowSlot[n].Map == 0)) {
+            slot = &ShadowSlot[n];
+        }
+    }
+    if (slot == 0) {
+        ShadowStat.Rejected++;
+        return (CO_ERR_BAD_ARG);
+    }
+    if (slot->Map != map) {
+        ShadowNum++;
+    }
+    for (n = 0; n < num; n++) {
+        slot->Obj[n]   = obj[n];
+        slot->Entry[n] = entry[n];
+    }
+    slot->Num = num;
+    slot->Map = map;
+    ShadowStat.Staged++;
+
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+int16_t COPdoShadowSwap(CO_NODE *node)
+{
+    int16_t swapped = 0;
+    uint8_t n;
+
+    if ((ShadowNode == 0) || (node != ShadowNode) || (ShadowNum == 0)) {
+        return (0);
+    }
+    for (n = 0; n < CO_PDO_SHADOW_N; n++) {
+        if (ShadowSlot[n].Map != 0) {
+            COPdoShadowApply(&ShadowSlot[n]);
+            ShadowSlot[n].Map = 0;
+            swapped++;
+        }
+    }
+    ShadowNum           = 0;
+    ShadowStat.Swapped += (uint32_t)swapped;
+
+    return (swapped);
+}
+
+/*
+* see function definition
+*/
+uint8_t COPdoShadowPending(void)
+{
+    return (ShadowNum);
+}
+
+/*
+* see function definition
+*/
+const CO_PDO_SHADOW_STAT *COPdoShadowStat(void)
+{
+    return (&ShadowStat);
+}
+
+/******************************************************************************
+* PRIVATE TYPE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTShadowMapSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    (void)obj;
+    (void)node;
+    (void)width;
+
+    return ((uint32_t)4u);
+}
+
+static CO_ERR COTShadowMapRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    uint32_t value;
+
+    if ((node == 0) || (size < sizeof(value))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (CO_IS_DIRECT(obj->Key) != 0) {
+        value = (uint32_t)(obj->Data);
+    } else {
+        value = *(uint32_t *)(obj->Data);
+    }
+    memcpy(buffer, &value, sizeof(value));       /* buffer may be unaligned */
+
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTShadowMapWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    uint32_t entry[8];
+    uint32_t value;
+    uint16_t idx;
+    uint8_t  num;
+    uint8_t  n;
+    CO_ERR   err;
+
+    if ((node == 0) || (size < sizeof(value)) || (node != ShadowNode)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    memcpy(&value, buffer, sizeof(value));       /* buffer may be unaligned */
+    num   = (uint8_t)value;
+    idx   = CO_GET_IDX(obj->Key);
+    if (num > 8u) {
+        return (CO_ERR_OBJ_MAP_LEN);
+    }
+    for (n = 0; n < num; n++) {
+        err = CODictRdLong(&node->Dict, CO_DEV(idx, n + 2u), &entry[n]);
+        if (err != CO_ERR_NONE) {
+            return (err);
+        }
+    }
+    err = COPdoShadowStage((uint16_t)(value >> 16), &entry[0], num);
+    if (err != CO_ERR_NONE) {
+        return (err);
+    }
+    if (CO_IS_DIRECT(obj->Key) != 0) {
+        obj->Data = (CO_DATA)value;
+    } else {
+        *(uint32_t *)(obj->Data) = value;
+    }
+    return (CO_ERR_NONE);
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PDO_SHADOW_H_
+#define CO_PDO_SHADOW_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#ifndef CO_PDO_SHADOW_N
+#define CO_PDO_SHADOW_N      8u    /*!< mappings staged at the same time    */
+#endif
+
+#define CO_TSHADOW_MAP  ((CO_OBJ_TYPE *)&COTShadowMap)  /*!< shadow mapping commit */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief SHADOW MAPPING STATISTICS
+*
+*    Counters of the shadow mappings since COPdoShadowInit().
+*/
+typedef struct CO_PDO_SHADOW_STAT_T {
+    uint32_t Staged;           /*!< accepted staged mappings                */
+    uint32_t Rejected;         /*!< rejected staged mappings                */
+    uint32_t Swapped;          /*!< mappings swapped into the PDOs          */
+} CO_PDO_SHADOW_STAT;
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE SHADOW MAPPING COMMIT
+*
+*    This type stages a shadow mapping via SDO. The object entry is
+*    subindex 1 of a manufacturer specific record; subindex 2..9 hold the
+*    new mapping entries (UNSIGNED32). Writing the value 0xIIII00NN to
+*    the object entry stages the first NN entries of the record for the
+*    mapping record with index IIII (see COPdoShadowStage()).
+*/
+extern const CO_OBJ_TYPE COTShadowMap;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT SHADOW MAPPINGS
+*
+* \details  This function enables the shadow mappings for the given node
+*           and drops all staged mappings. It must be called after
+*           CONodeInit().
+*
+* \param    node
+*           reference to the node; NULL disables the shadow mappings
+*/
+/*---------------------------------------------------------------------------*/
+void COPdoShadowInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  STAGE SHADOW MAPPING
+*
+* \details  This function checks a complete new mapping for a RPDO or TPDO
+*           and stages it. The mapping of the PDO stays in service until
+*           the staged mapping is swapped in at the next SYNC (see
+*           COPdoShadowSwap()). A mapping, which is staged again for the
+*           same PDO, replaces the staged mapping.
+*
+*           The mapped objects must exist and be PDO mappable with the
+*           given length; the mapping record must provide the subindex
+*           entries 1..num.
+*
+* \param    map
+*           index of the mapping record (1600h..17FFh or 1A00h..1BFFh)
+*
+* \param    entry
+*           new mapping entries (index, subindex, length in bits)
+*
+* \param    num
+*           number of mapping entries (0..8)
+*
+* \retval   =CO_ERR_NONE            mapping is staged
+* \retval   =CO_ERR_OBJ_MAP_TYPE    object not found or not mappable
+* \retval   =CO_ERR_OBJ_MAP_LEN     length does not match or exceeds 8 bytes
+* \retval   !=CO_ERR_NONE           disabled, bad arguments or no free stage
+*/
+/*---------------------------------------------------------------------------*/
+CO_ERR COPdoShadowStage(uint16_t map, const uint32_t *entry, uint8_t num);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SWAP SHADOW MAPPINGS
+*
+* \details  This function swaps all staged mappings of the node into the
+*           PDOs and the mapping records in one step. With CO_PDO_SHADOW_WRAP,
+*           the function is called after each SYNC is handled, so the
+*           frames of the current SYNC cycle still use the old mappings.
+*
+* \param    node
+*           reference to the node
+*
+* \return   number of swapped mappings
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COPdoShadowSwap(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET NUMBER OF STAGED MAPPINGS
+*
+* \return   number of mappings waiting for the next SYNC
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t COPdoShadowPending(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET SHADOW MAPPING STATISTICS
+*
+* \retval   reference to the shadow mapping counters
+*/
+/*---------------------------------------------------------------------------*/
+const CO_PDO_SHADOW_STAT *COPdoShadowStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
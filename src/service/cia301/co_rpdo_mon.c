@@ -0,0 +1,372 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_rpdo_mon.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#if ((CO_RPDO_MON_WHEEL & (CO_RPDO_MON_WHEEL - 1u)) != 0)
+#error "CO_RPDO_MON_WHEEL must be a power of two"
+#endif
+#if ((CO_RPDO_MON_CACHE & (CO_RPDO_MON_CACHE - 1u)) != 0) || (CO_RPDO_MON_CACHE < (2 * CO_RPDO_N))
+#error "CO_RPDO_MON_CACHE must be a power of two and at least 2 * CO_RPDO_N"
+#endif
+
+/* cache index of a CAN identifier (spreads the function code bits) */
+#define CO_RPDO_MON_HASH(id)       (((id) ^ ((id) >> 6)) & (CO_RPDO_MON_CACHE - 1u))
+
+/* tick a is before tick b (wrap-around safe) */
+#define CO_RPDO_MON_BEFORE(a,b)    ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* deadline state of an RPDO (all times in monitor ticks) */
+typedef struct CO_RPDO_MON_PDO_T {
+    uint32_t Time;             /* deadline (0: not monitored)               */
+    uint32_t Due;              /* expiry of the running deadline            */
+    uint32_t Wake;             /* tick of the wheel slot with the RPDO      */
+    uint16_t Next;             /* next RPDO in wheel slot + 1 (0: end)      */
+    uint8_t  Armed;            /* deadline is running                       */
+    uint8_t  Listed;           /* RPDO is in a wheel slot                   */
+    uint8_t  Expired;          /* deadline is expired                       */
+} CO_RPDO_MON_PDO;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled monitor, tick length in 100us and cyclic timer */
+static CO_NODE          *MonNode = 0;
+static uint16_t          MonTick = 1;
+static int16_t           MonTmr  = -1;
+static uint32_t          MonNow  = 0;
+
+/* timeout reaction */
+static uint8_t           MonEmcy = CO_RPDO_MON_NO_EMCY;
+static CO_RPDO_MON_FUNC  MonFunc = 0;
+
+/* deadline state, wheel slots and COB-ID cache (RPDO number + 1) */
+static CO_RPDO_MON_PDO   MonPdo[CO_RPDO_N];
+static uint16_t          MonWheel[CO_RPDO_MON_WHEEL];
+static uint16_t          MonCache[CO_RPDO_MON_CACHE];
+
+/* monitor counters */
+static CO_RPDO_MON_STAT  MonStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  WHEEL OPERATIONS
+*
+* \details  Link RPDO n into the wheel slot of the given tick, or remove it
+*           from its wheel slot.
+*/
+/*---------------------------------------------------------------------------*/
+static void CORPdoMonLink(uint16_t n, uint32_t wake)
+{
+    CO_RPDO_MON_PDO *st   = &MonPdo[n];
+    uint32_t         slot = wake & (CO_RPDO_MON_WHEEL - 1u);
+
+    st->Wake       = wake;
+    st->Next       = MonWheel[slot];
+    st->Listed     = 1;
+    MonWheel[slot] = (uint16_t)(n + 1u);
+}
+
+static void CORPdoMonUnlink(uint16_t n)
+{
+    uint16_t *ref = &MonWheel[MonPdo[n].Wake & (CO_RPDO_MON_WHEEL - 1u)];
+
+    if (MonPdo[n].Listed == 0) {
+        return;
+    }
+    while (*ref != 0) {
+        if (*ref == (uint16_t)(n + 1u)) {
+            *ref = MonPdo[n].Next;
+            break;
+        }
+        ref = &MonPdo[*ref - 1u].Next;
+    }
+    MonPdo[n].Listed = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FIND RPDO BY COB-ID
+*
+* \details  The cache entry of the identifier is checked against the RPDO,
+*           so changed COB-IDs fall back to a search, which updates the
+*           cache.
+*/
+/*---------------------------------------------------------------------------*/
+static int32_t CORPdoMonFind(uint32_t id)
+{
+    uint16_t *entry = &MonCache[CO_RPDO_MON_HASH(id)];
+    uint16_t  n;
+
+    if ((*entry != 0) && (MonNode->RPdo[*entry - 1u].Identifier == id)) {
+        return ((int32_t)(*entry - 1u));
+    }
+    MonStat.Misses++;
+    for (n = 0; n < CO_RPDO_N; n++) {
+        if (MonNode->RPdo[n].Identifier == id) {
+            *entry = (uint16_t)(n + 1u);
+            return ((int32_t)n);
+        }
+    }
+    return (-1);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  EXPIRE RPDO DEADLINE
+*
+* \details  Outside of the NMT state operational, the monitoring is stopped
+*           without timeout until the next reception.
+*/
+/*---------------------------------------------------------------------------*/
+static void CORPdoMonExpire(uint16_t n)
+{
+    CO_RPDO_MON_PDO *st = &MonPdo[n];
+
+    st->Armed = 0;
+    if (CONmtGetMode(&MonNode->Nmt) != CO_OPERATIONAL) {
+        return;
+    }
+    st->Expired = 1;
+    MonStat.Expired++;
+    MonStat.Timeouts++;
+    if ((MonStat.Expired == 1u) && (MonEmcy != CO_RPDO_MON_NO_EMCY)) {
+        COEmcySet(&MonNode->Emcy, MonEmcy, 0);
+    }
+    if (MonFunc != 0) {
+        MonFunc(MonNode, n);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  MONITOR TICK
+*
+* \details  Checks the RPDOs in the wheel slot of the current tick. RPDOs,
+*           which are received since they were linked, are moved to the
+*           slot of their new deadline.
+*/
+/*---------------------------------------------------------------------------*/
+static void CORPdoMonTimer(void *parg)
+{
+    uint32_t slot;
+    uint16_t list;
+    uint16_t n;
+
+    (void)parg;
+    MonNow++;
+    MonStat.Ticks++;
+
+    slot           = MonNow & (CO_RPDO_MON_WHEEL - 1u);
+    list           = MonWheel[slot];
+    MonWheel[slot] = 0;
+    while (list != 0) {
+        n                = (uint16_t)(list - 1u);
+        list             = MonPdo[n].Next;
+        MonPdo[n].Listed = 0;
+        if (MonPdo[n].Armed == 0) {
+            continue;
+        }
+        if (CO_RPDO_MON_BEFORE(MonNow, MonPdo[n].Due)) {
+            CORPdoMonLink(n, MonPdo[n].Due);
+        } else {
+            CORPdoMonExpire(n);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CLEAR RPDO TIMEOUT
+*/
+/*---------------------------------------------------------------------------*/
+static void CORPdoMonClear(uint16_t n)
+{
+    if (MonPdo[n].Expired == 0) {
+        return;
+    }
+    MonPdo[n].Expired = 0;
+    MonStat.Expired--;
+    if ((MonStat.Expired == 0) && (MonEmcy != CO_RPDO_MON_NO_EMCY)) {
+        COEmcyClr(&MonNode->Emcy, MonEmcy);
+    }
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t CORPdoMonInit(CO_NODE *node, uint16_t tick, uint8_t emcy, CO_RPDO_MON_FUNC func)
+{
+    uint32_t cycle;
+    uint16_t time;
+    uint16_t n;
+
+    if ((MonNode != 0) && (MonTmr >= 0)) {
+        (void)COTmrDelete(&MonNode->Tmr, MonTmr);
+    }
+    MonTmr            = -1;
+    MonNode           = 0;
+    MonNow            = 0;
+    MonStat.Ticks     = 0;
+    MonStat.Rearmed   = 0;
+    MonStat.Timeouts  = 0;
+    MonStat.Misses    = 0;
+    MonStat.Monitored = 0;
+    MonStat.Expired   = 0;
+    for (n = 0; n < CO_RPDO_N; n++) {
+        MonPdo[n].Time    = 0;
+        MonPdo[n].Armed   = 0;
+        MonPdo[n].Listed  = 0;
+        MonPdo[n].Expired = 0;
+    }
+    for (n = 0; n < CO_RPDO_MON_WHEEL; n++) {
+        MonWheel[n] = 0;
+    }
+    for (n = 0; n < CO_RPDO_MON_CACHE; n++) {
+        MonCache[n] = 0;
+    }
+    if ((node == 0) || (tick == 0)) {
+        return (-1);
+    }
+
+    cycle = COTmrGetTicks(&node->Tmr, tick, CO_TMR_UNIT_100US);
+    if (cycle == 0) {
+        cycle = 1;
+    }
+    MonTmr = COTmrCreate(&node->Tmr, cycle, cycle, CORPdoMonTimer, 0);
+    if (MonTmr < 0) {
+        return (-1);
+    }
+    MonTick = tick;
+    MonEmcy = emcy;
+    MonFunc = func;
+    MonNode = node;
+    for (n = 0; n < CO_RPDO_N; n++) {
+        if ((CODictRdWord(&node->Dict, CO_DEV(0x1400u + n, 5), &time) == CO_ERR_NONE) &&
+            (time != 0)) {
+            (void)CORPdoMonSet(n, time);
+        }
+    }
+    return ((int16_t)MonStat.Monitored);
+}
+
+/*
+* see function definition
+*/
+int16_t CORPdoMonSet(uint16_t num, uint16_t time)
+{
+    CO_RPDO_MON_PDO *st;
+
+    if ((MonNode == 0) || (num >= CO_RPDO_N)) {
+        return (-1);
+    }
+    st = &MonPdo[num];
+    CORPdoMonUnlink(num);
+    CORPdoMonClear(num);
+    st->Armed = 0;
+    if (st->Time != 0) {
+        MonStat.Monitored--;
+    }
+    st->Time = ((uint32_t)time * 10u + MonTick - 1u) / MonTick;
+    if (st->Time != 0) {
+        MonStat.Monitored++;
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+void CORPdoMonTouch(uint32_t key)
+{
+    uint16_t idx = CO_GET_IDX(key);
+    uint16_t num;
+    uint16_t time;
+    uint32_t ticks;
+
+    if ((MonNode == 0) || (CO_GET_SUB(key) != 5u) ||
+        (idx < 0x1400u) || (idx >= (0x1400u + CO_RPDO_N))) {
+        return;
+    }
+    num = (uint16_t)(idx - 0x1400u);
+    if (CODictRdWord(&MonNode->Dict, CO_DEV(idx, 5), &time) != CO_ERR_NONE) {
+        return;
+    }
+    ticks = ((uint32_t)time * 10u + MonTick - 1u) / MonTick;
+    if (ticks != MonPdo[num].Time) {
+        (void)CORPdoMonSet(num, time);
+    }
+}
+
+/*
+* see function definition
+*/
+void CORPdoMonRx(uint32_t id)
+{
+    CO_RPDO_MON_PDO *st;
+    int32_t          n;
+
+    if ((MonNode == 0) || (MonStat.Monitored == 0)) {
+        return;
+    }
+    n = CORPdoMonFind(id);
+    if ((n < 0) || (MonPdo[n].Time == 0)) {
+        return;
+    }
+    st        = &MonPdo[n];
+    st->Due   = MonNow + st->Time;
+    st->Armed = 1;
+    if (st->Listed == 0) {
+        CORPdoMonLink((uint16_t)n, st->Due);
+    }
+    MonStat.Rearmed++;
+    CORPdoMonClear((uint16_t)n);
+}
+
+/*
+* see function definition
+*/
+uint8_t CORPdoMonExpired(uint16_t num)
+{
+    if ((MonNode == 0) || (num >= CO_RPDO_N)) {
+        return (0);
+    }
+    return (MonPdo[num].Expired);
+}
+
+/*
+* see function definition
+*/
+const CO_RPDO_MON_STAT *CORPdoMonStat(void)
+{
+    return (&MonStat);
+}
@@ -0,0 +1,196 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_RPDO_MON_H_
+#define CO_RPDO_MON_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_RPDO_MON_EMCY_CODE  0x8250u  /*!< EMCY code: RPDO timeout         */
+#define CO_RPDO_MON_NO_EMCY    0xFFu    /*!< no EMCY on RPDO timeout         */
+
+/*! \brief DEADLINE WHEEL SIZE
+*
+*    Number of slots in the deadline wheel (power of two). Deadlines beyond
+*    the wheel are checked once per wheel revolution.
+*/
+#ifndef CO_RPDO_MON_WHEEL
+#define CO_RPDO_MON_WHEEL      64u
+#endif
+
+/*! \brief COB-ID CACHE SIZE
+*
+*    Number of entries in the direct-mapped cache from the CAN identifier
+*    to the RPDO number (power of two, at least twice CO_RPDO_N).
+*/
+#ifndef CO_RPDO_MON_CACHE
+#if CO_RPDO_N <= 32
+#define CO_RPDO_MON_CACHE      64u
+#elif CO_RPDO_N <= 128
+#define CO_RPDO_MON_CACHE      256u
+#else
+#define CO_RPDO_MON_CACHE      1024u
+#endif
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief RPDO TIMEOUT CALLBACK
+*
+*    Called once for each expired RPDO deadline with the node and the
+*    RPDO number.
+*/
+typedef void (*CO_RPDO_MON_FUNC)(CO_NODE *node, uint16_t num);
+
+/*! \brief RPDO MONITOR STATISTICS
+*
+*    Counters of the RPDO monitor since CORPdoMonInit().
+*/
+typedef struct CO_RPDO_MON_STAT_T {
+    uint32_t Ticks;            /*!< handled monitor ticks                   */
+    uint32_t Rearmed;          /*!< deadlines restarted by a reception      */
+    uint32_t Timeouts;         /*!< expired deadlines                       */
+    uint32_t Misses;           /*!< COB-ID cache misses                     */
+    uint16_t Monitored;        /*!< RPDOs with deadline monitoring          */
+    uint16_t Expired;          /*!< RPDOs currently in timeout              */
+} CO_RPDO_MON_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT RPDO MONITOR
+*
+* \details  This function enables the deadline monitoring of RPDOs for the
+*           given node. It must be called after CONodeInit(). The event
+*           timer of each RPDO (1400h+n:5, in ms) is the deadline between
+*           two receptions; RPDOs without this entry or with 0 are not
+*           monitored. Later writes to the event timer change the
+*           deadline (see CORPdoMonTouch()). As defined by CiA 301, the monitoring of an RPDO
+*           starts with its first reception in the NMT state operational.
+*
+*           All deadlines are kept in a timing wheel, which is advanced by
+*           a single cyclic stack timer. An expired RPDO raises the EMCY
+*           table entry (emcy) and calls the callback (func) once. The next
+*           reception restarts the monitoring; the EMCY is cleared, when no
+*           RPDO is in timeout anymore.
+*
+* \param    node
+*           reference to the node; NULL disables the monitor
+*
+* \param    tick
+*           monitor tick in 100us; the deadlines are rounded up to this
+*           resolution
+*
+* \param    emcy
+*           index of the EMCY table entry with the code
+*           CO_RPDO_MON_EMCY_CODE, or CO_RPDO_MON_NO_EMCY
+*
+* \param    func
+*           timeout callback, or NULL
+*
+* \retval   >=0    number of monitored RPDOs
+* \retval   <0     monitor disabled or timer not available
+*/
+/*---------------------------------------------------------------------------*/
+int16_t CORPdoMonInit(CO_NODE *node, uint16_t tick, uint8_t emcy, CO_RPDO_MON_FUNC func);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SET RPDO DEADLINE
+*
+* \details  This function changes the deadline of an RPDO at runtime. The
+*           monitoring starts again with the next reception.
+*
+* \param    num
+*           RPDO number (0 .. CO_RPDO_N-1)
+*
+* \param    time
+*           deadline in ms; 0 disables the monitoring of the RPDO
+*
+* \retval   =0    deadline changed
+* \retval   <0    monitor disabled or bad RPDO number
+*/
+/*---------------------------------------------------------------------------*/
+int16_t CORPdoMonSet(uint16_t num, uint16_t time);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK WRITTEN OBJECT ENTRY
+*
+* \details  This function reloads the deadline of an RPDO, when the given
+*           key is its event timer (1400h+n:5) and the written value
+*           differs from the running deadline. With CO_RPDO_MON_WRAP, the
+*           function is called by the wrapped stack function COObjWrValue().
+*
+* \param    key
+*           key of the written object entry
+*/
+/*---------------------------------------------------------------------------*/
+void CORPdoMonTouch(uint32_t key);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RESTART RPDO DEADLINE
+*
+* \details  This function is called for each received PDO and restarts the
+*           deadline of the matching RPDO in constant time. With
+*           CO_RPDO_MON_WRAP, the function is called by the wrapped stack
+*           function COPdoReceive().
+*
+* \param    id
+*           CAN identifier of the received frame
+*/
+/*---------------------------------------------------------------------------*/
+void CORPdoMonRx(uint32_t id);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK RPDO TIMEOUT
+*
+* \param    num
+*           RPDO number (0 .. CO_RPDO_N-1)
+*
+* \retval   =1    the deadline of the RPDO is expired
+* \retval   =0    RPDO is received in time, not monitored or not started
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t CORPdoMonExpired(uint16_t num);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET RPDO MONITOR STATISTICS
+*
+* \retval   reference to the monitor counters
+*/
+/*---------------------------------------------------------------------------*/
+const CO_RPDO_MON_STAT *CORPdoMonStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
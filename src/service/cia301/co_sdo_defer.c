@@ -0,0 +1,345 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_sdo_defer.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* state of a parked request */
+#define CO_SDO_DEFER_IDLE      0u    /* no parked request                   */
+#define CO_SDO_DEFER_WAIT      1u    /* wait for COSdoDeferDone()           */
+#define CO_SDO_DEFER_READY     2u    /* replay request to the stack         */
+
+/* SDO abort codes */
+#define CO_SDO_DEFER_ERR_TIMEOUT  0x05040000u
+#define CO_SDO_DEFER_ERR_CMD      0x05040001u
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* parked request of an SDO server */
+typedef struct CO_SDO_PARK_T {
+    CO_SDO    *Srv;            /* SDO server                                */
+    CO_OBJ    *Obj;            /* object entry with pending access          */
+    CO_IF_FRM  Req;            /* parked request                            */
+    uint8_t    State;          /* request state (CO_SDO_DEFER_xxx)          */
+    int16_t    Tmr;            /* completion timeout timer                  */
+} CO_SDO_PARK;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled deferred access */
+static CO_NODE            *DeferNode = 0;
+
+/* completion timeout in timer ticks */
+static uint32_t            DeferTicks = 0;
+
+/* registered object types with deferred access */
+static const CO_OBJ_TYPE  *DeferType[CO_SDO_DEFER_TYPES];
+
+/* parked requests of the SDO servers */
+static CO_SDO_PARK         DeferPark[CO_SSDO_N];
+
+/* request counters */
+static CO_SDO_DEFER_STAT   DeferStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint8_t COSdoDeferIsType(const CO_OBJ_TYPE *type)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_SDO_DEFER_TYPES; n++) {
+        if ((DeferType[n] != 0) && (DeferType[n] == type)) {
+            return (1u);
+        }
+    }
+    return (0u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK STACK SERVER
+*
+* \details  While the stack server runs a segmented or block transfer, the
+*           received frames are segments of this transfer. Their first byte
+*           may look like an initiate request (e.g. block sequence 0x20).
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t COSdoDeferSrvIdle(CO_SDO *srv)
+{
+    return (((srv->Seg.Size == 0) && (srv->Blk.State == BLK_IDLE)) ? 1u : 0u);
+}
+
+static void COSdoDeferTmrStop(CO_SDO_PARK *park)
+{
+    if (park->Tmr >= 0) {
+        (void)COTmrDelete(&DeferNode->Tmr, park->Tmr);
+        park->Tmr = -1;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  DROP PARKED REQUEST
+*
+* \details  The type is informed, that the pending access is not needed
+*           anymore. With a code, the transfer is aborted towards the
+*           client.
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoDeferDrop(CO_SDO_PARK *park, uint32_t code)
+{
+    CO_IF_FRM frm;
+
+    COSdoDeferTmrStop(park);
+    park->State = CO_SDO_DEFER_IDLE;
+    DeferStat.Aborted++;
+    if (park->Obj->Type->Ctrl != 0) {
+        (void)park->Obj->Type->Ctrl(park->Obj, DeferNode, CO_SDO_DEFER_CTRL_ABORT, code);
+    }
+    if (code != 0) {
+        memset(&frm, 0, sizeof(CO_IF_FRM));
+        CO_SET_ID  (&frm, park->Srv->TxId);
+        CO_SET_DLC (&frm, 8);
+        CO_SET_BYTE(&frm, 0x80u, 0);
+        CO_SET_WORD(&frm, CO_GET_WORD(&park->Req, 1), 1);
+        CO_SET_BYTE(&frm, CO_GET_BYTE(&park->Req, 3), 3);
+        CO_SET_LONG(&frm, code, 4);
+        (void)COIfCanSend(&DeferNode->If, &frm);
+    }
+}
+
+static void COSdoDeferTimeout(void *parg)
+{
+    CO_SDO_PARK *park = (CO_SDO_PARK *)parg;
+
+    park->Tmr = -1;                             /* one-shot timer is gone  */
+    if (park->State == CO_SDO_DEFER_WAIT) {
+        COSdoDeferDrop(park, CO_SDO_DEFER_ERR_TIMEOUT);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  PARK REQUEST
+*
+* \details  Initiate requests of uploads and downloads for objects with a
+*           registered type are offered to the control function of the
+*           type. All other frames are left to the stack. Without any
+*           registered type, the object is not searched.
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COSdoDeferStart(CO_SDO_PARK *park, CO_IF_FRM *frm)
+{
+    CO_OBJ  *obj;
+    CO_ERR   err;
+    uint16_t func;
+    uint8_t  cmd = CO_GET_BYTE(frm, 0);
+    uint8_t  num;
+    uint8_t  n;
+
+    if ((cmd == 0x40u) || ((cmd & 0xE3u) == 0xA0u)) {
+        func = CO_SDO_DEFER_CTRL_RD;            /* upload or block upload  */
+    } else if (((cmd & 0xE0u) == 0x20u) || ((cmd & 0xE1u) == 0xC0u)) {
+        func = CO_SDO_DEFER_CTRL_WR;            /* download or block dnld. */
+    } else {
+        return (0);
+    }
+    if (DeferType[0] == 0) {                    /* no registered type      */
+        return (0);
+    }
+    obj = CODictFind(&DeferNode->Dict, CO_DEV(CO_GET_WORD(frm, 1), CO_GET_BYTE(frm, 3)));
+    if ((obj == 0) || (obj->Type == 0) || (obj->Type->Ctrl == 0) ||
+        (COSdoDeferIsType(obj->Type) == 0)) {
+        return (0);
+    }
+    if (((func == CO_SDO_DEFER_CTRL_RD) && (CO_IS_READ(obj->Key)  == 0)) ||
+        ((func == CO_SDO_DEFER_CTRL_WR) && (CO_IS_WRITE(obj->Key) == 0))) {
+        return (0);                             /* aborted by the stack    */
+    }
+    err = obj->Type->Ctrl(obj, DeferNode, func, 0);
+    if (err != CO_SDO_DEFER_PENDING) {
+        return (0);
+    }
+
+    park->Obj   = obj;
+    park->State = CO_SDO_DEFER_WAIT;
+    memcpy(&park->Req, frm, sizeof(CO_IF_FRM));
+    park->Tmr   = COTmrCreate(&DeferNode->Tmr, DeferTicks, 0, COSdoDeferTimeout, park);
+    DeferStat.Parked++;
+    num = 0;
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (DeferPark[n].State != CO_SDO_DEFER_IDLE) {
+            num++;
+        }
+    }
+    if (num > DeferStat.MaxParked) {
+        DeferStat.MaxParked = num;
+    }
+    return (1);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COSdoDeferInit(CO_NODE *node)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        memset(&DeferPark[n], 0, sizeof(CO_SDO_PARK));
+        DeferPark[n].Tmr = -1;
+        if (node != 0) {
+            DeferPark[n].Srv = &node->Sdo[n];
+        }
+    }
+    for (n = 0; n < CO_SDO_DEFER_TYPES; n++) {
+        DeferType[n] = 0;
+    }
+    memset(&DeferStat, 0, sizeof(DeferStat));
+    if (node != 0) {
+        DeferTicks = COTmrGetTicks(&node->Tmr, (uint16_t)CO_SDO_DEFER_TIMEOUT, CO_TMR_UNIT_1MS);
+    }
+    DeferNode = node;
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoDeferType(const CO_OBJ_TYPE *type)
+{
+    uint8_t n;
+
+    if ((type == 0) || (type->Ctrl == 0)) {
+        return (-1);
+    }
+    for (n = 0; n < CO_SDO_DEFER_TYPES; n++) {
+        if ((DeferType[n] == 0) || (DeferType[n] == type)) {
+            DeferType[n] = type;
+            return (0);
+        }
+    }
+    return (-1);
+}
+
+/*
+* see function definition
+*/
+uint8_t COSdoDeferDone(CO_OBJ *obj, uint32_t code)
+{
+    CO_SDO_PARK *park;
+    uint8_t      num = 0;
+    uint8_t      n;
+
+    if ((DeferNode == 0) || (obj == 0)) {
+        return (0);
+    }
+    for (n = 0; n < CO_SSDO_N; n++) {
+        park = &DeferPark[n];
+        if ((park->State != CO_SDO_DEFER_WAIT) || (park->Obj != obj)) {
+            continue;
+        }
+        if (code == 0) {
+            COSdoDeferTmrStop(park);
+            park->State = CO_SDO_DEFER_READY;
+        } else {
+            COSdoDeferDrop(park, code);
+        }
+        num++;
+    }
+    return (num);
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoDeferReceive(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_SDO_PARK *park;
+    uint8_t      n;
+
+    if ((DeferNode == 0) || (cif != &DeferNode->If)) {
+        return (0);
+    }
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (CO_GET_ID(frm) == DeferNode->Sdo[n].RxId) {
+            break;
+        }
+    }
+    if (n >= CO_SSDO_N) {
+        return (0);
+    }
+    park = &DeferPark[n];
+
+    if (park->State == CO_SDO_DEFER_IDLE) {
+        if (COSdoDeferSrvIdle(park->Srv) == 0) {
+            return (0);                         /* transfer of the stack   */
+        }
+        return (COSdoDeferStart(park, frm));
+    }
+    if (CO_GET_BYTE(frm, 0) == 0x80u) {         /* abort by client         */
+        COSdoDeferDrop(park, 0);
+    } else {                                    /* client did not wait     */
+        COSdoDeferDrop(park, CO_SDO_DEFER_ERR_CMD);
+    }
+    return (1);
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoDeferReplay(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_SDO_PARK *park;
+    uint8_t      n;
+
+    if ((DeferNode == 0) || (cif != &DeferNode->If)) {
+        return (0);
+    }
+    for (n = 0; n < CO_SSDO_N; n++) {
+        park = &DeferPark[n];
+        if (park->State == CO_SDO_DEFER_READY) {
+            park->State = CO_SDO_DEFER_IDLE;
+            memcpy(frm, &park->Req, sizeof(CO_IF_FRM));
+            DeferStat.Replayed++;
+            return ((int16_t)sizeof(CO_IF_FRM));
+        }
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+const CO_SDO_DEFER_STAT *COSdoDeferStat(void)
+{
+    return (&DeferStat);
+}
@@ -0,0 +1,196 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_SDO_DEFER_H_
+#define CO_SDO_DEFER_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief DEFERRED TYPES
+*
+*    Maximal number of object types, which are registered with
+*    COSdoDeferType().
+*/
+#ifndef CO_SDO_DEFER_TYPES
+#define CO_SDO_DEFER_TYPES       4u
+#endif
+
+/*! \brief COMPLETION TIMEOUT
+*
+*    Time in ms, which a parked request waits for COSdoDeferDone(), before
+*    the transfer is aborted.
+*/
+#ifndef CO_SDO_DEFER_TIMEOUT
+#define CO_SDO_DEFER_TIMEOUT     1000u
+#endif
+
+/*! \brief PENDING OBJECT ACCESS
+*
+*    Return value of the control function of a deferred type, when the
+*    requested access is started but not ready yet. The value is outside
+*    of the stack error codes.
+*/
+#define CO_SDO_DEFER_PENDING     ((CO_ERR)0x7F)
+
+/* control functions of the deferred types */
+#define CO_SDO_DEFER_CTRL_RD     0x80u  /*!< prepare SDO upload of object   */
+#define CO_SDO_DEFER_CTRL_WR     0x81u  /*!< prepare SDO download of object */
+#define CO_SDO_DEFER_CTRL_ABORT  0x82u  /*!< parked access is dropped       */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief SDO DEFERRED ACCESS STATISTICS
+*
+*    Counters of the parked requests since COSdoDeferInit().
+*/
+typedef struct CO_SDO_DEFER_STAT_T {
+    uint32_t Parked;           /*!< requests parked by a pending access     */
+    uint32_t Replayed;         /*!< completed requests passed to the stack  */
+    uint32_t Aborted;          /*!< aborted, dropped or timed out requests  */
+    uint8_t  MaxParked;        /*!< maximal number of parked requests       */
+} CO_SDO_DEFER_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT SDO DEFERRED ACCESS
+*
+* \details  This function enables the deferred object access for the SDO
+*           servers of the given node and clears the registered types. It
+*           must be called after CONodeInit().
+*
+*           Before an SDO server sees an upload or download request for an
+*           object with a registered type, the control function of the type
+*           is called with CO_SDO_DEFER_CTRL_RD or CO_SDO_DEFER_CTRL_WR.
+*           The return value CO_SDO_DEFER_PENDING parks the request of this
+*           server; the other servers and all other services keep running.
+*           After COSdoDeferDone(), the request is passed to the stack with
+*           the next call of CONodeProcess() and the type functions are
+*           called as usual. Any other return value passes the request to
+*           the stack immediately.
+*
+* \param    node
+*           reference to the node; NULL disables the deferred access
+*/
+/*---------------------------------------------------------------------------*/
+void COSdoDeferInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REGISTER DEFERRED TYPE
+*
+* \details  This function registers an object type with deferred access.
+*           The type must provide a control function, which understands
+*           the functions CO_SDO_DEFER_CTRL_xxx.
+*
+* \param    type
+*           reference to the object type
+*
+* \retval   =0    type is registered
+* \retval   <0    bad type or no free entry
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COSdoDeferType(const CO_OBJ_TYPE *type);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  COMPLETE DEFERRED ACCESS
+*
+* \details  This function completes all parked requests for the given
+*           object entry. With code 0, the requests are passed to the
+*           stack; the type functions must now answer without delay. Any
+*           other code aborts the transfers with this SDO abort code. The
+*           function must be called in the context of CONodeProcess().
+*
+* \param    obj
+*           reference to the object entry
+*
+* \param    code
+*           0 for success, SDO abort code otherwise
+*
+* \return   number of completed requests
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t COSdoDeferDone(CO_OBJ *obj, uint32_t code);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE SDO REQUEST
+*
+* \details  This function parks the requests with pending object access and
+*           handles the frames of the clients with a parked request. A
+*           request is parked only while the stack server has no segmented
+*           or block transfer running. It is called by the receive wrapper
+*           for every read frame.
+*
+* \param    cif
+*           reference to the CAN interface
+*
+* \param    frm
+*           received frame
+*
+* \retval   =1    request parked or handled (frame consumed)
+* \retval   =0    frame is left to the stack
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COSdoDeferReceive(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  REPLAY COMPLETED REQUEST
+*
+* \details  This function returns the next completed request. It is called
+*           by the receive wrapper, when no frame is received.
+*
+* \param    cif
+*           reference to the CAN interface
+*
+* \param    frm
+*           frame for the completed request
+*
+* \retval   >0    size of the frame (request returned)
+* \retval   =0    no completed request
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COSdoDeferReplay(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SDO DEFERRED ACCESS STATISTICS
+*
+* \details  This function returns the counters of the parked requests.
+*
+* \return   reference to the statistics
+*/
+/*---------------------------------------------------------------------------*/
+const CO_SDO_DEFER_STAT *COSdoDeferStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,368 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_sdo_pool.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* transfer phase of a server with leased buffer */
+#define CO_SDO_POOL_IDLE       0u    /* no transfer, no buffer              */
+#define CO_SDO_POOL_SEG_DN     1u    /* segmented download                  */
+#define CO_SDO_POOL_UP         2u    /* upload, type given by the response  */
+#define CO_SDO_POOL_SEG_UP     3u    /* segmented upload                    */
+#define CO_SDO_POOL_BLK_DN     4u    /* block download                      */
+#define CO_SDO_POOL_BLK_UP     5u    /* block upload                        */
+#define CO_SDO_POOL_DONE       6u    /* return buffer with the next frame   */
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* buffer lease of an SDO server */
+typedef struct CO_SDO_LEASE_T {
+    uint8_t *Buf;              /* leased buffer                             */
+    uint8_t  State;            /* transfer phase (CO_SDO_POOL_xxx)          */
+} CO_SDO_LEASE;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled pool and number of finished leases */
+static CO_NODE          *PoolNode = 0;
+static uint8_t           PoolDone = 0;
+
+/* buffer memory and usage */
+static uint8_t           PoolMem[CO_SDO_POOL_NUM][CO_SDO_BUF_BYTE];
+static uint8_t           PoolUse[CO_SDO_POOL_NUM];
+
+/* buffer lease of the SDO servers */
+static CO_SDO_LEASE      PoolLease[CO_SSDO_N];
+
+/* pool counters */
+static CO_SDO_POOL_STAT  PoolStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  TAKE BUFFER FROM POOL
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t *COSdoPoolTake(void)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_SDO_POOL_NUM; n++) {
+        if (PoolUse[n] == 0) {
+            PoolUse[n] = 1;
+            PoolStat.Used++;
+            if (PoolStat.Used > PoolStat.MaxUsed) {
+                PoolStat.MaxUsed = PoolStat.Used;
+            }
+            return (&PoolMem[n][0]);
+        }
+    }
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GIVE BUFFER BACK TO POOL
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoPoolGive(uint8_t *buf)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_SDO_POOL_NUM; n++) {
+        if ((buf == &PoolMem[n][0]) && (PoolUse[n] != 0)) {
+            PoolUse[n] = 0;
+            PoolStat.Used--;
+            return;
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RETURN BUFFERS OF FINISHED TRANSFERS
+*
+* \details  The buffers are returned with the next received frame, after
+*           the stack has processed the last request of the transfer.
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoPoolRelease(void)
+{
+    CO_SDO_LEASE *lease;
+    CO_SDO       *srv;
+    uint8_t       n;
+
+    for (n = 0; (n < CO_SSDO_N) && (PoolDone > 0); n++) {
+        lease = &PoolLease[n];
+        if (lease->State != CO_SDO_POOL_DONE) {
+            continue;
+        }
+        srv            = &PoolNode->Sdo[n];
+        srv->Buf.Start = 0;
+        srv->Buf.Cur   = 0;
+        srv->Buf.Num   = 0;
+        COSdoPoolGive(lease->Buf);
+        lease->Buf     = 0;
+        lease->State   = CO_SDO_POOL_IDLE;
+        PoolDone--;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FINISH LEASE
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoPoolDone(CO_SDO_LEASE *lease)
+{
+    if ((lease->Buf != 0) && (lease->State != CO_SDO_POOL_DONE)) {
+        lease->State = CO_SDO_POOL_DONE;
+        PoolDone++;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  TRANSFER PHASE OF AN INITIATE REQUEST
+*
+* \details  Expedited downloads and all other requests need no buffer.
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t COSdoPoolInitiate(uint8_t cmd)
+{
+    if (((cmd & 0xE0u) == 0x20u) && ((cmd & 0x02u) == 0)) {
+        return (CO_SDO_POOL_SEG_DN);
+    } else if ((cmd & 0xE0u) == 0x40u) {
+        return (CO_SDO_POOL_UP);
+    } else if ((cmd & 0xE1u) == 0xC0u) {
+        return (CO_SDO_POOL_BLK_DN);
+    } else if ((cmd & 0xE3u) == 0xA0u) {
+        return (CO_SDO_POOL_UP);
+    }
+    return (CO_SDO_POOL_IDLE);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ABORT REQUEST WITH EXHAUSTED POOL
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoPoolAbort(CO_SDO *srv, CO_IF_FRM *req)
+{
+    CO_IF_FRM frm;
+
+    memset(&frm, 0, sizeof(CO_IF_FRM));
+    CO_SET_ID  (&frm, srv->TxId);
+    CO_SET_DLC (&frm, 8);
+    CO_SET_BYTE(&frm, 0x80u, 0);
+    CO_SET_WORD(&frm, CO_GET_WORD(req, 1), 1);
+    CO_SET_BYTE(&frm, CO_GET_BYTE(req, 3), 3);
+    CO_SET_LONG(&frm, CO_SDO_POOL_ERR_MEM, 4);
+    (void)COIfCanSend(&PoolNode->If, &frm);
+    PoolStat.Exhausted++;
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COSdoPoolInit(CO_NODE *node)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        PoolLease[n].Buf   = 0;
+        PoolLease[n].State = CO_SDO_POOL_IDLE;
+        if (node != 0) {
+            node->Sdo[n].Buf.Start = 0;
+            node->Sdo[n].Buf.Cur   = 0;
+            node->Sdo[n].Buf.Num   = 0;
+        }
+    }
+    memset(PoolUse, 0, sizeof(PoolUse));
+    memset(&PoolStat, 0, sizeof(PoolStat));
+    PoolDone = 0;
+    PoolNode = node;
+}
+
+/*
+* see function definition
+*/
+uint8_t *COSdoPoolAlloc(void)
+{
+    uint8_t *buf;
+
+    if (PoolNode == 0) {
+        return (0);
+    }
+    buf = COSdoPoolTake();
+    if (buf != 0) {
+        PoolStat.Allocs++;
+    }
+    return (buf);
+}
+
+/*
+* see function definition
+*/
+void COSdoPoolFree(uint8_t *buf)
+{
+    if ((PoolNode == 0) || (buf == 0)) {
+        return;
+    }
+    COSdoPoolGive(buf);
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoPoolReceive(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_SDO_LEASE *lease;
+    CO_SDO       *srv;
+    uint8_t       cmd;
+    uint8_t       state;
+    uint8_t       n;
+
+    if ((PoolNode == 0) || (cif != &PoolNode->If)) {
+        return (0);
+    }
+    if (PoolDone > 0) {
+        COSdoPoolRelease();
+    }
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (CO_GET_ID(frm) == PoolNode->Sdo[n].RxId) {
+            break;
+        }
+    }
+    if (n >= CO_SSDO_N) {
+        return (0);
+    }
+    srv   = &PoolNode->Sdo[n];
+    lease = &PoolLease[n];
+    cmd   = CO_GET_BYTE(frm, 0);
+
+    if (cmd == 0x80u) {                         /* abort by client         */
+        COSdoPoolDone(lease);
+        return (0);
+    }
+    if (lease->State == CO_SDO_POOL_BLK_DN) {   /* sequence numbers only   */
+        return (0);
+    }
+    if (lease->State == CO_SDO_POOL_BLK_UP) {
+        if (cmd == 0xA1u) {                     /* end of block upload     */
+            COSdoPoolDone(lease);
+        }
+        return (0);
+    }
+    if ((lease->State == CO_SDO_POOL_SEG_DN) &&
+        ((cmd & 0xE0u) == 0x00u) && ((cmd & 0x01u) != 0)) {
+        COSdoPoolDone(lease);                   /* last download segment   */
+        return (0);
+    }
+
+    state = COSdoPoolInitiate(cmd);
+    if ((state == CO_SDO_POOL_IDLE) && ((cmd & 0xE0u) == 0x20u)) {
+        COSdoPoolDone(lease);                   /* expedited download      */
+        return (0);
+    }
+    if (state == CO_SDO_POOL_IDLE) {
+        return (0);
+    }
+    if ((lease->Buf == 0) || (lease->State == CO_SDO_POOL_DONE) ||
+        (srv->Buf.Start != lease->Buf)) {       /* or reset by the stack   */
+        if (lease->Buf == 0) {
+            lease->Buf = COSdoPoolTake();
+            if (lease->Buf == 0) {
+                COSdoPoolAbort(srv, frm);
+                return (1);
+            }
+            PoolStat.Leases++;
+        } else if (lease->State == CO_SDO_POOL_DONE) {
+            PoolDone--;                         /* restarted by the client */
+        }
+        srv->Buf.Start = lease->Buf;
+        srv->Buf.Cur   = lease->Buf;
+        srv->Buf.Num   = 0;
+    }
+    lease->State = state;
+    return (0);
+}
+
+/*
+* see function definition
+*/
+void COSdoPoolSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_SDO_LEASE *lease;
+    uint8_t       cmd;
+    uint8_t       n;
+
+    if ((PoolNode == 0) || (cif != &PoolNode->If)) {
+        return;
+    }
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (CO_GET_ID(frm) == PoolNode->Sdo[n].TxId) {
+            break;
+        }
+    }
+    if ((n >= CO_SSDO_N) || (PoolLease[n].Buf == 0)) {
+        return;
+    }
+    lease = &PoolLease[n];
+    cmd   = CO_GET_BYTE(frm, 0);
+
+    if (cmd == 0x80u) {                         /* abort by server         */
+        COSdoPoolDone(lease);
+    } else if (lease->State == CO_SDO_POOL_UP) {
+        if ((cmd & 0xE0u) == 0xC0u) {
+            lease->State = CO_SDO_POOL_BLK_UP;
+        } else if ((cmd & 0xE2u) == 0x42u) {
+            COSdoPoolDone(lease);               /* expedited upload        */
+        } else {
+            lease->State = CO_SDO_POOL_SEG_UP;
+        }
+    } else if (lease->State == CO_SDO_POOL_SEG_UP) {
+        if (((cmd & 0xE0u) == 0x00u) && ((cmd & 0x01u) != 0)) {
+            COSdoPoolDone(lease);               /* last upload segment     */
+        }
+    } else if (lease->State == CO_SDO_POOL_BLK_DN) {
+        if (cmd == 0xA1u) {                     /* end of block download   */
+            COSdoPoolDone(lease);
+        }
+    }
+}
+
+/*
+* see function definition
+*/
+const CO_SDO_POOL_STAT *COSdoPoolStat(void)
+{
+    return (&PoolStat);
+}
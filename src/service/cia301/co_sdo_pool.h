@@ -0,0 +1,172 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_SDO_POOL_H_
+#define CO_SDO_POOL_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief NUMBER OF POOL BUFFERS
+*
+*    Number of transfer buffers with CO_SDO_BUF_BYTE bytes, which are shared
+*    by all SDO servers and the application. This is the maximum number of
+*    concurrent segmented and block transfers of the servers.
+*/
+#ifndef CO_SDO_POOL_NUM
+#define CO_SDO_POOL_NUM        2u
+#endif
+
+/*! \brief POOL EXHAUSTED
+*
+*    Abort code of transfers, which are rejected, because no pool buffer is
+*    free (out of memory).
+*/
+#define CO_SDO_POOL_ERR_MEM    0x05040005u
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief SDO BUFFER POOL STATISTICS
+*
+*    Counters of the buffer pool since COSdoPoolInit().
+*/
+typedef struct CO_SDO_POOL_STAT_T {
+    uint32_t Leases;           /*!< buffers leased to servers               */
+    uint32_t Allocs;           /*!< buffers allocated by the application    */
+    uint32_t Exhausted;        /*!< transfers aborted with an empty pool    */
+    uint8_t  Used;             /*!< buffers in use                          */
+    uint8_t  MaxUsed;          /*!< maximum of buffers in use               */
+} CO_SDO_POOL_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT SDO BUFFER POOL
+*
+* \details  This function enables the buffer pool for the SDO servers of
+*           the given node. It must be called after CONodeInit(). The
+*           servers get a buffer from the pool with the initiation of a
+*           segmented or block transfer and return it after the end or
+*           abort of the transfer. Expedited transfers need no buffer. The
+*           server buffers in CO_NODE_SPEC.SdoBuf are not used anymore; the
+*           application may drop them and set CO_NODE_SPEC.SdoBuf to NULL.
+*           The SDO clients are not leased; an application, which wants to
+*           share the pool with a client, passes a buffer of COSdoPoolAlloc()
+*           to the client request.
+*
+*           A transfer, which is initiated while all buffers are in use, is
+*           aborted with CO_SDO_POOL_ERR_MEM before the stack sees the
+*           request. Therefore the pool is disabled by default (CMake option
+*           CO_SDO_POOL) and CO_SDO_POOL_NUM should cover the expected
+*           number of concurrent transfers.
+*
+* \param    node
+*           reference to the node; NULL disables the pool
+*/
+/*---------------------------------------------------------------------------*/
+void COSdoPoolInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ALLOCATE POOL BUFFER
+*
+* \details  This function leases a buffer with CO_SDO_BUF_BYTE bytes to the
+*           application, e.g. as transfer buffer of an SDO client request.
+*           The buffer is shared with the SDO servers and must be returned
+*           with COSdoPoolFree() after the transfer.
+*
+* \retval   >0    reference to the buffer
+* \retval   =0    pool disabled or exhausted
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t *COSdoPoolAlloc(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FREE POOL BUFFER
+*
+* \details  This function returns a buffer of COSdoPoolAlloc() to the pool.
+*
+* \param    buf
+*           reference to the buffer
+*/
+/*---------------------------------------------------------------------------*/
+void COSdoPoolFree(uint8_t *buf);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE SDO REQUEST
+*
+* \details  This function follows the requests to the SDO servers. Buffers
+*           of finished transfers are returned to the pool, before a buffer
+*           is leased to a server with the initiation of a transfer. It is
+*           called by the receive wrapper for every read frame.
+*
+* \param    cif
+*           reference to the CAN interface
+*
+* \param    frm
+*           received frame
+*
+* \retval   =1    request aborted with an exhausted pool (frame consumed)
+* \retval   =0    frame is left to the stack
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COSdoPoolReceive(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND SDO RESPONSE
+*
+* \details  This function follows the responses of the SDO servers to
+*           detect the end of the transfers. With CO_SDO_POOL_WRAP, the
+*           function is called by the transmit wrapper for every sent frame.
+*
+* \param    cif
+*           reference to the CAN interface
+*
+* \param    frm
+*           frame to send
+*/
+/*---------------------------------------------------------------------------*/
+void COSdoPoolSend(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SDO BUFFER POOL STATISTICS
+*
+* \details  This function returns the counters of the buffer pool.
+*
+* \return   reference to the statistics
+*/
+/*---------------------------------------------------------------------------*/
+const CO_SDO_POOL_STAT *COSdoPoolStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
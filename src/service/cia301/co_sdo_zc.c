@@ -0,0 +1,421 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_sdo_zc.h"
+#include "co_crc16.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* upload state of a server */
+#define CO_SDO_ZC_IDLE         0u    /* no zero-copy upload                 */
+#define CO_SDO_ZC_SEG          1u    /* wait for segment request            */
+#define CO_SDO_ZC_BLK_INIT     2u    /* wait for start of block upload      */
+#define CO_SDO_ZC_BLK_ACK      3u    /* wait for block acknowledge          */
+#define CO_SDO_ZC_BLK_END      4u    /* wait for end response               */
+
+/* SDO abort codes */
+#define CO_SDO_ZC_ERR_TOGGLE   0x05030000u
+#define CO_SDO_ZC_ERR_TIMEOUT  0x05040000u
+#define CO_SDO_ZC_ERR_CMD      0x05040001u
+#define CO_SDO_ZC_ERR_BLKSIZE  0x05040002u
+#define CO_SDO_ZC_ERR_SEQ      0x05040003u
+
+/* data bytes of a segment */
+#define CO_SDO_ZC_SEG_LEN      7u
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* zero-copy upload of an SDO server */
+typedef struct CO_SDO_ZC_T {
+    CO_SDO        *Srv;        /* SDO server                                */
+    const uint8_t *Data;       /* object memory                             */
+    uint32_t       Size;       /* object size in bytes                      */
+    uint32_t       Pos;        /* sent (segmented) or acknowledged bytes    */
+    uint16_t       Idx;        /* object index                              */
+    uint8_t        Sub;        /* object subindex                           */
+    uint8_t        State;      /* upload state (CO_SDO_ZC_xxx)              */
+    uint8_t        Toggle;     /* expected toggle bit of segmented upload   */
+    uint8_t        BlkSize;    /* segments per block                        */
+    uint8_t        Seq;        /* segments sent in current block            */
+    uint8_t        Crc;        /* CRC agreed with the client                */
+    int16_t        Tmr;        /* response timeout timer                    */
+} CO_SDO_ZC;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled zero-copy upload */
+static CO_NODE         *ZcNode = 0;
+
+/* response timeout in timer ticks */
+static uint32_t         ZcTicks = 0;
+
+/* zero-copy upload of the SDO servers */
+static CO_SDO_ZC        ZcSrv[CO_SSDO_N];
+
+/* upload counters */
+static CO_SDO_ZC_STAT   ZcStat;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void COSdoZcFrm(CO_SDO_ZC *zc, CO_IF_FRM *frm, uint8_t cmd)
+{
+    memset(frm, 0, sizeof(CO_IF_FRM));
+    CO_SET_ID  (frm, zc->Srv->TxId);
+    CO_SET_DLC (frm, 8);
+    CO_SET_BYTE(frm, cmd, 0);
+}
+
+static void COSdoZcMux(CO_SDO_ZC *zc, CO_IF_FRM *frm)
+{
+    CO_SET_WORD(frm, zc->Idx, 1);
+    CO_SET_BYTE(frm, zc->Sub, 3);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FINISH UPLOAD
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoZcFinish(CO_SDO_ZC *zc, uint32_t code)
+{
+    if (zc->Tmr >= 0) {
+        (void)COTmrDelete(&ZcNode->Tmr, zc->Tmr);
+        zc->Tmr = -1;
+    }
+    zc->State = CO_SDO_ZC_IDLE;
+    if (code == 0) {
+        ZcStat.Transfers++;
+        ZcStat.Bytes += zc->Size;
+    } else {
+        ZcStat.Aborted++;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  ABORT UPLOAD
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoZcAbort(CO_SDO_ZC *zc, uint32_t code)
+{
+    CO_IF_FRM frm;
+
+    COSdoZcFrm(zc, &frm, 0x80u);
+    COSdoZcMux(zc, &frm);
+    CO_SET_LONG(&frm, code, 4);
+    (void)COIfCanSend(&ZcNode->If, &frm);
+    COSdoZcFinish(zc, code);
+}
+
+static void COSdoZcTimeout(void *parg)
+{
+    CO_SDO_ZC *zc = (CO_SDO_ZC *)parg;
+
+    zc->Tmr = -1;                               /* one-shot timer is gone  */
+    if (zc->State != CO_SDO_ZC_IDLE) {
+        COSdoZcAbort(zc, CO_SDO_ZC_ERR_TIMEOUT);
+    }
+}
+
+static void COSdoZcTmrStart(CO_SDO_ZC *zc)
+{
+    if (zc->Tmr >= 0) {
+        (void)COTmrDelete(&ZcNode->Tmr, zc->Tmr);
+    }
+    zc->Tmr = COTmrCreate(&ZcNode->Tmr, ZcTicks, 0, COSdoZcTimeout, zc);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK STACK SERVER
+*
+* \details  While the stack server runs a segmented or block transfer, the
+*           received frames are segments of this transfer. Their first byte
+*           may look like an initiate request (e.g. block sequence 0x40).
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t COSdoZcSrvIdle(CO_SDO *srv)
+{
+    return (((srv->Seg.Size == 0) && (srv->Blk.State == BLK_IDLE)) ? 1u : 0u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  START UPLOAD
+*
+* \details  Uploads of readable domains and strings with more than 4 bytes
+*           are started; all other requests are left to the stack, which
+*           answers them or aborts them with the correct abort code.
+*/
+/*---------------------------------------------------------------------------*/
+static int16_t COSdoZcStart(CO_SDO_ZC *zc, CO_IF_FRM *frm)
+{
+    CO_IF_FRM   rsp;
+    CO_OBJ     *obj;
+    CO_OBJ_DOM *dom;
+    CO_OBJ_STR *str;
+    uint8_t     cmd   = CO_GET_BYTE(frm, 0);
+    uint8_t     block = ((cmd & 0xE3u) == 0xA0u) ? 1u : 0u;
+    uint8_t     size  = CO_GET_BYTE(frm, 4);
+
+    if ((cmd != 0x40u) && (block == 0)) {
+        return (0);
+    }
+    if ((block != 0) && ((size == 0) || (size > 127u))) {
+        return (0);
+    }
+    zc->Idx = CO_GET_WORD(frm, 1);
+    zc->Sub = CO_GET_BYTE(frm, 3);
+    obj     = CODictFind(&ZcNode->Dict, CO_DEV(zc->Idx, zc->Sub));
+    if ((obj == 0) || (CO_IS_READ(obj->Key) == 0)) {
+        return (0);
+    }
+    if (obj->Type == CO_TDOMAIN) {
+        dom = (CO_OBJ_DOM *)obj->Data;
+        if ((dom == 0) || (dom->Start == 0)) {
+            return (0);
+        }
+        zc->Data = dom->Start;
+        zc->Size = dom->Size;
+    } else if (obj->Type == CO_TSTRING) {
+        str = (CO_OBJ_STR *)obj->Data;
+        if ((str == 0) || (str->Start == 0)) {
+            return (0);
+        }
+        zc->Data = str->Start;
+        zc->Size = (uint32_t)strlen((const char *)str->Start);
+    } else {
+        return (0);
+    }
+    if (zc->Size <= 4u) {                       /* expedited by the stack  */
+        return (0);
+    }
+
+    zc->Pos = 0;
+    if (block != 0) {
+        zc->Crc     = ((cmd & 0x04u) != 0) ? 1u : 0u;
+        zc->BlkSize = size;
+        zc->State   = CO_SDO_ZC_BLK_INIT;
+        COSdoZcFrm(zc, &rsp, (zc->Crc != 0) ? 0xC6u : 0xC2u);
+    } else {
+        zc->Toggle  = 0;
+        zc->State   = CO_SDO_ZC_SEG;
+        COSdoZcFrm(zc, &rsp, 0x41u);
+    }
+    COSdoZcMux(zc, &rsp);
+    CO_SET_LONG(&rsp, zc->Size, 4);
+    (void)COIfCanSend(&ZcNode->If, &rsp);
+    COSdoZcTmrStart(zc);
+    return (1);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEGMENTED UPLOAD
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoZcSegUp(CO_SDO_ZC *zc, uint8_t cmd)
+{
+    CO_IF_FRM frm;
+    uint8_t   n;
+    uint8_t   last;
+
+    if ((cmd & 0x10u) != zc->Toggle) {
+        COSdoZcAbort(zc, CO_SDO_ZC_ERR_TOGGLE);
+        return;
+    }
+    n        = COSdoZcSegment(&frm, &zc->Data[zc->Pos], zc->Size - zc->Pos);
+    zc->Pos += n;
+    last     = (zc->Pos >= zc->Size) ? 1u : 0u;
+    CO_SET_ID  (&frm, zc->Srv->TxId);
+    CO_SET_DLC (&frm, 8);
+    CO_SET_BYTE(&frm, (uint8_t)(zc->Toggle | ((CO_SDO_ZC_SEG_LEN - n) << 1) | last), 0);
+    (void)COIfCanSend(&ZcNode->If, &frm);
+    ZcStat.Copied += n;
+    zc->Toggle ^= 0x10u;
+    if (last != 0) {
+        COSdoZcFinish(zc, 0);
+    } else {
+        COSdoZcTmrStart(zc);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND UPLOAD BLOCK
+*
+* \details  The segments are filled from the object memory, starting at the
+*           last acknowledged byte. Lost segments are repeated this way
+*           without any buffer.
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoZcBlock(CO_SDO_ZC *zc)
+{
+    CO_IF_FRM frm;
+    uint32_t  pos = zc->Pos;
+    uint8_t   seq = 0;
+    uint8_t   n;
+
+    while ((seq < zc->BlkSize) && (pos < zc->Size)) {
+        seq++;
+        n    = COSdoZcSegment(&frm, &zc->Data[pos], zc->Size - pos);
+        pos += n;
+        CO_SET_ID  (&frm, zc->Srv->TxId);
+        CO_SET_DLC (&frm, 8);
+        CO_SET_BYTE(&frm, (pos >= zc->Size) ? (uint8_t)(0x80u | seq) : seq, 0);
+        (void)COIfCanSend(&ZcNode->If, &frm);
+        ZcStat.Copied += n;
+    }
+    zc->Seq   = seq;
+    zc->State = CO_SDO_ZC_BLK_ACK;
+    COSdoZcTmrStart(zc);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BLOCK ACKNOWLEDGE
+*/
+/*---------------------------------------------------------------------------*/
+static void COSdoZcBlkAck(CO_SDO_ZC *zc, CO_IF_FRM *frm)
+{
+    CO_IF_FRM rsp;
+    uint8_t   ack  = CO_GET_BYTE(frm, 1);
+    uint8_t   size = CO_GET_BYTE(frm, 2);
+    uint8_t   n;
+
+    if (ack > zc->Seq) {
+        COSdoZcAbort(zc, CO_SDO_ZC_ERR_SEQ);
+        return;
+    }
+    if ((size == 0) || (size > 127u)) {
+        COSdoZcAbort(zc, CO_SDO_ZC_ERR_BLKSIZE);
+        return;
+    }
+    zc->Pos += (uint32_t)ack * CO_SDO_ZC_SEG_LEN;
+    if (zc->Pos < zc->Size) {
+        zc->BlkSize = size;
+        COSdoZcBlock(zc);
+        return;
+    }
+    zc->Pos = zc->Size;
+    n       = (uint8_t)((CO_SDO_ZC_SEG_LEN - (zc->Size % CO_SDO_ZC_SEG_LEN)) % CO_SDO_ZC_SEG_LEN);
+    COSdoZcFrm(zc, &rsp, (uint8_t)(0xC1u | (n << 2)));
+    if (zc->Crc != 0) {
+        CO_SET_WORD(&rsp, COCrc16(0, zc->Data, zc->Size), 1);
+    }
+    (void)COIfCanSend(&ZcNode->If, &rsp);
+    zc->State = CO_SDO_ZC_BLK_END;
+    COSdoZcTmrStart(zc);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COSdoZcInit(CO_NODE *node)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        memset(&ZcSrv[n], 0, sizeof(CO_SDO_ZC));
+        ZcSrv[n].Tmr = -1;
+        if (node != 0) {
+            ZcSrv[n].Srv = &node->Sdo[n];
+        }
+    }
+    memset(&ZcStat, 0, sizeof(ZcStat));
+    if (node != 0) {
+        ZcTicks = COTmrGetTicks(&node->Tmr, (uint16_t)CO_SDO_ZC_TIMEOUT, CO_TMR_UNIT_1MS);
+    }
+    ZcNode = node;
+}
+
+/*
+* see function definition
+*/
+uint8_t COSdoZcSegment(CO_IF_FRM *frm, const uint8_t *data, uint32_t len)
+{
+    if (len >= CO_SDO_ZC_SEG_LEN) {             /* fixed size copy         */
+        memcpy(&frm->Data[1], data, CO_SDO_ZC_SEG_LEN);
+        return ((uint8_t)CO_SDO_ZC_SEG_LEN);
+    }
+    memset(&frm->Data[1], 0, CO_SDO_ZC_SEG_LEN);
+    memcpy(&frm->Data[1], data, len);
+    return ((uint8_t)len);
+}
+
+/*
+* see function definition
+*/
+int16_t COSdoZcReceive(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_SDO_ZC *zc;
+    uint8_t    cmd;
+    uint8_t    n;
+
+    if ((ZcNode == 0) || (cif != &ZcNode->If)) {
+        return (0);
+    }
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (CO_GET_ID(frm) == ZcNode->Sdo[n].RxId) {
+            break;
+        }
+    }
+    if (n >= CO_SSDO_N) {
+        return (0);
+    }
+    zc  = &ZcSrv[n];
+    cmd = CO_GET_BYTE(frm, 0);
+
+    if (zc->State == CO_SDO_ZC_IDLE) {
+        if (COSdoZcSrvIdle(zc->Srv) == 0) {
+            return (0);                         /* transfer of the stack   */
+        }
+        return (COSdoZcStart(zc, frm));
+    }
+    if (cmd == 0x80u) {                         /* abort by client         */
+        COSdoZcFinish(zc, CO_GET_LONG(frm, 4));
+    } else if ((zc->State == CO_SDO_ZC_SEG) && ((cmd & 0xEFu) == 0x60u)) {
+        COSdoZcSegUp(zc, cmd);
+    } else if ((zc->State == CO_SDO_ZC_BLK_INIT) && (cmd == 0xA3u)) {
+        COSdoZcBlock(zc);
+    } else if ((zc->State == CO_SDO_ZC_BLK_ACK) && (cmd == 0xA2u)) {
+        COSdoZcBlkAck(zc, frm);
+    } else if ((zc->State == CO_SDO_ZC_BLK_END) && (cmd == 0xA1u)) {
+        COSdoZcFinish(zc, 0);
+    } else {
+        COSdoZcAbort(zc, CO_SDO_ZC_ERR_CMD);
+    }
+    return (1);
+}
+
+/*
+* see function definition
+*/
+const CO_SDO_ZC_STAT *COSdoZcStat(void)
+{
+    return (&ZcStat);
+}
@@ -0,0 +1,139 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_SDO_ZC_H_
+#define CO_SDO_ZC_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief RESPONSE TIMEOUT
+*
+*    Time in ms, which the server waits for the next request of a running
+*    zero-copy upload, before the transfer is aborted.
+*/
+#ifndef CO_SDO_ZC_TIMEOUT
+#define CO_SDO_ZC_TIMEOUT      1000u
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief SDO ZERO-COPY UPLOAD STATISTICS
+*
+*    Counters of the zero-copy uploads since COSdoZcInit(). The ratio of
+*    Copied to Bytes is the number of copied bytes per payload byte; it is
+*    above 1 only by repeated block segments.
+*/
+typedef struct CO_SDO_ZC_STAT_T {
+    uint32_t Transfers;        /*!< successfully finished uploads           */
+    uint32_t Aborted;          /*!< aborted or timed out uploads            */
+    uint32_t Bytes;            /*!< payload of the finished uploads         */
+    uint32_t Copied;           /*!< bytes copied into segments              */
+} CO_SDO_ZC_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT SDO ZERO-COPY UPLOAD
+*
+* \details  This function enables the zero-copy upload for the SDO servers
+*           of the given node. It must be called after CONodeInit().
+*           Segmented and block uploads of readable domains (CO_TDOMAIN)
+*           and visible strings (CO_TSTRING) with more than 4 bytes are
+*           answered before the stack sees the request. The segments are
+*           filled directly from the object memory, without the SDO buffer
+*           of the server. The memory is read while the transfer runs and
+*           must not be changed by the application in the meantime.
+*
+*           All other requests are left to the stack.
+*
+* \param    node
+*           reference to the node; NULL disables the zero-copy upload
+*/
+/*---------------------------------------------------------------------------*/
+void COSdoZcInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FILL UPLOAD SEGMENT
+*
+* \details  This function copies up to 7 bytes of the object memory into
+*           the data bytes 1..7 of the segment frame. Unused bytes are
+*           cleared.
+*
+* \param    frm
+*           segment frame
+*
+* \param    data
+*           object memory at the segment position
+*
+* \param    len
+*           remaining bytes of the object
+*
+* \return   number of copied bytes (1..7)
+*/
+/*---------------------------------------------------------------------------*/
+uint8_t COSdoZcSegment(CO_IF_FRM *frm, const uint8_t *data, uint32_t len);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  RECEIVE SDO REQUEST
+*
+* \details  This function answers the upload requests of the zero-copy
+*           transfers. An upload is started only while the stack server has
+*           no segmented or block transfer running. It is called by the
+*           receive wrapper for every read frame.
+*
+* \param    cif
+*           reference to the CAN interface
+*
+* \param    frm
+*           received frame
+*
+* \retval   =1    request handled (frame consumed)
+* \retval   =0    frame is left to the stack
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COSdoZcReceive(CO_IF *cif, CO_IF_FRM *frm);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SDO ZERO-COPY UPLOAD STATISTICS
+*
+* \details  This function returns the counters of the zero-copy uploads.
+*
+* \return   reference to the statistics
+*/
+/*---------------------------------------------------------------------------*/
+const CO_SDO_ZC_STAT *COSdoZcStat(void);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_sync_pipe.h"
+#if CO_PDO_SHADOW_WRAP
+#include "co_pdo_shadow.h"
+#endif
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled SYNC pipeline */
+static CO_NODE *PipeNode = 0;
+
+/* batch send function and tick counter of the application */
+static CO_SYNC_PIPE_SEND  PipeSend  = 0;
+static CO_SYNC_PIPE_CLOCK PipeClock = 0;
+
+/* frames of the synchronous TPDOs, collected during SYNC handling */
+static CO_IF_FRM PipeFrm[CO_SYNC_PIPE_FRM_N];
+static uint8_t   PipeNum    = 0;
+static uint8_t   PipeActive = 0;
+
+/* pipeline statistics */
+static CO_SYNC_PIPE_STAT PipeStat;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COSyncPipeInit(CO_NODE *node, CO_SYNC_PIPE_SEND send, CO_SYNC_PIPE_CLOCK clock)
+{
+    PipeStat.Last     = 0;
+    PipeStat.Max      = 0;
+    PipeStat.Cycles   = 0;
+    PipeStat.Frames   = 0;
+    PipeStat.Overflow = 0;
+    PipeNum           = 0;
+    PipeActive        = 0;
+    PipeSend          = send;
+    PipeClock         = clock;
+    PipeNode          = node;
+}
+
+/*
+* see function definition
+*/
+const CO_SYNC_PIPE_STAT *COSyncPipeStat(void)
+{
+    return (&PipeStat);
+}
+
+#if CO_SYNC_PIPE_WRAP
+
+/******************************************************************************
+* LINKER WRAPPED STACK FUNCTIONS
+******************************************************************************/
+
+void    __real_COSyncHandler(CO_SYNC *sync);
+int16_t __real_COIfCanSend(CO_IF *cif, CO_IF_FRM *frm);
+
+void    __wrap_COSyncHandler(CO_SYNC *sync);
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEND COLLECTED FRAMES
+*
+* \details  Hand over the collected frames to the batch send function. The
+*           frames, which are not accepted (or all frames without batch
+*           send function), are sent with the stack function to keep the
+*           error handling of the stack.
+*/
+/*---------------------------------------------------------------------------*/
+static void COSyncPipeFlush(void)
+{
+    int16_t sent = 0;
+    uint8_t n;
+
+    if (PipeNum == 0) {
+        return;
+    }
+    if (PipeSend != 0) {
+        sent = PipeSend(&PipeFrm[0], PipeNum);
+        if (sent < 0) {
+            sent = 0;
+        }
+    }
+    for (n = (uint8_t)sent; n < PipeNum; n++) {
+        (void)__real_COIfCanSend(&PipeNode->If, &PipeFrm[n]);
+    }
+    PipeStat.Frames += PipeNum;
+    PipeNum         = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SYNC HANDLER (WRAPPED)
+*
+* \details  The stack function latches the synchronous RPDOs, calls the
+*           application hook COPdoSyncUpdate() and builds the synchronous
+*           TPDOs. The TPDO frames are collected while the stack function
+*           runs and handed to the driver afterwards. Staged shadow PDO
+*           mappings are swapped after the SYNC handling, so the whole
+*           cycle uses either the old or the new mapping.
+*/
+/*---------------------------------------------------------------------------*/
+void __wrap_COSyncHandler(CO_SYNC *sync)
+{
+    uint32_t start = 0;
+    uint32_t time;
+
+    if ((PipeNode == 0) || (sync->Node != PipeNode)) {
+        __real_COSyncHandler(sync);
+#if CO_PDO_SHADOW_WRAP
+        (void)COPdoShadowSwap(sync->Node);
+#endif
+        return;
+    }
+    if (PipeClock != 0) {
+        start = PipeClock();
+    }
+
+    PipeNum         = 0;
+    PipeActive      = 1;
+    __real_COSyncHandler(sync);
+    PipeActive      = 0;
+    COSyncPipeFlush();
+#if CO_PDO_SHADOW_WRAP
+    (void)COPdoShadowSwap(sync->Node);
+#endif
+
+    if (PipeClock != 0) {
+        time          = PipeClock() - start;
+        PipeStat.Last = time;
+        if (time > PipeStat.Max) {
+            PipeStat.Max = time;
+        }
+    }
+    PipeStat.Cycles++;
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COSyncPipeSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    if ((PipeActive == 0) || (cif != &PipeNode->If)) {
+        return (0);
+    }
+    if (PipeNum >= CO_SYNC_PIPE_FRM_N) {
+        COSyncPipeFlush();
+        PipeStat.Overflow++;
+    }
+    PipeFrm[PipeNum] = *frm;
+    PipeNum++;
+
+    return (1);
+}
+
+#endif  /* #if CO_SYNC_PIPE_WRAP */
@@ -0,0 +1,126 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_SYNC_PIPE_H_
+#define CO_SYNC_PIPE_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#ifndef CO_SYNC_PIPE_FRM_N
+#define CO_SYNC_PIPE_FRM_N    32u   /*!< frames per batch                    */
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief SYNC PIPELINE BATCH SEND FUNCTION
+*
+*    Hand over the given frames to the CAN controller in one call.
+*    Returns the number of accepted frames or <0 on error.
+*/
+typedef int16_t (*CO_SYNC_PIPE_SEND)(CO_IF_FRM *frm, uint8_t num);
+
+/*! \brief SYNC PIPELINE CLOCK FUNCTION
+*
+*    Returns a free running tick counter (e.g. microseconds).
+*/
+typedef uint32_t (*CO_SYNC_PIPE_CLOCK)(void);
+
+/*! \brief SYNC PIPELINE STATISTICS
+*
+*    The latency is measured in clock ticks from the start of the SYNC
+*    handling until the batch with the last TPDO is handed to the driver.
+*/
+typedef struct CO_SYNC_PIPE_STAT_T {
+    uint32_t Last;             /*!< latency of last SYNC                    */
+    uint32_t Max;              /*!< worst-case latency                      */
+    uint32_t Cycles;           /*!< number of handled SYNC events           */
+    uint32_t Frames;           /*!< frames sent in SYNC batches             */
+    uint16_t Overflow;         /*!< batches sent early due to a full buffer */
+} CO_SYNC_PIPE_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT SYNC PIPELINE
+*
+* \details  This function enables the SYNC pipeline for the given node and
+*           clears the statistics. It must be called after CONodeInit().
+*           On each SYNC, the stack latches the synchronous RPDOs and calls
+*           COPdoSyncUpdate(). All frames of the synchronous TPDOs are
+*           collected afterwards and handed to the driver in one call.
+*
+* \param    node
+*           reference to the node; NULL disables the pipeline
+*
+* \param    send
+*           batch send function; NULL sends the collected frames one by one
+*           with the CAN driver of the node
+*
+* \param    clock
+*           tick counter for latency measurement; NULL disables measurement
+*/
+/*---------------------------------------------------------------------------*/
+void COSyncPipeInit(CO_NODE *node, CO_SYNC_PIPE_SEND send, CO_SYNC_PIPE_CLOCK clock);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET SYNC PIPELINE STATISTICS
+*
+* \retval   reference to the statistics of the pipeline
+*/
+/*---------------------------------------------------------------------------*/
+const CO_SYNC_PIPE_STAT *COSyncPipeStat(void);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  COLLECT CAN FRAME
+*
+* \details  This function collects the frames of the pipeline node during
+*           the SYNC handling; a full buffer is sent early. With
+*           CO_SYNC_PIPE_WRAP, the function is called by the transmit
+*           wrapper for every sent frame.
+*
+* \param    cif
+*           reference to the CAN interface
+*
+* \param    frm
+*           frame to send
+*
+* \retval   =1    frame collected (sent with the batch)
+* \retval   =0    frame is left to the stack
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COSyncPipeSend(CO_IF *cif, CO_IF_FRM *frm);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
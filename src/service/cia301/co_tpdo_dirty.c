@@ -0,0 +1,248 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_tpdo_dirty.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* number of 32-bit words in a bitmap with the given number of bits */
+#define CO_TPDO_DIRTY_WORDS(n)   (((n) + 31u) / 32u)
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* node with enabled dirty tracking */
+static CO_NODE *DirtyNode = 0;
+
+/* dirty bit per object entry (position in dictionary) */
+static uint32_t DirtyBits[CO_TPDO_DIRTY_WORDS(CO_TPDO_DIRTY_OBJ_N)];
+
+/* reverse index (CSR): TPDOs of entry n are Pdo[Start[n]..Start[n+1]-1] */
+static uint16_t DirtyStart[CO_TPDO_DIRTY_OBJ_N + 1u];
+static uint16_t DirtyPdo[CO_TPDO_N * 8u];
+
+/* TPDO mapping, for which the reverse index is built */
+static CO_OBJ  *DirtyMap[CO_TPDO_N][8];
+static uint8_t  DirtyObjNum[CO_TPDO_N];
+static uint8_t  DirtyValid = 0;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  GET TRACKED POSITION OF OBJECT ENTRY
+*
+* \retval   <CO_TPDO_DIRTY_OBJ_N    position of entry in dictionary
+* \retval   =CO_TPDO_DIRTY_OBJ_N    entry is not tracked
+*/
+/*---------------------------------------------------------------------------*/
+static uint32_t COTPdoDirtyPos(CO_NODE *node, CO_OBJ *obj)
+{
+    uint32_t pos;
+
+    if ((obj == 0) || (obj < node->Dict.Root)) {
+        return (CO_TPDO_DIRTY_OBJ_N);
+    }
+    pos = (uint32_t)(obj - node->Dict.Root);
+    if ((pos >= node->Dict.Num) || (pos >= CO_TPDO_DIRTY_OBJ_N)) {
+        return (CO_TPDO_DIRTY_OBJ_N);
+    }
+    return (pos);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CHECK REVERSE INDEX
+*
+* \details  Compare the TPDO mappings of the node with the mappings, for
+*           which the reverse index is built.
+*
+* \retval   =0    reverse index is up to date
+* \retval   =1    reverse index needs a rebuild
+*/
+/*---------------------------------------------------------------------------*/
+static uint8_t COTPdoDirtyChanged(CO_NODE *node)
+{
+    CO_TPDO *pdo;
+    uint32_t n;
+    uint8_t  i;
+
+    if (DirtyValid == 0) {
+        return (1);
+    }
+    for (n = 0; n < CO_TPDO_N; n++) {
+        pdo = &node->TPdo[n];
+        if (pdo->ObjNum != DirtyObjNum[n]) {
+            return (1);
+        }
+        for (i = 0; i < pdo->ObjNum; i++) {
+            if (pdo->Map[i] != DirtyMap[n][i]) {
+                return (1);
+            }
+        }
+    }
+    return (0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BUILD REVERSE INDEX
+*
+* \details  Count the TPDO references per object entry, convert the counts
+*           into start offsets and fill the TPDO numbers.
+*/
+/*---------------------------------------------------------------------------*/
+static void COTPdoDirtyBuild(CO_NODE *node)
+{
+    CO_TPDO *pdo;
+    uint32_t pos;
+    uint32_t n;
+    uint16_t sum = 0;
+    uint16_t cnt;
+    uint8_t  i;
+
+    for (pos = 0; pos <= CO_TPDO_DIRTY_OBJ_N; pos++) {
+        DirtyStart[pos] = 0;
+    }
+    for (n = 0; n < CO_TPDO_N; n++) {
+        pdo            = &node->TPdo[n];
+        DirtyObjNum[n] = pdo->ObjNum;
+        for (i = 0; i < pdo->ObjNum; i++) {
+            DirtyMap[n][i] = pdo->Map[i];
+            pos = COTPdoDirtyPos(node, pdo->Map[i]);
+            if (pos < CO_TPDO_DIRTY_OBJ_N) {
+                DirtyStart[pos + 1u]++;
+            }
+        }
+    }
+    for (pos = 0; pos <= CO_TPDO_DIRTY_OBJ_N; pos++) {  /* counts to offsets */
+        cnt             = DirtyStart[pos];
+        DirtyStart[pos] = sum;
+        sum             = (uint16_t)(sum + cnt);
+    }
+    for (n = 0; n < CO_TPDO_N; n++) {             /* Start[pos+1] is fill pos */
+        pdo = &node->TPdo[n];
+        for (i = 0; i < pdo->ObjNum; i++) {
+            pos = COTPdoDirtyPos(node, pdo->Map[i]);
+            if (pos < CO_TPDO_DIRTY_OBJ_N) {
+                DirtyPdo[DirtyStart[pos + 1u]] = (uint16_t)n;
+                DirtyStart[pos + 1u]++;
+            }
+        }
+    }
+    DirtyValid = 1;
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COTPdoDirtyInit(CO_NODE *node)
+{
+    uint32_t n;
+
+    for (n = 0; n < CO_TPDO_DIRTY_WORDS(CO_TPDO_DIRTY_OBJ_N); n++) {
+        DirtyBits[n] = 0;
+    }
+    DirtyValid = 0;
+    DirtyNode  = 0;
+    if ((node != 0) && (node->Dict.Num > CO_TPDO_DIRTY_OBJ_N)) {
+        return (-1);                           /* entries would be untracked */
+    }
+    DirtyNode = node;
+    return (0);
+}
+
+/*
+* see function definition
+*/
+void COTPdoDirtyMark(CO_NODE *node, CO_OBJ *obj)
+{
+    uint32_t pos;
+
+    if ((node == 0) || (node != DirtyNode)) {
+        return;
+    }
+    if ((CO_IS_PDOMAP(obj->Key) == 0) ||
+        (CO_IS_ASYNC(obj->Key)  != 0)) {          /* stack triggers on write */
+        return;
+    }
+    pos = COTPdoDirtyPos(node, obj);
+    if (pos < CO_TPDO_DIRTY_OBJ_N) {
+        DirtyBits[pos >> 5] |= (1uL << (pos & 31u));
+    }
+}
+
+/*
+* see function definition
+*/
+int16_t COTPdoFlushDirty(CO_NODE *node)
+{
+    uint32_t trig[CO_TPDO_DIRTY_WORDS(CO_TPDO_N)];
+    uint32_t bits;
+    uint32_t pos;
+    uint32_t n;
+    uint16_t num;
+    uint16_t i;
+    int16_t  result = 0;
+
+    if ((node == 0) || (node != DirtyNode)) {
+        return (-1);
+    }
+    if (COTPdoDirtyChanged(node) != 0) {
+        COTPdoDirtyBuild(node);
+    }
+
+    for (n = 0; n < CO_TPDO_DIRTY_WORDS(CO_TPDO_N); n++) {
+        trig[n] = 0;
+    }
+    for (n = 0; n < CO_TPDO_DIRTY_WORDS(CO_TPDO_DIRTY_OBJ_N); n++) {
+        bits = DirtyBits[n];
+        if (bits == 0) {
+            continue;
+        }
+        DirtyBits[n] = 0;
+        while (bits != 0) {
+            pos   = (n << 5) + (uint32_t)__builtin_ctz(bits);
+            bits &= bits - 1u;
+            for (i = DirtyStart[pos]; i < DirtyStart[pos + 1u]; i++) {
+                num = DirtyPdo[i];
+                trig[num >> 5] |= (1uL << (num & 31u));
+            }
+        }
+    }
+
+    for (n = 0; n < CO_TPDO_DIRTY_WORDS(CO_TPDO_N); n++) {
+        bits = trig[n];
+        while (bits != 0) {
+            num   = (uint16_t)((n << 5) + (uint32_t)__builtin_ctz(bits));
+            bits &= bits - 1u;
+            COTPdoTrigPdo(node->TPdo, num);
+            result++;
+        }
+    }
+
+    return (result);
+}
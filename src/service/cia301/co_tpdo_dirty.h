@@ -0,0 +1,109 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_TPDO_DIRTY_H_
+#define CO_TPDO_DIRTY_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  NUMBER OF TRACKED OBJECT ENTRIES
+*
+* \details  The dirty bits are indexed by the position of the object entry
+*           in the dictionary, so this value must be at least the number of
+*           object entries, otherwise COTPdoDirtyInit() fails. Set with the
+*           CMake cache variable CO_TPDO_DIRTY_OBJ_N.
+*/
+/*---------------------------------------------------------------------------*/
+#ifndef CO_TPDO_DIRTY_OBJ_N
+#define CO_TPDO_DIRTY_OBJ_N   512u
+#endif
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  INIT DIRTY TRACKING
+*
+* \details  This function enables the change-of-state tracking for the
+*           given node and clears all dirty marks. It must be called after
+*           CONodeInit(). The reverse index from object entries to TPDOs
+*           is rebuilt on the next flush and whenever a TPDO mapping
+*           changes.
+*
+* \param    node
+*           reference to the node; NULL disables the tracking
+*
+* \retval   =0    tracking is enabled (or disabled with NULL)
+* \retval   <0    the dictionary has more than CO_TPDO_DIRTY_OBJ_N entries;
+*                 the tracking is disabled
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COTPdoDirtyInit(CO_NODE *node);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  MARK OBJECT ENTRY DIRTY
+*
+* \details  This function marks the object entry as changed. It is called
+*           for every successful COObjWrValue() (and therefore every
+*           CODictWr*()) of the tracked node. Entries which are not PDO
+*           mappable, or which trigger their TPDOs on write (async flag),
+*           are ignored.
+*
+* \param    node
+*           reference to the node
+*
+* \param    obj
+*           reference to the changed object entry
+*/
+/*---------------------------------------------------------------------------*/
+void COTPdoDirtyMark(CO_NODE *node, CO_OBJ *obj);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  FLUSH DIRTY OBJECT ENTRIES
+*
+* \details  This function triggers every TPDO, which maps at least one
+*           object entry marked dirty since the last flush, exactly once.
+*           The trigger is passed to COTPdoTrigPdo(), so inhibit times are
+*           honoured. All dirty marks are cleared.
+*
+* \param    node
+*           reference to the node
+*
+* \retval   >=0   number of triggered TPDOs
+* \retval   <0    dirty tracking is not enabled for this node
+*/
+/*---------------------------------------------------------------------------*/
+int16_t COTPdoFlushDirty(CO_NODE *node);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_crc16.h"
+#include "bm_env.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_DOMAIN  (256u * 1024u)  /* size of a firmware domain              */
+#define BM_LOOPS   20u             /* domain passes per measurement          */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t Domain[BM_DOMAIN];
+
+/******************************************************************************
+* MAIN
+******************************************************************************/
+
+int main(void)
+{
+    uint16_t crc = 0;
+    uint32_t i;
+    double   ns_ref;
+    double   ns_slice;
+
+    for (i = 0; i < BM_DOMAIN; i++) {
+        Domain[i] = (uint8_t)((i * 7u) ^ (i >> 8));
+    }
+
+    BM_RUN(ns_ref, BM_LOOPS, {
+        crc = COCrc16Ref(crc, Domain, BM_DOMAIN);
+        BMKeep(&crc);
+    });
+    BM_RUN(ns_slice, BM_LOOPS, {
+        crc = COCrc16Slice4(crc, Domain, BM_DOMAIN);
+        BMKeep(&crc);
+    });
+
+    printf("%-10s %14s %12s\n", "provider", "domain [us]", "[MiB/s]");
+    printf("%-10s %14.1f %12.1f\n", "reference",
+        ns_ref / 1000.0, (double)BM_DOMAIN * 1000.0 / ns_ref / 1.048576);
+    printf("%-10s %14.1f %12.1f\n", "slice-by-4",
+        ns_slice / 1000.0, (double)BM_DOMAIN * 1000.0 / ns_slice / 1.048576);
+    printf("%-10s %14s %11.1fx\n", "speedup", "", ns_ref / ns_slice);
+    return (0);
+}
@@ -0,0 +1,100 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "co_dict_idx.h"
+#include "bm_env.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_ENTRIES_MAX  4096u      /* largest dictionary size                */
+#define BM_LOOPS        200000u    /* lookups per measurement                */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_OBJ   Obj[BM_ENTRIES_MAX + 1];
+static uint16_t Slot[2 * BM_ENTRIES_MAX];
+static uint32_t Key[BM_ENTRIES_MAX];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief FILL DICTIONARY
+*
+*    Creates a sorted dictionary with \a num entries, spread over indices
+*    0x2000.. with 8 subindices each, terminated by the end-marker.
+*/
+static void BMFill(uint32_t num)
+{
+    uint32_t n;
+
+    for (n = 0; n < num; n++) {
+        Obj[n].Key  = CO_KEY(0x2000 + (n >> 3), n & 0x7, CO_OBJ_D___RW);
+        Obj[n].Type = CO_TUNSIGNED32;
+        Obj[n].Data = (CO_DATA)(n);
+        /* visit the entries in a scattered order */
+        Key[(n * 2654435761u) % num] = CO_DEV(0x2000 + (n >> 3), n & 0x7);
+    }
+    Obj[num].Key  = 0;
+    Obj[num].Type = 0;
+    Obj[num].Data = 0;
+}
+
+/******************************************************************************
+* MAIN
+******************************************************************************/
+
+int main(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx;
+    uint32_t    num;
+    uint32_t    i = 0;
+    double      ns_bin;
+    double      ns_idx;
+
+    printf("%8s %12s %12s %8s\n", "entries", "find [ns]", "index [ns]", "speedup");
+    for (num = 16; num <= BM_ENTRIES_MAX; num <<= 1) {
+        BMFill(num);
+        CODictInit(&node.Dict, &node, &Obj[0], (uint16_t)(num + 1));
+        if (CODictIdxInit(&idx, &node.Dict, &Slot[0], 2 * num) < 0) {
+            printf("%8u index init failed\n", (unsigned)num);
+            return (1);
+        }
+
+        BM_RUN(ns_bin, BM_LOOPS, {
+            BMKeep(CODictFind(&node.Dict, Key[i]));
+            i = (i + 1 < num) ? i + 1 : 0;
+        });
+        BM_RUN(ns_idx, BM_LOOPS, {
+            BMKeep(CODictIdxFind(&idx, Key[i]));
+            i = (i + 1 < num) ? i + 1 : 0;
+        });
+
+        printf("%8u %12.1f %12.1f %7.1fx\n",
+            (unsigned)num, ns_bin, ns_idx, ns_bin / ns_idx);
+    }
+    return (0);
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef BM_ENV_H_
+#define BM_ENV_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/******************************************************************************
+* PUBLIC MACROS
+******************************************************************************/
+
+/*! \brief BENCHMARK LOOP
+*
+*    Runs the statement \a stmt \a n times and stores the mean duration of
+*    one iteration in nanoseconds into the double \a ns.
+*/
+#define BM_RUN(ns, n, stmt)                           \
+    do {                                              \
+        uint64_t bm_t0_ = BMNow();                    \
+        uint32_t bm_i_;                               \
+        for (bm_i_ = 0; bm_i_ < (n); bm_i_++) {       \
+            stmt;                                     \
+        }                                             \
+        (ns) = (double)(BMNow() - bm_t0_) / (double)(n); \
+    } while (0)
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief MONOTONIC TIMESTAMP
+*
+*    Returns a monotonic timestamp in nanoseconds.
+*/
+static inline uint64_t BMNow(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+/*! \brief CYCLE COUNTER
+*
+*    Returns the cycle counter of the host CPU (time stamp counter on x86,
+*    virtual counter on AArch64). Other hosts return the monotonic
+*    timestamp in nanoseconds instead.
+*/
+static inline uint64_t BMCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (__builtin_ia32_rdtsc());
+#elif defined(__aarch64__)
+    uint64_t cnt;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(cnt));
+    return (cnt);
+#else
+    return (BMNow());
+#endif
+}
+
+/*! \brief OPTIMIZATION BARRIER
+*
+*    Keeps the compiler from discarding a benchmarked result.
+*/
+static inline void BMKeep(const void *ptr)
+{
+    __asm__ volatile("" : : "r"(ptr) : "memory");
+}
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef BM_ENV_H_ */
@@ -0,0 +1,103 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "co_obj_fast.h"
+#include "bm_env.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_LOOPS   1000000u        /* read/write cycles per measurement      */
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef struct BM_TYPE_T {
+    const char *Name;              /* printed type name                      */
+    CO_OBJ_TYPE *Type;             /* object type under test                 */
+    uint8_t     Width;             /* value width in bytes                   */
+} BM_TYPE;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static const BM_TYPE Types[] = {
+    { "UNSIGNED8",  CO_TUNSIGNED8,  1 },
+    { "UNSIGNED16", CO_TUNSIGNED16, 2 },
+    { "UNSIGNED32", CO_TUNSIGNED32, 4 },
+    { "INTEGER8",   CO_TSIGNED8,    1 },
+    { "INTEGER16",  CO_TSIGNED16,   2 },
+    { "INTEGER32",  CO_TSIGNED32,   4 },
+};
+
+static uint32_t Storage;
+
+/******************************************************************************
+* MAIN
+******************************************************************************/
+
+int main(void)
+{
+    CO_NODE  node = { 0 };
+    CO_OBJ   obj[2];
+    uint32_t val = 0;
+    uint32_t t;
+    uint32_t k;
+    double   ns_type;
+    double   ns_fast;
+
+    printf("%-11s %-9s %12s %12s %8s\n",
+        "type", "storage", "type [ns]", "fast [ns]", "speedup");
+    for (t = 0; t < sizeof(Types) / sizeof(Types[0]); t++) {
+        obj[0].Key  = CO_KEY(0x2000, 0, CO_OBJ_____RW);
+        obj[0].Type = Types[t].Type;
+        obj[0].Data = (CO_DATA)(&Storage);
+        obj[1].Key  = CO_KEY(0x2001, 0, CO_OBJ_D___RW);
+        obj[1].Type = Types[t].Type;
+        obj[1].Data = (CO_DATA)(0);
+
+        for (k = 0; k < 2; k++) {
+            CO_OBJ *o = &obj[k];
+            uint8_t w = Types[t].Width;
+
+            BM_RUN(ns_type, BM_LOOPS, {
+                (void)o->Type->Read(o, &node, &val, w);
+                val++;
+                (void)o->Type->Write(o, &node, &val, w);
+                BMKeep(o);
+            });
+            BM_RUN(ns_fast, BM_LOOPS, {
+                (void)COObjRdFast(o, &node, &val, w);
+                val++;
+                (void)COObjWrFast(o, &node, &val, w);
+                BMKeep(o);
+            });
+
+            printf("%-11s %-9s %12.2f %12.2f %7.1fx\n",
+                Types[t].Name, (k == 0) ? "reference" : "direct",
+                ns_type, ns_fast, ns_type / ns_fast);
+        }
+    }
+    return (0);
+}
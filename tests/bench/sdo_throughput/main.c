@@ -0,0 +1,458 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "co_core.h"
+#include "co_crc16.h"
+#include "drv_can_sim.h"
+#include "drv_nvm_sim.h"
+#include "drv_timer_swcycle.h"
+#include "bm_env.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_NODE_ID     1u
+#define BM_TMR_N       16u
+#define BM_TMR_FREQ    1000u
+#define BM_BITRATE     1000000u            /* default simulated bitrate     */
+
+#define BM_IDX         0x2100u             /* benchmark objects             */
+#define BM_SUB_VAL     1u                  /* UNSIGNED32 (expedited)        */
+#define BM_SUB_DOM     2u                  /* DOMAIN (segmented, block)     */
+
+#define BM_SIZE_MAX    (1024u * 1024u)     /* largest transfer              */
+#define BM_VOLUME      (4u * BM_SIZE_MAX)  /* payload per measurement       */
+#define BM_LOOPS_MAX   10000u              /* transfers per measurement     */
+#define BM_BLKSIZE     127u                /* segments per upload block     */
+
+/* bits of a classical base frame with DLC bytes (without stuff bits) */
+#define BM_FRM_BITS(dlc)  (47u + (8u * (uint32_t)(dlc)))
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* one SDO transfer of the given size between client and node */
+typedef void (*BM_XFER)(uint32_t size);
+
+/* counters of a measurement */
+typedef struct BM_STAT_T {
+    uint64_t Frames;           /* frames on the bus (both directions)       */
+    uint64_t Bits;             /* bus bits of these frames                  */
+    uint64_t Cycles;           /* host cycles spent in CONodeProcess()      */
+} BM_STAT;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE     Node;
+static BM_STAT     Stat;
+static CO_IF_FRM   Rsp;
+static uint8_t     SdoBuf[CO_SSDO_N][CO_SDO_BUF_BYTE];
+static CO_TMR_MEM  TmrMem[BM_TMR_N];
+
+static uint8_t     Obj1001_0  = 0;
+static uint32_t    Obj1005_0  = 0x80;
+static uint16_t    Obj1017_0  = 0;
+static uint32_t    Obj1200_1  = 0x600;
+static uint32_t    Obj1200_2  = 0x580;
+static uint32_t    Value      = 0;
+
+/* object memory of the domain and data of the client (with segment tail) */
+static uint8_t     DomMem[BM_SIZE_MAX];
+static uint8_t     Peer[BM_SIZE_MAX + 7u];
+static CO_OBJ_DOM  Domain = { 0, BM_SIZE_MAX, DomMem };
+
+static CO_OBJ Dict[] = {
+    { CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0)          },
+    { CO_KEY(0x1001, 0, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&Obj1001_0) },
+    { CO_KEY(0x1005, 0, CO_OBJ_____RW), CO_TSYNC_ID,    (CO_DATA)(&Obj1005_0) },
+    { CO_KEY(0x1017, 0, CO_OBJ_____RW), CO_THB_PROD,    (CO_DATA)(&Obj1017_0) },
+    { CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(4)          },
+    { CO_KEY(0x1018, 1, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0)          },
+    { CO_KEY(0x1018, 2, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0)          },
+    { CO_KEY(0x1018, 3, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0)          },
+    { CO_KEY(0x1018, 4, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0)          },
+    { CO_KEY(0x1200, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2)          },
+    { CO_KEY(0x1200, 1, CO_OBJ__N__RW), CO_TSDO_ID,     (CO_DATA)(&Obj1200_1) },
+    { CO_KEY(0x1200, 2, CO_OBJ__N__RW), CO_TSDO_ID,     (CO_DATA)(&Obj1200_2) },
+    { CO_KEY(BM_IDX, BM_SUB_VAL, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&Value)  },
+    { CO_KEY(BM_IDX, BM_SUB_DOM, CO_OBJ_____RW), CO_TDOMAIN,     (CO_DATA)(&Domain) },
+    CO_OBJ_DICT_ENDMARK
+};
+
+static CO_IF_DRV Drv = {
+    &SimCanDriver,
+    &SwCycleTimerDriver,
+    &SimNvmDriver
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void BMFail(const char *msg, uint32_t code)
+{
+    fprintf(stderr, "bm-sdo-throughput: %s (0x%08lx)\n", msg, (unsigned long)code);
+    exit(1);
+}
+
+/* node processing of a received frame; the only measured code */
+static void BMIsr(void)
+{
+    uint64_t c0 = BMCycles();
+
+    CONodeProcess(&Node);
+    Stat.Cycles += BMCycles() - c0;
+}
+
+static void BMCount(uint8_t dlc)
+{
+    Stat.Frames++;
+    Stat.Bits += BM_FRM_BITS(dlc);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  CLIENT REQUEST
+*
+* \details  The request is processed by the node before the function
+*           returns; all responses are queued on the simulated bus.
+*/
+/*---------------------------------------------------------------------------*/
+static void BMSend(const uint8_t *d)
+{
+    (void)SimCanSetFrm(0x600u + BM_NODE_ID, 8, d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7]);
+    BMCount(8);
+    SimCanRun();
+}
+
+static uint8_t BMPoll(void)
+{
+    if (SimCanGetFrm((uint8_t *)&Rsp, sizeof(CO_IF_FRM)) <= 0) {
+        return (0);
+    }
+    BMCount(Rsp.DLC);
+    if (Rsp.Data[0] == 0x80u) {
+        BMFail("transfer aborted by node", CO_GET_LONG(&Rsp, 4));
+    }
+    return (1);
+}
+
+static const uint8_t *BMRecv(uint8_t mask, uint8_t cmd)
+{
+    if (BMPoll() == 0) {
+        BMFail("no response", 0);
+    }
+    if ((Rsp.Data[0] & mask) != cmd) {
+        BMFail("unexpected response", Rsp.Data[0]);
+    }
+    return (Rsp.Data);
+}
+
+static void BMInit(uint8_t *d, uint8_t cmd, uint8_t sub, uint32_t val)
+{
+    d[0] = cmd;
+    d[1] = (uint8_t)BM_IDX;
+    d[2] = (uint8_t)(BM_IDX >> 8);
+    d[3] = sub;
+    d[4] = (uint8_t)val;
+    d[5] = (uint8_t)(val >> 8);
+    d[6] = (uint8_t)(val >> 16);
+    d[7] = (uint8_t)(val >> 24);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  EXPEDITED TRANSFERS
+*/
+/*---------------------------------------------------------------------------*/
+static void BMExpUp(uint32_t size)
+{
+    uint8_t d[8];
+
+    (void)size;
+    BMInit(d, 0x40u, BM_SUB_VAL, 0);
+    BMSend(d);
+    memcpy(Peer, &BMRecv(0xF3u, 0x43u)[4], 4);
+}
+
+static void BMExpDn(uint32_t size)
+{
+    uint8_t d[8];
+
+    (void)size;
+    BMInit(d, 0x23u, BM_SUB_VAL, 0);
+    memcpy(&d[4], Peer, 4);
+    BMSend(d);
+    (void)BMRecv(0xFFu, 0x60u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  SEGMENTED TRANSFERS
+*/
+/*---------------------------------------------------------------------------*/
+static void BMSegUp(uint32_t size)
+{
+    const uint8_t *r;
+    uint8_t        d[8];
+    uint32_t       pos = 0;
+    uint8_t        tgl = 0;
+    uint8_t        n;
+
+    BMInit(d, 0x40u, BM_SUB_DOM, 0);
+    BMSend(d);
+    (void)BMRecv(0xFFu, 0x41u);
+    do {
+        memset(d, 0, sizeof(d));
+        d[0] = (uint8_t)(0x60u | tgl);
+        BMSend(d);
+        r = BMRecv(0xF0u, tgl);
+        n = (uint8_t)(7u - ((r[0] >> 1) & 0x07u));
+        memcpy(&Peer[pos], &r[1], n);
+        pos += n;
+        tgl ^= 0x10u;
+    } while ((r[0] & 0x01u) == 0);
+    if (pos != size) {
+        BMFail("segmented upload size", pos);
+    }
+}
+
+static void BMSegDn(uint32_t size)
+{
+    uint8_t  d[8];
+    uint32_t pos = 0;
+    uint8_t  tgl = 0;
+    uint8_t  n;
+    uint8_t  last;
+
+    BMInit(d, 0x21u, BM_SUB_DOM, size);
+    BMSend(d);
+    (void)BMRecv(0xFFu, 0x60u);
+    while (pos < size) {
+        n    = (uint8_t)(((size - pos) < 7u) ? (size - pos) : 7u);
+        last = ((pos + n) >= size) ? 1u : 0u;
+        memset(d, 0, sizeof(d));
+        d[0] = (uint8_t)(tgl | ((7u - n) << 1) | last);
+        memcpy(&d[1], &Peer[pos], n);
+        BMSend(d);
+        (void)BMRecv(0xFFu, (uint8_t)(0x20u | tgl));
+        pos += n;
+        tgl ^= 0x10u;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  BLOCK TRANSFERS
+*
+* \details  Both directions use the CRC. The upload acknowledges all
+*           segments, which are queued after the request.
+*/
+/*---------------------------------------------------------------------------*/
+static void BMBlkUp(uint32_t size)
+{
+    const uint8_t *r;
+    uint8_t        d[8];
+    uint32_t       pos = 0;
+    uint8_t        crc;
+    uint8_t        seq;
+    uint8_t        last = 0;
+
+    BMInit(d, 0xA4u, BM_SUB_DOM, BM_BLKSIZE);
+    BMSend(d);
+    crc = (uint8_t)(BMRecv(0xE0u, 0xC0u)[0] & 0x04u);
+    memset(d, 0, sizeof(d));
+    d[0] = 0xA3u;
+    BMSend(d);
+    while (last == 0) {
+        seq = 0;
+        while ((last == 0) && (BMPoll() != 0)) {
+            seq  = (uint8_t)(Rsp.Data[0] & 0x7Fu);
+            last = (uint8_t)(Rsp.Data[0] & 0x80u);
+            memcpy(&Peer[pos + ((uint32_t)(seq - 1u) * 7u)], &Rsp.Data[1], 7);
+        }
+        pos += (uint32_t)seq * 7u;
+        memset(d, 0, sizeof(d));
+        d[0] = 0xA2u;
+        d[1] = seq;
+        d[2] = BM_BLKSIZE;
+        BMSend(d);
+    }
+    r    = BMRecv(0xE3u, 0xC1u);
+    pos -= (uint32_t)((r[0] >> 2) & 0x07u);
+    if (pos != size) {
+        BMFail("block upload size", pos);
+    }
+    if ((crc != 0) && (CO_GET_WORD(&Rsp, 1) != COCrc16(0, Peer, size))) {
+        BMFail("block upload crc", CO_GET_WORD(&Rsp, 1));
+    }
+    memset(d, 0, sizeof(d));
+    d[0] = 0xA1u;
+    BMSend(d);
+}
+
+static void BMBlkDn(uint32_t size)
+{
+    const uint8_t *r;
+    uint8_t        d[8];
+    uint32_t       pos = 0;
+    uint16_t       crc;
+    uint8_t        blk;
+    uint8_t        seq;
+    uint8_t        n;
+
+    BMInit(d, 0xC6u, BM_SUB_DOM, size);
+    BMSend(d);
+    blk = BMRecv(0xFBu, 0xA0u)[4];
+    while (pos < size) {
+        seq = 0;
+        while ((seq < blk) && (pos < size)) {
+            seq++;
+            n = (uint8_t)(((size - pos) < 7u) ? (size - pos) : 7u);
+            memset(d, 0, sizeof(d));
+            d[0] = (uint8_t)(((pos + n) >= size) ? (0x80u | seq) : seq);
+            memcpy(&d[1], &Peer[pos], n);
+            BMSend(d);
+            pos += n;
+        }
+        r = BMRecv(0xFFu, 0xA2u);
+        if (r[1] != seq) {
+            BMFail("block download acknowledge", r[1]);
+        }
+        blk = r[2];
+    }
+    n   = (uint8_t)((7u - (size % 7u)) % 7u);
+    crc = COCrc16(0, Peer, size);
+    memset(d, 0, sizeof(d));
+    d[0] = (uint8_t)(0xC1u | (n << 2));
+    d[1] = (uint8_t)crc;
+    d[2] = (uint8_t)(crc >> 8);
+    BMSend(d);
+    (void)BMRecv(0xFFu, 0xA1u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief  MEASURE TRANSFER
+*
+* \details  The transfer is repeated, until about BM_VOLUME bytes are
+*           moved, and one JSON object with the results is printed. The
+*           bus rate is derived from the frame bits at the simulated
+*           bitrate; the host cost counts the node processing only.
+*/
+/*---------------------------------------------------------------------------*/
+static void BMRun(const char *kind, uint8_t up, BM_XFER xfer, uint32_t size,
+                  uint32_t bitrate, uint8_t first)
+{
+    const uint8_t *obj   = (size <= 4u) ? (const uint8_t *)&Value : DomMem;
+    uint32_t       loops = BM_VOLUME / size;
+    uint32_t       i;
+    uint64_t       t0;
+    uint64_t       ns;
+    double         bytes;
+    double         bus;
+
+    if (loops > BM_LOOPS_MAX) {
+        loops = BM_LOOPS_MAX;
+    }
+    for (i = 0; i < size; i++) {
+        Peer[i]   = (uint8_t)(i ^ (i >> 8) ^ 0x5Au);
+        DomMem[i] = (uint8_t)(i ^ (i >> 8));
+    }
+    Value         = 0x11223344u;
+    Domain.Size   = size;
+    Domain.Offset = 0;
+    memset(&Stat, 0, sizeof(Stat));
+
+    t0 = BMNow();
+    for (i = 0; i < loops; i++) {
+        xfer(size);
+    }
+    ns = BMNow() - t0;
+    if (memcmp(Peer, obj, size) != 0) {
+        BMFail("data mismatch", size);
+    }
+
+    bytes = (double)size * (double)loops;
+    bus   = (double)Stat.Bits / (double)bitrate;
+    printf("%s    {\"transfer\": \"%s\", \"direction\": \"%s\", \"size\": %lu, "
+           "\"loops\": %lu, \"frames\": %.1f, \"bus_bytes_per_s\": %.1f, "
+           "\"host_cycles_per_byte\": %.2f, \"host_bytes_per_s\": %.0f}",
+        (first != 0) ? "" : ",\n", kind, (up != 0) ? "upload" : "download",
+        (unsigned long)size, (unsigned long)loops,
+        (double)Stat.Frames / (double)loops, bytes / bus,
+        (double)Stat.Cycles / bytes, bytes * 1e9 / (double)ns);
+}
+
+/******************************************************************************
+* MAIN
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    static const uint32_t size[] = { 64u, 1024u, 64u * 1024u, BM_SIZE_MAX };
+    CO_NODE_SPEC spec;
+    uint32_t     bitrate = BM_BITRATE;
+    uint8_t      n;
+
+    if (argc > 1) {
+        bitrate = (uint32_t)strtoul(argv[1], 0, 0);
+        if (bitrate == 0) {
+            fprintf(stderr, "usage: %s [bitrate]\n", argv[0]);
+            return (1);
+        }
+    }
+
+    memset(&spec, 0, sizeof(spec));
+    spec.NodeId   = BM_NODE_ID;
+    spec.Baudrate = bitrate;
+    spec.Dict     = &Dict[0];
+    spec.DictLen  = sizeof(Dict) / sizeof(CO_OBJ);
+    spec.EmcyCode = 0;
+    spec.TmrMem   = &TmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = BM_TMR_FREQ;
+    spec.Drv      = &Drv;
+    spec.SdoBuf   = &SdoBuf[0][0];
+    SimCanSetIsr(BMIsr);
+    CONodeInit(&Node, &spec);
+    CONodeStart(&Node);
+    SimCanFlush();
+    if (CONodeGetErr(&Node) != CO_ERR_NONE) {
+        BMFail("node init", (uint32_t)CONodeGetErr(&Node));
+    }
+
+    printf("{\n  \"benchmark\": \"sdo_throughput\",\n");
+    printf("  \"stack\": \"%d.%d.%d\",\n", CO_VER_MAJOR, CO_VER_MINOR, CO_VER_BUILD);
+    printf("  \"bitrate\": %lu,\n", (unsigned long)bitrate);
+    printf("  \"results\": [\n");
+    BMRun("expedited", 1, BMExpUp, 4u, bitrate, 1);
+    BMRun("expedited", 0, BMExpDn, 4u, bitrate, 0);
+    for (n = 0; n < (sizeof(size) / sizeof(size[0])); n++) {
+        BMRun("segmented", 1, BMSegUp, size[n], bitrate, 0);
+        BMRun("segmented", 0, BMSegDn, size[n], bitrate, 0);
+        BMRun("block",     1, BMBlkUp, size[n], bitrate, 0);
+        BMRun("block",     0, BMBlkDn, size[n], bitrate, 0);
+    }
+    printf("\n  ]\n}\n");
+    return (0);
+}
@@ -0,0 +1,117 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "co_sdo_zc.h"
+#include "bm_env.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_DOMAIN  (64u * 1024u)   /* size of the uploaded domain            */
+#define BM_LOOPS   100u            /* domain uploads per measurement         */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t   Domain[BM_DOMAIN];
+static uint8_t   SdoBuf[CO_SDO_BUF_BYTE];
+static CO_IF_FRM Frm;
+static uint32_t  Copied;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* segments of the stack server: object memory -> SDO buffer -> frame */
+static void BMBuffered(void)
+{
+    uint32_t pos = 0;
+    uint32_t len;
+    uint32_t seg;
+    uint8_t  n;
+
+    while (pos < BM_DOMAIN) {
+        len = BM_DOMAIN - pos;
+        if (len > CO_SDO_BUF_BYTE) {
+            len = CO_SDO_BUF_BYTE;
+        }
+        memcpy(SdoBuf, &Domain[pos], len);
+        Copied += len;
+        for (seg = 0; seg < len; seg += n) {
+            n = (uint8_t)(((len - seg) < 7u) ? (len - seg) : 7u);
+            memcpy(&Frm.Data[1], &SdoBuf[seg], n);
+            Copied += n;
+            BMKeep(&Frm);
+        }
+        pos += len;
+    }
+}
+
+/* segments of the zero-copy upload: object memory -> frame */
+static void BMZeroCopy(void)
+{
+    uint32_t pos = 0;
+    uint8_t  n;
+
+    while (pos < BM_DOMAIN) {
+        n       = COSdoZcSegment(&Frm, &Domain[pos], BM_DOMAIN - pos);
+        Copied += n;
+        pos    += n;
+        BMKeep(&Frm);
+    }
+}
+
+/******************************************************************************
+* MAIN
+******************************************************************************/
+
+int main(void)
+{
+    uint32_t i;
+    double   ns_buf;
+    double   ns_zc;
+    double   cp_buf;
+    double   cp_zc;
+
+    for (i = 0; i < BM_DOMAIN; i++) {
+        Domain[i] = (uint8_t)(i ^ (i >> 8));
+    }
+
+    Copied = 0;
+    BM_RUN(ns_buf, BM_LOOPS, BMBuffered());
+    cp_buf = (double)Copied / ((double)BM_DOMAIN * BM_LOOPS);
+
+    Copied = 0;
+    BM_RUN(ns_zc, BM_LOOPS, BMZeroCopy());
+    cp_zc = (double)Copied / ((double)BM_DOMAIN * BM_LOOPS);
+
+    printf("%-10s %14s %12s %14s\n", "path", "domain [us]", "[MiB/s]", "copies/byte");
+    printf("%-10s %14.1f %12.1f %14.2f\n", "buffered",
+        ns_buf / 1000.0, (double)BM_DOMAIN * 1000.0 / ns_buf / 1.048576, cp_buf);
+    printf("%-10s %14.1f %12.1f %14.2f\n", "zero-copy",
+        ns_zc / 1000.0, (double)BM_DOMAIN * 1000.0 / ns_zc / 1.048576, cp_zc);
+    printf("%-10s %14s %11.1fx\n", "speedup", "", ns_buf / ns_zc);
+    return (0);
+}
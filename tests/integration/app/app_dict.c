@@ -49,6 +49,144 @@
 /* mask the index and subindex from a object entry key */
 #define OD_IDX(key)   ((key) & 0xFFFFFF00L)
 
+/* number of object entries, which are presorted with an insertion sort */
+#define OD_SORT_BLOCK   20u
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*! \brief INSERTION SORT
+*
+* \details Sort the object entries at the positions [a, b) of the object
+*          entry array (od). Entries with equal index/subindex keep their
+*          order.
+*/
+/*---------------------------------------------------------------------------*/
+static void ODInsertSort(CO_OBJ *od, uint32_t a, uint32_t b)
+{
+    uint32_t i;
+    uint32_t j;
+
+    for (i = a + 1; i < b; i++) {
+        for (j = i; (j > a) && (OD_IDX(od[j].Key) < OD_IDX(od[j - 1].Key)); j--) {
+            OD_SWAP(&od[j], &od[j - 1]);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief ROTATE OBJECT ENTRIES
+*
+* \details Exchange the blocks [a, m) and [m, b) of the object entry array
+*          (od) with block swaps.
+*/
+/*---------------------------------------------------------------------------*/
+static void ODRotate(CO_OBJ *od, uint32_t a, uint32_t m, uint32_t b)
+{
+    uint32_t i = m - a;
+    uint32_t j = b - m;
+    uint32_t k;
+
+    while (i != j) {
+        if (i > j) {
+            for (k = 0; k < j; k++) {
+                OD_SWAP(&od[m - i + k], &od[m + k]);
+            }
+            i -= j;
+        } else {
+            for (k = 0; k < i; k++) {
+                OD_SWAP(&od[m - i + k], &od[m + j - i + k]);
+            }
+            j -= i;
+        }
+    }
+    for (k = 0; k < i; k++) {
+        OD_SWAP(&od[m - i + k], &od[m + k]);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief MERGE SORTED OBJECT ENTRIES
+*
+* \details Merge the sorted blocks [a, m) and [m, b) of the object entry
+*          array (od) in place (SymMerge algorithm of Kim and Kutzner).
+*          Entries with equal index/subindex keep their order, the entries
+*          of the first block come first.
+*/
+/*---------------------------------------------------------------------------*/
+static void ODMerge(CO_OBJ *od, uint32_t a, uint32_t m, uint32_t b)
+{
+    uint32_t mid;
+    uint32_t start;
+    uint32_t end;
+    uint32_t r;
+    uint32_t c;
+    uint32_t n;
+
+    if ((m - a) == 1) {                       /* insert single entry od[a] */
+        start = m;
+        r     = b;
+        while (start < r) {
+            c = (start + r) / 2;
+            if (OD_IDX(od[c].Key) < OD_IDX(od[a].Key)) {
+                start = c + 1;
+            } else {
+                r = c;
+            }
+        }
+        for (c = a; (c + 1) < start; c++) {
+            OD_SWAP(&od[c], &od[c + 1]);
+        }
+        return;
+    }
+    if ((b - m) == 1) {                       /* insert single entry od[m] */
+        start = a;
+        r     = m;
+        while (start < r) {
+            c = (start + r) / 2;
+            if (OD_IDX(od[m].Key) >= OD_IDX(od[c].Key)) {
+                start = c + 1;
+            } else {
+                r = c;
+            }
+        }
+        for (c = m; c > start; c--) {
+            OD_SWAP(&od[c], &od[c - 1]);
+        }
+        return;
+    }
+
+    mid = (a + b) / 2;
+    n   = mid + m;
+    if (m > mid) {
+        start = n - b;
+        r     = mid;
+    } else {
+        start = a;
+        r     = m;
+    }
+    while (start < r) {
+        c = (start + r) / 2;
+        if (OD_IDX(od[n - 1 - c].Key) >= OD_IDX(od[c].Key)) {
+            start = c + 1;
+        } else {
+            r = c;
+        }
+    }
+    end = n - start;
+    if ((start < m) && (m < end)) {
+        ODRotate(od, start, m, end);
+    }
+    if ((a < start) && (start < mid)) {
+        ODMerge(od, a, start, mid);
+    }
+    if ((mid < end) && (end < b)) {
+        ODMerge(od, mid, end, b);
+    }
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -120,6 +258,75 @@ void ODAdd(OD_DYN *self, uint32_t key, CO_OBJ_TYPE *type, CO_DATA data)
     }
 }
 
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-OD-0111
+*
+* \details Staged entries are appended to the end of the used entries. The
+*          sorting is deferred to ODCommit().
+*/
+/*---------------------------------------------------------------------------*/
+void ODStage(OD_DYN *self, uint32_t key, CO_OBJ_TYPE *type, CO_DATA data)
+{
+    if ((key == 0) ||                         /* end-marker is not possible */
+        (self->Used == self->Len)) {          /* list is full */
+        return;
+    }
+
+    OD_SET(&self->Root[self->Used], key, type, data);
+    self->Used++;
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-OD-0112
+*
+* \details The used entries are sorted in place with a stable merge sort,
+*          so no additional memory is needed and duplicate keys stay in the
+*          staging order. Afterwards a single pass keeps the last staged
+*          entry of each key, like ODAdd() does, and the released entries
+*          are cleared, which places the end-marker after the last used
+*          entry.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t ODCommit(OD_DYN *self)
+{
+    CO_OBJ   *od  = self->Root;
+    uint32_t  num = self->Used;
+    uint32_t  pos;
+    uint32_t  size;
+    uint32_t  used;
+
+    if (num < 2) {
+        return (0);
+    }
+
+    for (pos = 0; pos < num; pos += OD_SORT_BLOCK) {  /* presort blocks */
+        ODInsertSort(od, pos, (num - pos > OD_SORT_BLOCK) ? pos + OD_SORT_BLOCK : num);
+    }
+    for (size = OD_SORT_BLOCK; size < num; size *= 2) {  /* merge blocks */
+        for (pos = 0; (pos + size) < num; pos += 2 * size) {
+            ODMerge(od, pos, pos + size, ((num - pos) > (2 * size)) ? pos + 2 * size : num);
+        }
+    }
+
+    used = 1;                                 /* keep last staged duplicate */
+    for (pos = 1; pos < num; pos++) {
+        if (OD_IDX(od[pos].Key) == OD_IDX(od[used - 1].Key)) {
+            OD_CPY(&od[used - 1], &od[pos]);
+        } else {
+            if (pos != used) {
+                OD_CPY(&od[used], &od[pos]);
+            }
+            used++;
+        }
+    }
+    for (pos = used; pos < num; pos++) {      /* clear released entries */
+        OD_SET(&od[pos], 0, 0, (CO_DATA)(NULL));
+    }
+    self->Used = used;
+
+    return (num - used);
+}
+
 /*---------------------------------------------------------------------------*/
 /*! \brief REQ-OD-0120
 *
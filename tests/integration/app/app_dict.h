@@ -83,6 +83,53 @@ void ODInit(OD_DYN *self, CO_OBJ *root, uint32_t len);
 /*---------------------------------------------------------------------------*/
 void ODAdd(OD_DYN *self, uint32_t key, CO_OBJ_TYPE *type, CO_DATA data);
 
+/*---------------------------------------------------------------------------*/
+/*! \brief STAGE DYNAMIC OBJECT ENTRY
+*
+* \details Append an object entry to the dynamic object dictionary without
+*          keeping the entries sorted. This is the bulk-build counterpart of
+*          ODAdd(): stage all entries in any order and call ODCommit() once
+*          before the dictionary is handed to the stack.
+*
+* \param   self
+*          reference to the dynamic object dictionary
+*
+* \param   key
+*          object entry key
+*
+* \param   type
+*          type of the new object entry
+*
+* \param   data
+*          data of the new object entry
+*
+* \note    The dictionary is not usable for ODAdd() or CODictFind() between
+*          the first ODStage() and the following ODCommit().
+*/
+/*---------------------------------------------------------------------------*/
+void ODStage(OD_DYN *self, uint32_t key, CO_OBJ_TYPE *type, CO_DATA data);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief COMMIT STAGED OBJECT ENTRIES
+*
+* \details Sort all object entries ascending by index and subindex in
+*          place, remove entries with a duplicate index and subindex and
+*          write the end-marker behind the last used entry. The in-place
+*          merge (SymMerge) needs O(N log N) comparisons, but O(N log^2 N)
+*          element moves.
+*
+* \param   self
+*          reference to the dynamic object dictionary
+*
+* \return  Number of removed duplicate object entries
+*
+* \note    The sort is stable: for duplicate keys the last staged entry
+*          is kept, like a repeated ODAdd() replaces the entry. Duplicates
+*          are reported with a non-zero return value.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t ODCommit(OD_DYN *self);
+
 /*---------------------------------------------------------------------------*/
 /*! \brief GET DYNAMIC OBJECT DICTIONARY
 *
@@ -20,13 +20,16 @@
 
 #include "app_env.h"
 #include <stdio.h>
+#if CO_SDO_POOL_WRAP
+#include "co_sdo_pool.h"
+#endif
 
 /******************************************************************************
 * PRIVATE DEFINES
 ******************************************************************************/
 
-/* Maximal size of dynamic object dictionary */
-#define TS_OD_MAX   64
+/* Maximal size of dynamic object dictionary (32 TPDOs with mapped objects) */
+#define TS_OD_MAX   320
 
 /* Maximal depth of emergency history */
 #define TS_EMCY_HIST_MAX   4
@@ -46,8 +49,10 @@
 
 /* reference to the CANopen node for testing */
 static CO_NODE *TS_TestNode;
-/* allocate memory for SDO server buffer */
+#if !CO_SDO_POOL_WRAP
+/* allocate memory for SDO server buffer (the pool replaces it) */
 static uint8_t SdoBuf[TS_SDOS_N][CO_SDO_BUF_BYTE];
+#endif
 /* allocate memory for highspeed timer */
 static CO_TMR_MEM TmrMem[TS_TMR_N];
 /* management structure for dynamic object dictionary */
@@ -154,7 +159,8 @@ void TS_CreateEmcy(void)
 *
 *          **local memory allocations:**
 *          - timer: TS_TMR_N timers of type CO_TMR_MEM
-*          - SDO buffer: TS_SDOS_N servers with CO_SDO_BUF_BYTE bytes
+*          - SDO buffer: TS_SDOS_N servers with CO_SDO_BUF_BYTE bytes, or
+*            none with the SDO buffer pool (see TS_CreateNode())
 */
 /*---------------------------------------------------------------------------*/
 void TS_CreateSpec(CO_NODE *node, CO_NODE_SPEC *spec, uint32_t freq)
@@ -177,7 +183,11 @@ void TS_CreateSpec(CO_NODE *node, CO_NODE_SPEC *spec, uint32_t freq)
     } else {
         spec->TmrFreq = TS_TMR_FREQ;
     }
+#if CO_SDO_POOL_WRAP
+    spec->SdoBuf   = (uint8_t *)0;        /* servers lease the pool buffers */
+#else
     spec->SdoBuf   = &SdoBuf[0][0];
+#endif
 
     SimCanSetIsr(TS_CanIsr);                /* connect to test can interface */
 }
@@ -188,6 +198,7 @@ void TS_CreateSpec(CO_NODE *node, CO_NODE_SPEC *spec, uint32_t freq)
 * \details Create a CANopen node, using a local CANopen node specification.
 *          Use this specification to create and start a CANopen node for
 *          testing. Remove all existing CAN frames from the used CAN bus.
+*          With the SDO buffer pool, the pool is enabled for the node.
 *
 *          Starting mode is: PRE-OPERATIONAL
 */
@@ -199,6 +210,9 @@ void TS_CreateNode(CO_NODE *node, uint32_t freq)
     TS_CreateSpec(node, &spec, freq);
 
     CONodeInit(node, &spec);
+#if CO_SDO_POOL_WRAP
+    COSdoPoolInit(node);
+#endif
     CONodeStart(node);
 
     SimCanFlush();
@@ -229,6 +243,30 @@ void TS_ODAdd(uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data)
     ODAdd(&TS_ODDyn, key, (CO_OBJ_TYPE *)type, data);
 }
 
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-ENV-0141
+*
+* \details Stage an object entry in the local object dictionary 'TS_ODDyn'
+*          without sorting.
+*/
+/*---------------------------------------------------------------------------*/
+void TS_ODStage(uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data)
+{
+    ODStage(&TS_ODDyn, key, (CO_OBJ_TYPE *)type, data);
+}
+
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-ENV-0142
+*
+* \details Sort and deduplicate the staged object entries of the local
+*          object dictionary 'TS_ODDyn'.
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t TS_ODCommit(void)
+{
+    return (ODCommit(&TS_ODDyn));
+}
+
 /*---------------------------------------------------------------------------*/
 /*! \brief REQ-ENV-0150
 *
@@ -251,25 +289,26 @@ void TS_CreateMandatoryDir(void)
     uint32_t num;
 
     ODInit(&TS_ODDyn, &TS_ODList[0], TS_OD_MAX);
-    TS_ODAdd(OBJ1000_0(0));
-    TS_ODAdd(OBJ1001_0(&TS_Obj1001_0));
+    TS_ODStage(OBJ1000_0(0));
+    TS_ODStage(OBJ1001_0(&TS_Obj1001_0));
     TS_Obj1001_0 = 0;
-    TS_ODAdd(OBJ1005_0(&TS_Obj1005_0));
+    TS_ODStage(OBJ1005_0(&TS_Obj1005_0));
     TS_Obj1005_0 = 0x80;
-    TS_ODAdd(OBJ1017_0(&TS_Obj1017_0));
+    TS_ODStage(OBJ1017_0(&TS_Obj1017_0));
     TS_Obj1017_0 = 0;
-    TS_ODAdd(OBJ1018_0(4));
-    TS_ODAdd(OBJ1018_1(0));
-    TS_ODAdd(OBJ1018_2(0));
-    TS_ODAdd(OBJ1018_3(0));
-    TS_ODAdd(OBJ1018_4(0));
+    TS_ODStage(OBJ1018_0(4));
+    TS_ODStage(OBJ1018_1(0));
+    TS_ODStage(OBJ1018_2(0));
+    TS_ODStage(OBJ1018_3(0));
+    TS_ODStage(OBJ1018_4(0));
     for (num = 0; num < CO_SSDO_N; num++) {
-        TS_ODAdd(OBJ120X_0(num, 2));
-        TS_ODAdd(OBJ120X_1(num, &TS_Obj120x_1[num])); /* rx */
+        TS_ODStage(OBJ120X_0(num, 2));
+        TS_ODStage(OBJ120X_1(num, &TS_Obj120x_1[num])); /* rx */
         TS_Obj120x_1[num] = 0x600 + (num * 0x10);
-        TS_ODAdd(OBJ120X_2(num, &TS_Obj120x_2[num])); /* tx */
+        TS_ODStage(OBJ120X_2(num, &TS_Obj120x_2[num])); /* tx */
         TS_Obj120x_2[num] = 0x580 + (num * 0x10);
     }
+    (void)TS_ODCommit();
 
     EmcyResetTable();
     DomInit();
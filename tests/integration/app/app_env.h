@@ -509,6 +509,36 @@ void TS_CreateNodeAutoStart(CO_NODE *node);
 /*---------------------------------------------------------------------------*/
 void TS_ODAdd(uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data);
 
+/*---------------------------------------------------------------------------*/
+/*! \brief STAGE OBJECT ENTRY INTO OBJECT DICTIONARY FOR TESTING
+*
+* \details Append an object entry unsorted into the dynamic object dictionary
+*          of the CANopen node for testing. The staged entries must be
+*          committed with TS_ODCommit() before further use.
+*
+* \param   key
+*          object entry key, generated with CO_KEY()
+*
+* \param   type
+*          object type reference according to user manual
+*
+* \param   data
+*          object entry data according to user manual
+*/
+/*---------------------------------------------------------------------------*/
+void TS_ODStage(uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data);
+
+/*---------------------------------------------------------------------------*/
+/*! \brief COMMIT STAGED OBJECT ENTRIES FOR TESTING
+*
+* \details Sort the staged object entries of the dynamic object dictionary
+*          and remove duplicate keys.
+*
+* \return  Number of removed duplicate object entries
+*/
+/*---------------------------------------------------------------------------*/
+uint32_t TS_ODCommit(void);
+
 /*---------------------------------------------------------------------------*/
 /*! \brief SETUP THE MANDATORY OBJECT ENTRIES OF AN OBJECT DICTIONARY
 *
@@ -35,18 +35,25 @@
 * PRIVATE TYPES
 ******************************************************************************/
 
+/* frame queues hold CAN FD frames; classical frames have no FDF flag */
+typedef CO_IF_FD_FRM SIM_CAN_FRM;
+
 typedef struct SIM_CAN_BUS_T {
     struct SIM_CAN_BUS_T *Addr;
     uint32_t              Status;
     uint32_t              Baudrate;
+    uint32_t              DataRate;
     uint32_t              TxOvr;
     uint32_t              RxOvr;
-    CO_IF_FRM            *RxRd;
-    CO_IF_FRM            *RxWr;
-    CO_IF_FRM            *TxRd;
-    CO_IF_FRM            *TxWr;
-    CO_IF_FRM             RxQ[SIM_CAN_Q_LEN];
-    CO_IF_FRM             TxQ[SIM_CAN_Q_LEN];
+    uint32_t              TxLoss;
+    uint32_t              RxLoss;
+    uint32_t              Lost;
+    SIM_CAN_FRM          *RxRd;
+    SIM_CAN_FRM          *RxWr;
+    SIM_CAN_FRM          *TxRd;
+    SIM_CAN_FRM          *TxWr;
+    SIM_CAN_FRM           RxQ[SIM_CAN_Q_LEN];
+    SIM_CAN_FRM           TxQ[SIM_CAN_Q_LEN];
     SIM_CAN_IRQ           Handler;
 } SIM_CAN_BUS;
 
@@ -67,6 +74,12 @@ static int16_t DrvCanRead   (CO_IF_FRM *frm);
 static void    DrvCanReset  (void);
 static void    DrvCanClose  (void);
 
+static void    DrvCanFdEnable (uint32_t nominal, uint32_t data);
+static int16_t DrvCanFdSend   (CO_IF_FD_FRM *frm);
+static int16_t DrvCanFdRead   (CO_IF_FD_FRM *frm);
+
+static uint8_t SimCanLoss     (uint32_t *mask);
+
 /******************************************************************************
 * PUBLIC VARIABLE
 ******************************************************************************/
@@ -80,6 +93,15 @@ const CO_IF_CAN_DRV SimCanDriver = {
     DrvCanClose
 };
 
+const CO_IF_FD_DRV SimCanFdDriver = {
+    DrvCanInit,
+    DrvCanFdEnable,
+    DrvCanFdRead,
+    DrvCanFdSend,
+    DrvCanReset,
+    DrvCanClose
+};
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
@@ -95,8 +117,12 @@ static void DrvCanInit(void)
         bus->Status = SIM_CAN_STAT_INIT; 
     }
     bus->Baudrate = 0u;
+    bus->DataRate = 0u;
     bus->TxOvr    = 0u;
     bus->RxOvr    = 0u;
+    bus->TxLoss   = 0u;
+    bus->RxLoss   = 0u;
+    bus->Lost     = 0u;
     bus->RxWr     = &bus->RxQ[0u];
     bus->RxRd     = &bus->RxQ[0u];
     bus->TxWr     = &bus->TxQ[0u];
@@ -112,15 +138,70 @@ static void DrvCanEnable(uint32_t baudrate)
 }
 
 static int16_t DrvCanSend(CO_IF_FRM *frm)
+{
+    CO_IF_FD_FRM  fd;
+    int16_t       result;
+    uint8_t       byte;
+
+    fd.Identifier = frm->Identifier;
+    fd.DLC        = frm->DLC;
+    fd.Flags      = 0u;
+    for (byte = 0u; byte < 8u; byte++) {
+        fd.Data[byte] = frm->Data[byte];
+    }
+    result = DrvCanFdSend(&fd);
+    if (result > 0) {
+        result = sizeof(CO_IF_FRM);
+    }
+    return (result);
+}
+
+static int16_t DrvCanRead (CO_IF_FRM *frm)
+{
+    CO_IF_FD_FRM  fd;
+    int16_t       result;
+    uint8_t       byte;
+
+    result = DrvCanFdRead(&fd);
+    if (result <= 0) {
+        return (result);
+    }
+    if ((fd.Flags & CO_IF_FD_FDF) != 0u) {  /* classical controller drops FD */
+        return (0u);
+    }
+    frm->Identifier = fd.Identifier;
+    frm->DLC        = fd.DLC;
+    for (byte = 0u; byte < 8u; byte++) {
+        frm->Data[byte] = fd.Data[byte];
+    }
+    return (sizeof(CO_IF_FRM));
+}
+
+static void DrvCanFdEnable(uint32_t nominal, uint32_t data)
+{
+    SIM_CAN_BUS *bus = &CanBus;
+
+    DrvCanEnable(nominal);
+    bus->DataRate = data;
+}
+
+static int16_t DrvCanFdSend(CO_IF_FD_FRM *frm)
 {
     int16_t       result = 0u;
-    SIM_CAN_BUS  *bus    = &CanBus;;
-    CO_IF_FRM    *tx;
+    SIM_CAN_BUS  *bus    = &CanBus;
+    SIM_CAN_FRM  *tx;
     uint8_t       byte;
     
     if ((bus->Status & SIM_CAN_STAT_ACTIVE) == 0u) {   /* CAN bus is passive */
         return ((int16_t)-1u);
     }
+    if ((frm->DLC > CO_IF_FD_DLEN) ||
+        (((frm->Flags & CO_IF_FD_FDF) == 0u) && (frm->DLC > 8u))) {
+        return ((int16_t)-1u);
+    }
+    if (SimCanLoss(&bus->TxLoss) != 0u) {       /* sent, but lost on the bus */
+        return (sizeof(CO_IF_FD_FRM));
+    }
 
     tx = bus->TxWr;
     bus->TxWr++;
@@ -133,24 +214,24 @@ static int16_t DrvCanSend(CO_IF_FRM *frm)
     } else {
         tx->Identifier = frm->Identifier;
         tx->DLC        = frm->DLC;
-        for (byte = 0u; byte < 8u; byte++) {
+        tx->Flags      = frm->Flags;
+        for (byte = 0u; byte < CO_IF_FD_DLEN; byte++) {
             if (frm->DLC > byte) {
                 tx->Data[byte] = frm->Data[byte] & 0xFFu;
             } else {
                 tx->Data[byte] = 0u;
             }
         }
-        result = sizeof(CO_IF_FRM);
+        result = sizeof(CO_IF_FD_FRM);
     }
     return (result);
 }
 
-static int16_t DrvCanRead (CO_IF_FRM *frm)
+static int16_t DrvCanFdRead (CO_IF_FD_FRM *frm)
 {
     int16_t       result = 0u;
     SIM_CAN_BUS  *bus    = &CanBus;
-    CO_IF_FRM    *rx;
-    uint8_t       byte;
+    SIM_CAN_FRM  *rx;
 
     if ((bus->Status & SIM_CAN_STAT_ACTIVE) == 0u) {   /* CAN bus is passive */
         return ((int16_t)-1u);
@@ -162,17 +243,8 @@ static int16_t DrvCanRead (CO_IF_FRM *frm)
         if (bus->RxRd >= &bus->RxQ[SIM_CAN_Q_LEN]) {
             bus->RxRd = &bus->RxQ[0u];
         }
-
-        frm->Identifier = rx->Identifier;
-        frm->DLC        = rx->DLC;
-        for (byte = 0u; byte < 8u; byte++) {
-            if (frm->DLC > byte) {
-                frm->Data[byte] = rx->Data[byte] & 0xFFu;
-            } else {
-                frm->Data[byte] = 0u;
-            }
-        }
-        result = sizeof(CO_IF_FRM);
+        *frm   = *rx;
+        result = sizeof(CO_IF_FD_FRM);
     }
     return (result);
 }
@@ -193,6 +265,18 @@ static void DrvCanClose(void)
     bus->Status &= ~SIM_CAN_STAT_ACTIVE;
 }
 
+static uint8_t SimCanLoss(uint32_t *mask)
+{
+    SIM_CAN_BUS *bus  = &CanBus;
+    uint8_t      lost = (uint8_t)(*mask & 1u);
+
+    *mask >>= 1;
+    if (lost != 0u) {
+        bus->Lost++;
+    }
+    return (lost);
+}
+
 /******************************************************************************
 * SPECIAL PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -201,7 +285,7 @@ int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
 {
     int16_t         result = 0u;
     SIM_CAN_BUS    *bus    = &CanBus;
-    CO_IF_FRM      *tx;
+    SIM_CAN_FRM    *tx;
     CO_IF_FRM      *frm;
 
     if (bus->TxRd != bus->TxWr) {
@@ -238,8 +322,11 @@ int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
 {
     int16_t       result = 0u;
     SIM_CAN_BUS  *bus    = &CanBus;
-    CO_IF_FRM    *rx;
+    SIM_CAN_FRM  *rx;
 
+    if (SimCanLoss(&bus->RxLoss) != 0u) {       /* lost before the receiver  */
+        return (sizeof(CO_IF_FRM));
+    }
     rx = bus->RxWr;
     bus->RxWr++;
     if (bus->RxWr >= &bus->RxQ[SIM_CAN_Q_LEN]) {
@@ -251,6 +338,7 @@ int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
     } else {
         rx->Identifier = Identifier;
         rx->DLC        = DLC;
+        rx->Flags      = 0u;
         rx->Data[0u]   = Byte0 & 0xFFu;
         rx->Data[1u]   = Byte1 & 0xFFu;
         rx->Data[2u]   = Byte2 & 0xFFu;
@@ -265,6 +353,76 @@ int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
     return (result);
 }
 
+int16_t SimCanGetFdFrm(CO_IF_FD_FRM *frm)
+{
+    int16_t         result = 0u;
+    SIM_CAN_BUS    *bus    = &CanBus;
+
+    if (bus->TxRd != bus->TxWr) {
+        if (frm != NULL) {
+            *frm = *bus->TxRd;
+        }
+        bus->TxRd++;
+        if (bus->TxRd >= &bus->TxQ[SIM_CAN_Q_LEN]) {
+            bus->TxRd = &bus->TxQ[0u];
+        }
+        result = 1u;
+    }
+
+    return (result);
+}
+
+int16_t SimCanSetFdFrm(uint32_t Identifier, uint8_t Flags,
+                       const uint8_t *Data, uint8_t DLC)
+{
+    int16_t       result = 0u;
+    SIM_CAN_BUS  *bus    = &CanBus;
+    SIM_CAN_FRM  *rx;
+    uint8_t       byte;
+
+    if (DLC > CO_IF_FD_DLEN) {
+        return (result);
+    }
+    if (SimCanLoss(&bus->RxLoss) != 0u) {       /* lost before the receiver  */
+        return (sizeof(CO_IF_FD_FRM));
+    }
+    rx = bus->RxWr;
+    bus->RxWr++;
+    if (bus->RxWr >= &bus->RxQ[SIM_CAN_Q_LEN]) {
+        bus->RxWr = &bus->RxQ[0u];
+    }
+    if (bus->RxWr == bus->RxRd) {
+        bus->RxOvr++;
+        bus->RxWr = rx;
+    } else {
+        rx->Identifier = Identifier;
+        rx->DLC        = DLC;
+        rx->Flags      = Flags;
+        for (byte = 0u; byte < CO_IF_FD_DLEN; byte++) {
+            rx->Data[byte] = (byte < DLC) ? Data[byte] : 0u;
+        }
+        result         = sizeof(CO_IF_FD_FRM);
+    }
+
+    return (result);
+}
+
+void SimCanSetLoss(uint32_t tx, uint32_t rx)
+{
+    SIM_CAN_BUS *bus = &CanBus;
+
+    bus->TxLoss = tx;
+    bus->RxLoss = rx;
+    bus->Lost   = 0u;
+}
+
+uint32_t SimCanGetLost(void)
+{
+    SIM_CAN_BUS *bus = &CanBus;
+
+    return (bus->Lost);
+}
+
 void SimCanSetIsr(SIM_CAN_IRQ handler)
 {
     SIM_CAN_BUS *bus = &CanBus;
@@ -281,6 +439,18 @@ void SimCanRun(void)
     }
 }
 
+int16_t SimCanSendBatch (CO_IF_FRM *frm, uint8_t num)
+{
+    uint8_t n;
+
+    for (n = 0u; n < num; n++) {
+        if (DrvCanSend(&frm[n]) < 0) {
+            break;
+        }
+    }
+    return ((n > 0u) ? (int16_t)n : (int16_t)-1);
+}
+
 void SimCanFlush (void)
 {
     SIM_CAN_BUS *bus = &CanBus;
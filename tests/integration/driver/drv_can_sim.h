@@ -26,6 +26,7 @@ extern "C" {
 ******************************************************************************/
 
 #include "co_if.h"
+#include "co_if_fd.h"
 
 /******************************************************************************
 * PUBLIC TYPES
@@ -38,20 +39,31 @@ typedef void (*SIM_CAN_IRQ)(void);
 ******************************************************************************/
 
 extern const CO_IF_CAN_DRV SimCanDriver;
+extern const CO_IF_FD_DRV  SimCanFdDriver;
 
 /******************************************************************************
 * SPECIAL PUBLIC DRIVER FUNCTIONS
 ******************************************************************************/
 
-/* CAN Bus Simulation Interface (for interfacing with automated tests only) */
+/* CAN Bus Simulation Interface (for interfacing with automated tests only)
+ * Frame loss: bit n of the masks in SimCanSetLoss() drops the n-th next
+ * frame (n = 0: next frame), which is sent by the node (tx) or to the node
+ * (rx). The masks are cleared with the driver initialization.
+ */
 int16_t     SimCanGetFrm    (uint8_t *buf, uint16_t size);
 int16_t     SimCanSetFrm    (uint32_t Identifier, uint8_t DLC,
                              uint8_t Byte0, uint8_t Byte1, uint8_t Byte2,
                              uint8_t Byte3, uint8_t Byte4, uint8_t Byte5,
                              uint8_t Byte6, uint8_t Byte7);
+int16_t     SimCanGetFdFrm  (CO_IF_FD_FRM *frm);
+int16_t     SimCanSetFdFrm  (uint32_t Identifier, uint8_t Flags,
+                             const uint8_t *Data, uint8_t DLC);
 void        SimCanSetIsr    (SIM_CAN_IRQ handler);
+void        SimCanSetLoss   (uint32_t tx, uint32_t rx);
+uint32_t    SimCanGetLost   (void);
 void        SimCanRun       (void);
 void        SimCanFlush     (void);
+int16_t     SimCanSendBatch (CO_IF_FRM *frm, uint8_t num);
 
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
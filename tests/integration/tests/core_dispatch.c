@@ -0,0 +1,150 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_dispatch.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK DispatchCb;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that the table holds the services of the node and follows
+*          a changed RPDO COB-ID:
+*          - PDO #0 (COB-ID 0x201, changed to 0x281)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Dispatch_Table)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id   = 0x40000200;
+    uint32_t rpdo_map  = 0x25000B08;
+    uint8_t  rpdo_type = 254;
+    uint8_t  rpdo_len  = 1;
+    uint8_t  data8     = 0;
+    uint16_t inst;
+    uint32_t builds;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNode(&node, 0);
+    CODispatchInit(&node);
+
+    TS_ASSERT(CO_DISPATCH_NMT     == CODispatchFind(0x000, 0));
+    TS_ASSERT(CO_DISPATCH_SYNC    == CODispatchFind(0x080, 0));
+    TS_ASSERT(CO_DISPATCH_SDO_SRV == CODispatchFind(0x601, 0));
+    TS_ASSERT(CO_DISPATCH_NMT     == CODispatchFind(0x701, 0));
+    TS_ASSERT(CO_DISPATCH_LSS     == CODispatchFind(0x7E5, 0));
+    TS_ASSERT(CO_DISPATCH_RPDO    == CODispatchFind(0x201, &inst));
+    TS_ASSERT(0                   == inst);
+    TS_ASSERT(CO_DISPATCH_NONE    == CODispatchFind(0x123, 0));
+    TS_ASSERT(CO_DISPATCH_NONE    == CODispatchFind(0x1FFFFFFF, 0));
+
+    builds = CODispatchStat()->Builds;
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1400, 1), 0xC0000200));
+    TS_ASSERT(CO_DISPATCH_NONE    == CODispatchFind(0x201, 0));
+    TS_ASSERT(CO_ERR_NONE == CODictWrLong(&node.Dict, CO_DEV(0x1400, 1), 0x40000280));
+    TS_ASSERT(CO_DISPATCH_RPDO    == CODispatchFind(0x281, &inst));
+    TS_ASSERT(0                   == inst);
+    TS_ASSERT((builds + 2u)       == CODispatchStat()->Builds);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that frames with unused identifiers are passed to the
+*          application directly, while the frames of the node services are processed:
+*          - CAN frame 0x123 (not used)
+*          - PDO #0 (COB-ID 0x201)
+*          - SDO request (COB-ID 0x601)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Dispatch_Bypass)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  rpdo_id   = 0x40000200;
+    uint32_t  rpdo_map  = 0x25000B08;
+    uint8_t   rpdo_type = 254;
+    uint8_t   rpdo_len  = 1;
+    uint8_t   data8     = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+    CODispatchInit(&node);
+
+    SimCanSetFrm(0x123, 2, 0x11, 0x22, 0, 0, 0, 0, 0, 0);
+    SimCanRun();
+    CHK_NOCAN(&frm);
+    CHK_CB_IF_RECEIVE(&DispatchCb, 1);
+    TS_ASSERT(1 == CODispatchStat()->Bypassed);
+
+    TS_PDO_SEND(0x201, 0x51);
+    TS_ASSERT(0x51 == data8);
+
+    TS_SDO_SEND(0x40, 0x1000, 0, 0);                  /* upload device type                       */
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x43);
+
+    TS_ASSERT(1 == CODispatchStat()->Bypassed);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+static void DispatchSetup(void)
+{
+    TS_CallbackInit(&DispatchCb);
+}
+
+static void DispatchCleanup(void)
+{
+    TS_CallbackDeInit();
+    CODispatchInit((CO_NODE *)0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CORE_DISPATCH()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(DispatchSetup, DispatchCleanup);
+
+    TS_RUNNER(TS_Dispatch_Table);
+    TS_RUNNER(TS_Dispatch_Bypass);
+
+    TS_End();
+}
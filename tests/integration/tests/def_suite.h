@@ -51,6 +51,7 @@ typedef enum DEF_OD_SUITES_E {                        /*---- Object Dictionary T
 typedef enum DEF_CORE_SUITES_E {                      /*---- Core Component Test Suites ----------*/
     DEF_S_CORE_TMR,                                   /*!< Suite: Highspeed Timer                 */
     DEF_S_MIN_TIME,                                   /*!< Suite: COTmrGetMinTime()               */
+    DEF_S_CORE_DISPATCH,                              /*!< Suite: COB-ID Dispatch Table           */
 
     DEF_S_CORE_NUM                                    /*!< Number of Suites in Group              */
 } DEF_CORE_SUITES;
@@ -62,6 +63,9 @@ typedef enum DEF_SDOS_SUITES_E {                      /*---- SDO Server Test Sui
     DEF_S_SEG_DOWN,                                   /*!< Suite: SDO Segmented Download          */
     DEF_S_BLK_UP,                                     /*!< Suite: SDO Block Upload                */
     DEF_S_BLK_DOWN,                                   /*!< Suite: SDO Block Download              */
+    DEF_S_SDOS_POOL,                                  /*!< Suite: SDO Server Buffer Pool          */
+    DEF_S_SDOS_ZC,                                    /*!< Suite: SDO Zero-Copy Upload            */
+    DEF_S_SDOS_DEFER,                                 /*!< Suite: SDO Deferred Object Access      */
 
     DEF_S_SDOS_NUM                                    /*!< Number of Suites in Group              */
 } DEF_SDOS_SUITES;
@@ -70,6 +74,13 @@ typedef enum DEF_PDO_SUITES_E {                       /*---- PDO Communication T
     DEF_S_PDO_TX,                                     /*!< Suite: PDO Transmit                    */
     DEF_S_PDO_RX,                                     /*!< Suite: PDO Receive                     */
     DEF_S_PDO_DYN,                                    /*!< Suite: Dynamic PDO Configuration       */
+    DEF_S_PDO_PLAN,                                   /*!< Suite: Precompiled PDO Plans           */
+    DEF_S_PDO_DIRTY,                                  /*!< Suite: TPDO Change-of-State Tracking   */
+    DEF_S_PDO_MPDO,                                   /*!< Suite: Multiplexed PDOs                */
+    DEF_S_PDO_SCHED,                                  /*!< Suite: TPDO Timing Scheduler           */
+    DEF_S_PDO_FD,                                     /*!< Suite: CAN FD PDOs                     */
+    DEF_S_PDO_SHADOW,                                 /*!< Suite: Shadow PDO Mappings             */
+    DEF_S_PDO_MON,                                    /*!< Suite: RPDO Deadline Monitoring        */
 
     DEF_S_PDO_NUM                                     /*!< Number of Suites in Group              */
 } DEF_PDO_SUITES;
@@ -103,6 +114,9 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
     DEF_S_CSDO_EXP_DOWN,                              /*!< Suite: SDO Download Expedited          */
     DEF_S_CSDO_SEG_UP,                                /*!< Suite: SDO Upload Segmented            */
     DEF_S_CSDO_SEG_DOWN,                              /*!< Suite: SDO Download Segmented          */
+    DEF_S_CSDO_BLK_UP,                                /*!< Suite: SDO Upload Block                */
+    DEF_S_CSDO_BLK_DOWN,                              /*!< Suite: SDO Download Block              */
+    DEF_S_CSDO_QUEUE,                                 /*!< Suite: SDO Client Request Queue        */
 
     DEF_S_CSDO_NUM                                    /*!< Number of Suites in Group              */
 } DEF_CSDO_SUITES;
@@ -112,6 +126,7 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
 ******************************************************************************/
 
 #define SUITE_CORE_TMR()   TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_TMR)  /*!< \addtogroup core_tmr    Core Timer Test     */
+#define SUITE_CORE_DISPATCH() TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_DISPATCH) /*!< \addtogroup core_dispatch COB-ID Dispatch Test */
 
 #define SUITE_OD_API()     TS_DEF_SUITE(DEF_G_OD, DEF_S_OD_API)      /*!< \addtogroup od_api  Object Dictionary API Test */
 
@@ -121,10 +136,20 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
 #define SUITE_SEG_DOWN()   TS_DEF_SUITE(DEF_G_SDOS, DEF_S_SEG_DOWN)  /*!< \addtogroup sdos_seg_down SDO Server Test: Segmented Download */
 #define SUITE_BLK_UP()     TS_DEF_SUITE(DEF_G_SDOS, DEF_S_BLK_UP)    /*!< \addtogroup sdos_blk_up   SDO Server Test: Block Upload       */
 #define SUITE_BLK_DOWN()   TS_DEF_SUITE(DEF_G_SDOS, DEF_S_BLK_DOWN)  /*!< \addtogroup sdos_blk_down SDO Server Test: Block Download     */
+#define SUITE_SDOS_POOL()  TS_DEF_SUITE(DEF_G_SDOS, DEF_S_SDOS_POOL) /*!< \addtogroup sdos_pool     SDO Server Test: Buffer Pool        */
+#define SUITE_SDOS_ZC()    TS_DEF_SUITE(DEF_G_SDOS, DEF_S_SDOS_ZC)   /*!< \addtogroup sdos_zc       SDO Server Test: Zero-Copy Upload   */
+#define SUITE_SDOS_DEFER() TS_DEF_SUITE(DEF_G_SDOS, DEF_S_SDOS_DEFER) /*!< \addtogroup sdos_defer    SDO Server Test: Deferred Access    */
 
 #define SUITE_PDO_TX()     TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_TX)     /*!< \addtogroup pdo_tx  PDO Communication Test: PDO Transmit */
 #define SUITE_PDO_RX()     TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_RX)     /*!< \addtogroup pdo_rx  PDO Communication Test: PDO Receive  */
 #define SUITE_PDO_DYN()    TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_DYN)    /*!< \addtogroup pdo_dyn Dynamic PDO Configuration Test       */
+#define SUITE_PDO_PLAN()   TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_PLAN)   /*!< \addtogroup pdo_plan Precompiled PDO Plan Test          */
+#define SUITE_PDO_DIRTY()  TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_DIRTY)  /*!< \addtogroup pdo_dirty TPDO Change-of-State Test        */
+#define SUITE_PDO_MPDO()   TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_MPDO)   /*!< \addtogroup pdo_mpdo Multiplexed PDO Test             */
+#define SUITE_PDO_SCHED()  TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_SCHED)  /*!< \addtogroup pdo_sched TPDO Timing Scheduler Test       */
+#define SUITE_PDO_FD()     TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_FD)     /*!< \addtogroup pdo_fd CAN FD PDO Test                    */
+#define SUITE_PDO_SHADOW() TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_SHADOW) /*!< \addtogroup pdo_shadow Shadow PDO Mapping Test         */
+#define SUITE_PDO_MON()    TS_DEF_SUITE(DEF_G_PDO, DEF_S_PDO_MON)    /*!< \addtogroup pdo_mon RPDO Deadline Monitoring Test     */
 
 #define SUITE_NMT_MGR()    TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_MGR)    /*!< \addtogroup nmt_mgr NMT Management            */
 #define SUITE_NMT_HBP()    TS_DEF_SUITE(DEF_G_NMT, DEF_S_NMT_HBP)    /*!< \addtogroup nmt_hbp NMT Heartbeat Producer    */
@@ -142,5 +167,8 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
 #define SUITE_CSDO_EXP_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_EXP_DOWN)  /*!< \addtogroup csdo_exp_down  SDO Client Expedited Download Test */
 #define SUITE_CSDO_SEG_UP()   TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_SEG_UP)    /*!< \addtogroup csdo_seg_down  SDO Client Segmented Upload Test   */
 #define SUITE_CSDO_SEG_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_SEG_DOWN)  /*!< \addtogroup csdo_seg_down  SDO Client Segmented Download Test */
+#define SUITE_CSDO_BLK_UP()   TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_BLK_UP)    /*!< \addtogroup csdo_blk_up    SDO Client Block Upload Test       */
+#define SUITE_CSDO_BLK_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_BLK_DOWN)  /*!< \addtogroup csdo_blk_down  SDO Client Block Download Test     */
+#define SUITE_CSDO_QUEUE()    TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_QUEUE)     /*!< \addtogroup csdo_queue     SDO Client Request Queue Test      */
 
 #endif /* DEF_SUITE_H_ */
@@ -240,6 +240,90 @@ TS_DEF_MAIN(TS_OD_GetIndirect)
     CHK_NO_ERR(&node); /* check error free stack execution         */
 }
 
+TS_DEF_MAIN(TS_OD_StageCommit)
+{
+    int16_t     result;
+    uint32_t    dup;
+    uint32_t    n;
+    uint32_t    val;
+    CO_NODE     node;
+    CO_OBJ     *od;
+
+    TS_CreateMandatoryDir();
+    for (n = 0; n < 16; n++) {                        /* stage in descending order */
+        TS_ODStage(CO_KEY(0x2100 + (15 - n), 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(15 - n));
+    }
+    dup = TS_ODCommit();
+    TS_ODAdd(CO_KEY(0x2080, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(80));
+    TS_CreateNode(&node, 0);
+
+    TS_ASSERT(dup == 0);
+    od = node.Dict.Root;
+    while (od[1].Key != 0) {                          /* check ascending order */
+        TS_ASSERT((od[0].Key >> 8) < (od[1].Key >> 8));
+        od++;
+    }
+    result = CODictRdLong(&node.Dict, CO_DEV(0x2107,0), &val);
+    TS_ASSERT(CO_ERR_NONE == result);
+    TS_ASSERT(val == 7);
+    result = CODictRdLong(&node.Dict, CO_DEV(0x2080,0), &val);
+    TS_ASSERT(CO_ERR_NONE == result);
+    TS_ASSERT(val == 80);
+
+    CHK_NO_ERR(&node); /* check error free stack execution         */
+}
+
+TS_DEF_MAIN(TS_OD_StageDuplicate)
+{
+    int16_t     result;
+    uint32_t    dup;
+    uint32_t    val;
+    CO_NODE     node;
+
+    TS_CreateMandatoryDir();
+    TS_ODStage(CO_KEY(0x2101, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(1));
+    TS_ODStage(CO_KEY(0x2100, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(5));
+    TS_ODStage(CO_KEY(0x2101, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(1));
+    TS_ODStage(CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(4));
+    dup = TS_ODCommit();
+    TS_CreateNode(&node, 0);
+
+    TS_ASSERT(dup == 2);
+    result = CODictRdLong(&node.Dict, CO_DEV(0x2100,0), &val);
+    TS_ASSERT(CO_ERR_NONE == result);
+    TS_ASSERT(val == 5);
+    result = CODictRdLong(&node.Dict, CO_DEV(0x2101,0), &val);
+    TS_ASSERT(CO_ERR_NONE == result);
+    TS_ASSERT(val == 1);
+
+    CHK_NO_ERR(&node); /* check error free stack execution         */
+}
+
+TS_DEF_MAIN(TS_OD_StageLastWins)
+{
+    int16_t     result;
+    uint32_t    dup;
+    uint32_t    n;
+    uint32_t    val;
+    CO_NODE     node;
+
+    TS_CreateMandatoryDir();
+    for (n = 0; n < 36; n++) {                        /* 3 rounds of 12 keys */
+        TS_ODStage(CO_KEY(0x2100 + (11 - (n % 12)), 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(n));
+    }
+    dup = TS_ODCommit();
+    TS_CreateNode(&node, 0);
+
+    TS_ASSERT(dup == 24);
+    for (n = 0; n < 12; n++) {                        /* last round is kept */
+        result = CODictRdLong(&node.Dict, CO_DEV(0x2100 + (11 - n), 0), &val);
+        TS_ASSERT(CO_ERR_NONE == result);
+        TS_ASSERT(val == 24 + n);
+    }
+
+    CHK_NO_ERR(&node); /* check error free stack execution         */
+}
+
 SUITE_OD_API()
 {
     TS_Begin(__FILE__);
@@ -266,6 +350,9 @@ SUITE_OD_API()
 
     TS_RUNNER(TS_OD_GetDirect);
     TS_RUNNER(TS_OD_GetIndirect);
+    TS_RUNNER(TS_OD_StageCommit);
+    TS_RUNNER(TS_OD_StageDuplicate);
+    TS_RUNNER(TS_OD_StageLastWins);
     // TS_RUNNER(TS_OD_GetStringReadOnly);
     TS_End();
 }
@@ -0,0 +1,275 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_tpdo_dirty.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that changes of several mapped objects trigger the
+*          TPDO exactly once:
+*          - PDO #0 (2 separate bytes in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdoDirty_OncePerPdo)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map[2]  = { 0x25000B08, 0x25000C08 };
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 2;
+    uint8_t   data[2]      = { 0x91, 0x92 };
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[1]));
+    TS_CreateNodeAutoStart(&node);
+    TS_ASSERT(0 == COTPdoDirtyInit(&node));
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x11);    /* change object values              */
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0C), 0x22);
+    CHK_NOCAN(&frm);                                  /* check for no CAN frame before flush      */
+
+    TS_ASSERT(1 == COTPdoFlushDirty(&node));
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 2);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x11);
+    CHK_BYTE (frm, 1, 0x22);
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    TS_ASSERT(0 == COTPdoFlushDirty(&node));          /* dirty marks are cleared                  */
+    CHK_NOCAN(&frm);
+
+    COTPdoDirtyInit((CO_NODE *)0);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that a change of an object, which is mapped into two
+*          TPDOs, triggers both TPDOs:
+*          - PDO #0 (1 byte in content)
+*          - PDO #1 (2 separate bytes in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdoDirty_SharedObj)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id[2]   = { 0x40000180, 0x40000280 };
+    uint32_t  tpdo_map0    = 0x25000B08;
+    uint32_t  tpdo_map1[2] = { 0x25000C08, 0x25000B08 };
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len[2]  = { 1, 2 };
+    uint8_t   data[2]      = { 0x91, 0x92 };
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id[0], &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map0,    &tpdo_len[0]);
+    TS_CreateTPdoCom(1, &tpdo_id[1], &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(1, &tpdo_map1[0], &tpdo_len[1]);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[1]));
+    TS_CreateNodeAutoStart(&node);
+    COTPdoDirtyInit(&node);
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x11);    /* change shared object value        */
+    TS_ASSERT(2 == COTPdoFlushDirty(&node));
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x11);
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x281, 2);                         /* check PDO #1 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x92);
+    CHK_BYTE (frm, 1, 0x11);
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0C), 0x22);    /* change object in PDO #1 only      */
+    TS_ASSERT(1 == COTPdoFlushDirty(&node));
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x281, 2);                         /* check PDO #1 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x22);
+    CHK_NOCAN(&frm);
+
+    COTPdoDirtyInit((CO_NODE *)0);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that changes of objects, which are not mapped into
+*          a TPDO, trigger nothing.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdoDirty_Unmapped)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data[3]      = { 0x91, 0x92, 0x93 };
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[1]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&data[2]));
+    TS_CreateNodeAutoStart(&node);
+    COTPdoDirtyInit(&node);
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0C), 0x22);    /* mappable, but not mapped          */
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0D), 0x33);    /* not mappable                      */
+    TS_ASSERT(0 == COTPdoFlushDirty(&node));
+    CHK_NOCAN(&frm);                                  /* check for no CAN frame                   */
+
+    node.TPdo[0].ObjNum = 0;                          /* simulate a removed mapping               */
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x11);
+    TS_ASSERT(0 == COTPdoFlushDirty(&node));
+    CHK_NOCAN(&frm);
+
+    TS_ASSERT(-1 == COTPdoFlushDirty((CO_NODE *)0));
+
+    COTPdoDirtyInit((CO_NODE *)0);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check, that flushed changes honour the inhibit time:
+*          - PDO #0 (1 byte in content, inhibit time 100ms)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdoDirty_Inhibit)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 1000;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+    COTPdoDirtyInit(&node);
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x11);    /* change object value               */
+    TS_ASSERT(1 == COTPdoFlushDirty(&node));
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x11);
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x22);    /* change object value again         */
+    TS_ASSERT(1 == COTPdoFlushDirty(&node));
+    CHK_NOCAN(&frm);                                  /* check for no CAN frame (inhibit time)    */
+
+    TS_Wait(&node, 100);                              /* wait 100ms                               */
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x22);
+
+    COTPdoDirtyInit((CO_NODE *)0);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC5
+*
+*          This testcase will check, that the tracking is refused for a dictionary with more
+*          entries than dirty bits.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdoDirty_DictTooLarge)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data         = 0x91;
+    uint16_t  num;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data));
+    TS_CreateNodeAutoStart(&node);
+
+    num           = node.Dict.Num;
+    node.Dict.Num = (uint16_t)(CO_TPDO_DIRTY_OBJ_N + 1u);  /* simulate a too large dictionary     */
+    TS_ASSERT(0 > COTPdoDirtyInit(&node));
+    node.Dict.Num = num;
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x11);    /* change object value               */
+    TS_ASSERT(0 > COTPdoFlushDirty(&node));           /* tracking is disabled                     */
+    CHK_NOCAN(&frm);
+
+    COTPdoDirtyInit((CO_NODE *)0);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_PDO_DIRTY()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_TPdoDirty_OncePerPdo);
+    TS_RUNNER(TS_TPdoDirty_SharedObj);
+    TS_RUNNER(TS_TPdoDirty_Unmapped);
+    TS_RUNNER(TS_TPdoDirty_Inhibit);
+    TS_RUNNER(TS_TPdoDirty_DictTooLarge);
+
+    TS_End();
+}
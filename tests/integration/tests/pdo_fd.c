@@ -0,0 +1,224 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_if_fd.h"
+#include "co_pdo_fd.h"
+#include "co_unsigned64.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define FD_TPDO_ID       0x190u              /* COB-ID of FD TPDO #0             */
+#define FD_RPDO_ID       0x210u              /* COB-ID of FD RPDO #0             */
+#define FD_DATA_RATE     2000000u            /* data phase bit rate              */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* map num UNSIGNED64 objects 0x2600:1..num into the FD PDO records */
+static void FdCreatePdo(uint16_t com, uint16_t map, uint32_t id, uint64_t *val, uint8_t num)
+{
+    uint8_t n;
+
+    TS_ODAdd(CO_KEY(com, 1, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(id));
+    TS_ODAdd(CO_KEY(map, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(num));
+    for (n = 1; n <= num; n++) {
+        TS_ODAdd(CO_KEY(map, n, CO_OBJ_D___R_), CO_TUNSIGNED32,
+                 (CO_DATA)(CO_LINK(0x2600, n, 64)));
+        TS_ODAdd(CO_KEY(0x2600, n, CO_OBJ____PRW), CO_TUNSIGNED64,
+                 (CO_DATA)(&val[n - 1]));
+    }
+}
+
+/* connect the node to the simulated CAN FD bus */
+static void FdConnect(CO_NODE *node)
+{
+    COIfFdInit(&SimCanFdDriver, FD_DATA_RATE, COPdoFdReceive);
+    node->If.Drv->Can = &COIfFdCanDriver;
+}
+
+/* connect the test drivers back to the classical CAN bus */
+static void FdDisconnect(CO_NODE *node)
+{
+    node->If.Drv->Can = &SimCanDriver;
+    COIfFdInit((const CO_IF_FD_DRV *)0, 0, (CO_IF_FD_RECV)0);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check the transmission of a FD TPDO with 48 data bytes:
+*          - 6 mapped UNSIGNED64 objects in a CAN FD frame with bit rate switch
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoFd_Tx)
+{
+    CO_IF_FD_FRM frm;
+    CO_NODE      node;
+    uint64_t     val[6];
+    uint8_t      n;
+
+    for (n = 0; n < 6; n++) {
+        val[n] = 0x0807060504030201uLL + ((uint64_t)n << 56);
+    }
+    TS_CreateMandatoryDir();
+    FdCreatePdo(CO_PDO_FD_TCOM, CO_PDO_FD_TMAP, FD_TPDO_ID, &val[0], 6);
+    TS_CreateNodeAutoStart(&node);
+    FdConnect(&node);
+
+    TS_ASSERT(1 == COPdoFdInit(&node));
+    TS_ASSERT(CO_ERR_NONE == COPdoFdTx(0));
+
+    TS_ASSERT(1 == SimCanGetFdFrm(&frm));             /* check for a CAN FD frame                 */
+    TS_ASSERT(FD_TPDO_ID == frm.Identifier);
+    TS_ASSERT(48 == frm.DLC);
+    TS_ASSERT((CO_IF_FD_FDF | CO_IF_FD_BRS) == frm.Flags);
+    TS_ASSERT(0x01 == frm.Data[0]);
+    TS_ASSERT(0x08 == frm.Data[7]);
+    TS_ASSERT(0x01 == frm.Data[40]);
+    TS_ASSERT(0x0D == frm.Data[47]);
+    TS_ASSERT(0 == SimCanGetFdFrm(&frm));             /* check for no further CAN frame           */
+    TS_ASSERT(1 == COPdoFdStat()->Tx);
+
+    FdDisconnect(&node);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check the reception of a FD RPDO with 64 data bytes:
+*          - 8 mapped UNSIGNED64 objects; classical frames are still passed to the stack
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoFd_Rx)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint64_t  val[8] = { 0 };
+    uint8_t   data[64];
+    uint8_t   n;
+
+    for (n = 0; n < 64; n++) {
+        data[n] = n;
+    }
+    TS_CreateMandatoryDir();
+    FdCreatePdo(CO_PDO_FD_RCOM, CO_PDO_FD_RMAP, FD_RPDO_ID, &val[0], 8);
+    TS_CreateNodeAutoStart(&node);
+    FdConnect(&node);
+
+    TS_ASSERT(1 == COPdoFdInit(&node));
+
+    SimCanSetFdFrm(FD_RPDO_ID, CO_IF_FD_FDF | CO_IF_FD_BRS, &data[0], 64);
+    SimCanRun();
+
+    TS_ASSERT(0x0706050403020100uLL == val[0]);
+    TS_ASSERT(0x3F3E3D3C3B3A3938uLL == val[7]);
+    TS_ASSERT(1 == COPdoFdStat()->Rx);
+
+    TS_SDO_SEND (0x40, 0x1000, 0, 0);                 /* classical SDO request                    */
+    CHK_CAN     (&frm);                               /* check for SDO response                   */
+    CHK_SDO0    (frm, 0x43);
+
+    FdDisconnect(&node);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that a FD RPDO shorter than the mapping is ignored.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoFd_Short)
+{
+    CO_NODE   node;
+    uint64_t  val[8] = { 0 };
+    uint8_t   data[32] = { 0x11 };
+
+    TS_CreateMandatoryDir();
+    FdCreatePdo(CO_PDO_FD_RCOM, CO_PDO_FD_RMAP, FD_RPDO_ID, &val[0], 8);
+    TS_CreateNodeAutoStart(&node);
+    FdConnect(&node);
+
+    TS_ASSERT(1 == COPdoFdInit(&node));
+
+    SimCanSetFdFrm(FD_RPDO_ID, CO_IF_FD_FDF, &data[0], 32);
+    SimCanRun();
+
+    TS_ASSERT(0 == val[0]);
+    TS_ASSERT(0 == COPdoFdStat()->Rx);
+    TS_ASSERT(1 == COPdoFdStat()->Short);
+
+    FdDisconnect(&node);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check, that no FD PDO is sent or received in PRE-OPERATIONAL mode.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoFd_PreOp)
+{
+    CO_IF_FD_FRM frm;
+    CO_NODE      node;
+    uint64_t     val[8] = { 0 };
+    uint8_t      data[64] = { 0x11 };
+
+    TS_CreateMandatoryDir();
+    FdCreatePdo(CO_PDO_FD_TCOM, CO_PDO_FD_TMAP, FD_TPDO_ID, &val[0], 1);
+    FdCreatePdo(CO_PDO_FD_RCOM, CO_PDO_FD_RMAP, FD_RPDO_ID, &val[0], 8);
+    TS_CreateNode(&node, 0);
+    FdConnect(&node);
+
+    TS_ASSERT(2 == COPdoFdInit(&node));
+    TS_ASSERT(CO_ERR_TPDO_COM_OFF == COPdoFdTx(0));
+    TS_ASSERT(0 == SimCanGetFdFrm(&frm));
+
+    SimCanSetFdFrm(FD_RPDO_ID, CO_IF_FD_FDF, &data[0], 64);
+    SimCanRun();
+    TS_ASSERT(0 == val[0]);
+
+    FdDisconnect(&node);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_PDO_FD()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_PdoFd_Tx);
+    TS_RUNNER(TS_PdoFd_Rx);
+    TS_RUNNER(TS_PdoFd_Short);
+    TS_RUNNER(TS_PdoFd_PreOp);
+
+    COPdoFdInit((CO_NODE *)0);
+
+    TS_End();
+}
@@ -0,0 +1,222 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_rpdo_mon.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint16_t MonTimeoutNum;                        /* number of timeout callbacks              */
+static uint16_t MonTimeoutPdo;                        /* RPDO of the last timeout callback        */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TS_PdoMonTimeout(CO_NODE *node, uint16_t num)
+{
+    (void)node;
+    MonTimeoutNum++;
+    MonTimeoutPdo = num;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that a missing RPDO raises the EMCY 0x8250 and calls the
+*          timeout callback once:
+*          - PDO #0 (COB-ID 0x201, deadline 10ms)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoMon_Timeout)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  rpdo_id    = 0x40000200;
+    uint32_t  rpdo_map   = 0x25000B08;
+    uint8_t   rpdo_type  = 254;
+    uint8_t   rpdo_len   = 1;
+    uint16_t  rpdo_event = 10;
+    uint8_t   data8      = 0;
+    uint8_t   emcy;
+    uint8_t   err_reg;
+
+    TS_CreateMandatoryDir();
+    TS_CreateEmcy();
+    emcy = (uint8_t)EmcyAddCode(CO_RPDO_MON_EMCY_CODE, CO_EMCY_REG_COM);
+    TS_CreateRPdoCom(0, &rpdo_id, &rpdo_type);
+    TS_ODAdd(CO_KEY(0x1400, 5, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&rpdo_event));
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+
+    MonTimeoutNum = 0;
+    TS_ASSERT(1 == CORPdoMonInit(&node, 10, emcy, TS_PdoMonTimeout));
+
+    TS_Wait(&node, 20);                               /* monitoring starts with first reception   */
+    CHK_NOCAN(&frm);
+
+    TS_PDO_SEND(0x201, 0x51);
+    TS_ASSERT(0x51 == data8);
+
+    TS_Wait(&node, 9);                                /* wait 9ms                                 */
+    CHK_NOCAN(&frm);
+    TS_ASSERT(0 == MonTimeoutNum);
+
+    TS_Wait(&node, 2);                                /* wait 2ms (deadline expired)              */
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_EMCY (frm);                                   /* check EMCY (Id and DLC)                  */
+    CHK_WORD (frm, 0, 0x8250);                        /* check error code                         */
+    TS_ASSERT(1 == MonTimeoutNum);
+    TS_ASSERT(0 == MonTimeoutPdo);
+    TS_ASSERT(1 == CORPdoMonExpired(0));
+
+    TS_Wait(&node, 30);                               /* timeout is reported once                 */
+    CHK_NOCAN(&frm);
+    TS_ASSERT(1 == MonTimeoutNum);
+
+    TS_PDO_SEND(0x201, 0x61);                         /* reception clears the timeout             */
+    TS_ASSERT(0 == CORPdoMonExpired(0));
+    (void)CODictRdByte(&node.Dict, CO_DEV(0x1001, 0), &err_reg);
+    TS_ASSERT(0 == err_reg);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that RPDOs within their deadline are not reported, while a
+*          stopped RPDO times out with its own deadline:
+*          - PDO #0 (COB-ID 0x201, deadline 10ms, received every 5ms)
+*          - PDO #1 (COB-ID 0x301, deadline 25ms, received once)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoMon_Multi)
+{
+    CO_NODE   node;
+    uint32_t  rpdo_id[2]    = { 0x40000200, 0x40000300 };
+    uint32_t  rpdo_map[2]   = { 0x25000B08, 0x25000C08 };
+    uint8_t   rpdo_type     = 254;
+    uint8_t   rpdo_len      = 1;
+    uint16_t  rpdo_event[2] = { 10, 25 };
+    uint8_t   data8[2]      = { 0, 0 };
+    uint8_t   n;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id[0], &rpdo_type);
+    TS_ODAdd(CO_KEY(0x1400, 5, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&rpdo_event[0]));
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_CreateRPdoCom(1, &rpdo_id[1], &rpdo_type);
+    TS_ODAdd(CO_KEY(0x1401, 5, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&rpdo_event[1]));
+    TS_CreateRPdoMap(1, &rpdo_map[1], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8[1]));
+    TS_CreateNodeAutoStart(&node);
+
+    MonTimeoutNum = 0;
+    TS_ASSERT(2 == CORPdoMonInit(&node, 10, CO_RPDO_MON_NO_EMCY, TS_PdoMonTimeout));
+
+    TS_PDO_SEND(0x301, 0x71);
+    for (n = 0; n < 8; n++) {                         /* 40ms with PDO #0 every 5ms               */
+        TS_PDO_SEND(0x201, n);
+        TS_Wait(&node, 5);
+    }
+
+    TS_ASSERT(1 == MonTimeoutNum);                    /* check only PDO #1 timed out              */
+    TS_ASSERT(1 == MonTimeoutPdo);
+    TS_ASSERT(0 == CORPdoMonExpired(0));
+    TS_ASSERT(1 == CORPdoMonExpired(1));
+    TS_ASSERT(9 == CORPdoMonStat()->Rearmed);
+
+    TS_ASSERT(0 == CORPdoMonSet(0, 0));               /* disable monitoring of PDO #0             */
+    TS_Wait(&node, 20);
+    TS_ASSERT(1 == MonTimeoutNum);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that writes to the event timer change the deadline of a
+*          running monitor:
+*          - PDO #0 (COB-ID 0x201, deadline 10ms, changed to 30ms and disabled)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoMon_Write)
+{
+    CO_NODE   node;
+    uint32_t  rpdo_id    = 0x40000200;
+    uint32_t  rpdo_map   = 0x25000B08;
+    uint8_t   rpdo_type  = 254;
+    uint8_t   rpdo_len   = 1;
+    uint16_t  rpdo_event = 10;
+    uint8_t   data8      = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id, &rpdo_type);
+    TS_ODAdd(CO_KEY(0x1400, 5, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&rpdo_event));
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+
+    MonTimeoutNum = 0;
+    TS_ASSERT(1 == CORPdoMonInit(&node, 10, CO_RPDO_MON_NO_EMCY, TS_PdoMonTimeout));
+
+    TS_ASSERT(CO_ERR_NONE == CODictWrWord(&node.Dict, CO_DEV(0x1400, 5), 30));
+    TS_PDO_SEND(0x201, 0x51);
+
+    TS_Wait(&node, 29);                               /* wait 29ms (old deadline passed)          */
+    TS_ASSERT(0 == MonTimeoutNum);
+
+    TS_Wait(&node, 2);                                /* wait 2ms (new deadline expired)          */
+    TS_ASSERT(1 == MonTimeoutNum);
+    TS_ASSERT(1 == CORPdoMonExpired(0));
+
+    TS_ASSERT(CO_ERR_NONE == CODictWrWord(&node.Dict, CO_DEV(0x1400, 5), 0));
+    TS_ASSERT(0 == CORPdoMonExpired(0));              /* disabled monitor clears the timeout      */
+    TS_ASSERT(0 == CORPdoMonStat()->Monitored);
+
+    TS_PDO_SEND(0x201, 0x61);
+    TS_Wait(&node, 50);
+    TS_ASSERT(1 == MonTimeoutNum);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_PDO_MON()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_PdoMon_Timeout);
+    TS_RUNNER(TS_PdoMon_Multi);
+    TS_RUNNER(TS_PdoMon_Write);
+
+    CORPdoMonInit((CO_NODE *)0, 0, CO_RPDO_MON_NO_EMCY, 0);
+
+    TS_End();
+}
@@ -0,0 +1,286 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <time.h>
+
+#include "def_suite.h"
+#include "co_mpdo.h"
+#include "co_unsigned64.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define MPDO_RX_ID       0x3F0u              /* COB-ID of received MPDOs         */
+#define MPDO_TX_ID       0x3F1u              /* COB-ID of transmitted MPDOs      */
+#define MPDO_RATE_OBJ    100u                /* objects in rate test             */
+#define MPDO_RATE_NUM    1000u               /* MPDOs in rate test               */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void MPdoSend(uint8_t addr, uint16_t idx, uint8_t sub, uint32_t val)
+{
+    SimCanSetFrm(MPDO_RX_ID, 8,
+                 addr,
+                 (uint8_t)(idx),
+                 (uint8_t)(idx >> 8),
+                 sub,
+                 (uint8_t)(val),
+                 (uint8_t)(val >> 8),
+                 (uint8_t)(val >> 16),
+                 (uint8_t)(val >> 24));
+    SimCanRun();
+}
+
+static uint64_t MPdoNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000uLL + (uint64_t)ts.tv_nsec);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check the reception of MPDOs in destination address mode:
+*          - addressed to this node, to all nodes and to another node
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_MPdo_DamRx)
+{
+    CO_NODE  node;
+    uint32_t data32 = 0;
+    uint16_t data16 = 0;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data32));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_CreateNodeAutoStart(&node);
+    TS_ASSERT(2 <= COMPdoInit(&node, MPDO_RX_ID, 0x80000000));
+    TS_ASSERT(0 != COMPdoFind(0, 0x2500, 0x0B));
+
+    MPdoSend(0x81, 0x2500, 0x0B, 0x11223344);         /* to this node                             */
+    TS_ASSERT(0x11223344 == data32);
+
+    MPdoSend(0x80, 0x2500, 0x0C, 0x5566);             /* to all nodes                             */
+    TS_ASSERT(0x5566 == data16);
+
+    MPdoSend(0x82, 0x2500, 0x0B, 0x77);               /* to another node                          */
+    TS_ASSERT(0x11223344 == data32);
+
+    MPdoSend(0x81, 0x2500, 0x0D, 0x77);               /* unknown object                           */
+    TS_ASSERT(2 == COMPdoStat()->Rx);
+    TS_ASSERT(1 == COMPdoStat()->Miss);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check the reception of MPDOs in source address mode with a
+*          block of 2 entries in the object dispatching list.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_MPdo_SamRx)
+{
+    CO_NODE  node;
+    uint64_t disp    = 0x0226000130000505uLL;  /* 2 x 3000:05.. of node 5 to 2600:01..  */
+    uint8_t  data[2] = { 0, 0 };
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1FD0, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(1));
+    TS_ODAdd(CO_KEY(0x1FD0, 0x01, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&disp));
+    TS_ODAdd(CO_KEY(0x2600, 0x01, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2600, 0x02, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&data[1]));
+    TS_CreateNodeAutoStart(&node);
+    TS_ASSERT(2 <= COMPdoInit(&node, MPDO_RX_ID, 0x80000000));
+    TS_ASSERT(0 != COMPdoFind(5, 0x3000, 0x06));
+
+    MPdoSend(0x05, 0x3000, 0x06, 0x92);
+    TS_ASSERT(0x00 == data[0]);
+    TS_ASSERT(0x92 == data[1]);
+
+    MPdoSend(0x05, 0x3000, 0x05, 0x91);
+    TS_ASSERT(0x91 == data[0]);
+
+    MPdoSend(0x06, 0x3000, 0x05, 0x99);               /* other sender                             */
+    TS_ASSERT(0x91 == data[0]);
+    TS_ASSERT(1 == COMPdoStat()->Miss);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check the transmission of a MPDO in destination address mode.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_MPdo_DamTx)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_OBJ   *obj;
+    uint16_t  data16 = 0x9192;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_CreateNodeAutoStart(&node);
+    COMPdoInit(&node, 0x80000000, MPDO_TX_ID);
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500, 0x0B));
+
+    TS_ASSERT(CO_ERR_NONE == COMPdoDamSend(obj, 3));
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, MPDO_TX_ID, 8);                    /* check MPDO (Id and DLC)                  */
+    CHK_BYTE (frm, 0, 0x83);
+    CHK_WORD (frm, 1, 0x2500);
+    CHK_BYTE (frm, 3, 0x0B);
+    CHK_LONG (frm, 4, 0x00009192);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check the transmission of MPDOs in source address mode with a
+*          block of 2 entries in the object scanner list.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_MPdo_SamTx)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  scan    = 0x0225000B;            /* 2 x 2500:0B..                          */
+    uint8_t   data[2] = { 0x91, 0x92 };
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1FA0, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(1));
+    TS_ODAdd(CO_KEY(0x1FA0, 0x01, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&scan));
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&data[1]));
+    TS_CreateNodeAutoStart(&node);
+    COMPdoInit(&node, 0x80000000, MPDO_TX_ID);
+
+    TS_ASSERT(2 == COMPdoSamSend());
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, MPDO_TX_ID, 8);                    /* check MPDO (Id and DLC)                  */
+    CHK_BYTE (frm, 0, 0x01);
+    CHK_WORD (frm, 1, 0x2500);
+    CHK_BYTE (frm, 3, 0x0B);
+    CHK_BYTE (frm, 4, 0x91);
+
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, MPDO_TX_ID, 8);
+    CHK_BYTE (frm, 3, 0x0C);
+    CHK_BYTE (frm, 4, 0x92);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC5
+*
+*          This testcase will check, that MPDOs are ignored outside of the NMT state
+*          OPERATIONAL.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_MPdo_PreOp)
+{
+    CO_NODE  node;
+    uint32_t data32 = 0;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data32));
+    TS_CreateNode(&node, 0);
+    COMPdoInit(&node, MPDO_RX_ID, MPDO_TX_ID);
+
+    MPdoSend(0x81, 0x2500, 0x0B, 0x11223344);
+    TS_ASSERT(0 == data32);
+    TS_ASSERT(0 > COMPdoSamSend());
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC6
+*
+*          This testcase will dispatch 1000 MPDOs to 100 objects through the simulated CAN
+*          driver and check, that the node handles more than 1000 MPDOs per second.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_MPdo_Rate)
+{
+    CO_NODE  node;
+    uint32_t data[MPDO_RATE_OBJ];
+    uint64_t start;
+    uint64_t time;
+    uint32_t n;
+
+    TS_CreateMandatoryDir();
+    for (n = 0; n < MPDO_RATE_OBJ; n++) {
+        data[n] = 0;
+        TS_ODAdd(CO_KEY(0x2500, n + 1, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data[n]));
+    }
+    TS_CreateNodeAutoStart(&node);
+    TS_ASSERT((int16_t)MPDO_RATE_OBJ <= COMPdoInit(&node, MPDO_RX_ID, 0x80000000));
+
+    start = MPdoNow();
+    for (n = 0; n < MPDO_RATE_NUM; n++) {
+        MPdoSend(0x81, 0x2500, (uint8_t)((n % MPDO_RATE_OBJ) + 1), n);
+    }
+    time = MPdoNow() - start;
+
+    TS_ASSERT(MPDO_RATE_NUM == COMPdoStat()->Rx);
+    TS_ASSERT(0 == COMPdoStat()->Miss);
+    TS_ASSERT((MPDO_RATE_NUM - MPDO_RATE_OBJ) == data[0]);
+    TS_ASSERT((MPDO_RATE_NUM - 1) == data[MPDO_RATE_OBJ - 1]);
+    TS_ASSERT(1000000000uLL > time);
+
+    TS_Printf("  %u MPDOs: %u us\n", MPDO_RATE_NUM, (uint32_t)(time / 1000u));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_PDO_MPDO()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_MPdo_DamRx);
+    TS_RUNNER(TS_MPdo_SamRx);
+    TS_RUNNER(TS_MPdo_DamTx);
+    TS_RUNNER(TS_MPdo_SamTx);
+    TS_RUNNER(TS_MPdo_PreOp);
+    TS_RUNNER(TS_MPdo_Rate);
+
+    COMPdoInit((CO_NODE *)0, 0x80000000, 0x80000000);
+
+    TS_End();
+}
@@ -0,0 +1,509 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <time.h>
+
+#include "def_suite.h"
+#include "co_pdo_plan.h"
+#include "co_real64.h"
+#include "co_unsigned48.h"
+#include "co_unsigned64.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define PDO_PLAN_BENCH_NUM   10000u            /* transmissions per measurement    */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint64_t PdoPlanNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000uLL + (uint64_t)ts.tv_nsec);
+}
+
+static uint64_t PdoPlanBench(CO_NODE *node)
+{
+    CO_IF_FRM frm;
+    uint64_t  start;
+    uint64_t  sum = 0;
+    uint32_t  n;
+
+    for (n = 0; n < PDO_PLAN_BENCH_NUM; n++) {
+        start = PdoPlanNow();
+        COTPdoTx(&node->TPdo[0]);
+        sum  += PdoPlanNow() - start;
+        (void)SimCanGetFrm((uint8_t *)&frm, sizeof(CO_IF_FRM));
+    }
+    return (sum / PDO_PLAN_BENCH_NUM);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check the plan transmission of:
+*          - PDO #0 (8 separate bytes in content, merged to a single copy operation)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_Tx8x1Byte)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_PDO_PLAN *plan;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[8]  = { 0x25000B08, 0x25000C08, 0x25000D08, 0x25000E08,
+                                  0x25000F08, 0x25001008, 0x25001108, 0x25001208 };
+    uint8_t      tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t      tpdo_len     = 8;
+    uint8_t      data[8]      = { 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98};
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[1]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[2]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[3]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0F, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[4]));
+    TS_ODAdd(CO_KEY(0x2500, 0x10, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[5]));
+    TS_ODAdd(CO_KEY(0x2500, 0x11, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[6]));
+    TS_ODAdd(CO_KEY(0x2500, 0x12, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[7]));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    plan = COTPdoPlanGet(&node.TPdo[0]);
+    TS_ASSERT(0 != plan);
+    TS_ASSERT(8 == plan->Size);
+    TS_ASSERT(1 == plan->OpNum);
+
+    TS_SYNC_SEND();
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 8);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_BYTE (frm, 1, 0x92);
+    CHK_BYTE (frm, 2, 0x93);
+    CHK_BYTE (frm, 3, 0x94);
+    CHK_BYTE (frm, 4, 0x95);
+    CHK_BYTE (frm, 5, 0x96);
+    CHK_BYTE (frm, 6, 0x97);
+    CHK_BYTE (frm, 7, 0x98);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check the plan transmission of:
+*          - PDO #0 (1 byte, 1 word and 1 long in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_Tx1_2_4Byte)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_PDO_PLAN *plan;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[3]  = { 0x25000B08, 0x25000C10, 0x25000D20 };
+    uint8_t      tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t      tpdo_len     = 3;
+    uint8_t      data8        = 0x91;
+    uint16_t     data16       = 0x9293;
+    uint32_t     data32       = 0x94959697;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data32));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    plan = COTPdoPlanGet(&node.TPdo[0]);
+    TS_ASSERT(0 != plan);
+    TS_ASSERT(7 == plan->Size);
+
+    TS_SYNC_SEND();
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 7);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_WORD (frm, 1, 0x9293);
+    CHK_LONG (frm, 3, 0x94959697);
+
+    data16 = 0x1234;                                  /* plans refer to the object memory         */
+    TS_SYNC_SEND();
+
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 7);
+    CHK_WORD (frm, 1, 0x1234);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check the recompilation of a plan after the mapping of
+*          the PDO is changed.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_Recompile)
+{
+    CO_NODE      node;
+    CO_PDO_PLAN *plan;
+    CO_OBJ      *obj;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[2]  = { 0x25000B08, 0x25000C10 };
+    uint8_t      tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t      tpdo_len     = 2;
+    uint8_t      data8        = 0x91;
+    uint16_t     data16       = 0x9293;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    plan = COTPdoPlanGet(&node.TPdo[0]);
+    TS_ASSERT(0 != plan);
+    TS_ASSERT(3 == plan->Size);
+
+    obj = node.TPdo[0].Map[1];                        /* simulate a changed mapping               */
+    node.TPdo[0].ObjNum = 1;
+    plan = COTPdoPlanGet(&node.TPdo[0]);
+    TS_ASSERT(0 != plan);
+    TS_ASSERT(1 == plan->Size);
+
+    node.TPdo[0].Map[0] = obj;
+    plan = COTPdoPlanGet(&node.TPdo[0]);
+    TS_ASSERT(0 != plan);
+    TS_ASSERT(2 == plan->Size);
+
+    COPdoPlanInit((CO_NODE *)0);                      /* disabled plans                           */
+    TS_ASSERT(0 == COTPdoPlanGet(&node.TPdo[0]));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check the plan reception of:
+*          - PDO #0 (asynchronous, 1 byte, 1 word and 1 long in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_RxAsync)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map[3] = { 0x25000B08, 0x25000C10, 0x25000D20 };
+    uint8_t  rpdo_type   = 254;
+    uint8_t  rpdo_len    = 3;
+    uint8_t  data8       = 0;
+    uint16_t data16      = 0;
+    uint32_t data32      = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data32));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    TS_ASSERT(0 != CORPdoPlanGet(0x201));
+
+    TS_PDO_SEND(0x201, 0x51);
+
+    TS_ASSERT(0x51       == data8);
+    TS_ASSERT(0x5352     == data16);
+    TS_ASSERT(0x57565554 == data32);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC5
+*
+*          This testcase will check, that synchronous RPDOs are left to the stack, which
+*          buffers the data until the next SYNC.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_RxSync)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map    = 0x25000B10;
+    uint8_t  rpdo_type   = 1;
+    uint8_t  rpdo_len    = 1;
+    uint16_t data16      = 0x9293;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    TS_ASSERT(0 == CORPdoPlanGet(0x201));
+
+    TS_PDO_SEND(0x201, 0x51);
+
+    TS_ASSERT(0x9293 == data16);                      /* check signal to be unchanged             */
+
+    TS_SYNC_SEND();
+
+    TS_ASSERT(0x5251 == data16);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC6
+*
+*          This testcase will check the plan transmission of:
+*          - PDO #0 (1 unsigned48 timestamp and 1 word in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_TxU48)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_PDO_PLAN *plan;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[2]  = { 0x25000B30, 0x25000C10 };
+    uint8_t      tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t      tpdo_len     = 2;
+    uint64_t     data48       = 0x919293949596;
+    uint16_t     data16       = 0x9798;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED48, (CO_DATA)(&data48));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    plan = COTPdoPlanGet(&node.TPdo[0]);
+    TS_ASSERT(0 != plan);
+    TS_ASSERT(8 == plan->Size);
+
+    TS_SYNC_SEND();
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 8);                         /* check PDO #0 (Id and DLC)                */
+    CHK_WORD (frm, 0, 0x9596);
+    CHK_LONG (frm, 2, 0x91929394);
+    CHK_WORD (frm, 6, 0x9798);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC7
+*
+*          This testcase will check the plan transmission of:
+*          - PDO #0 (1 REAL64 in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_TxReal64)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map     = 0x25000B40;
+    uint8_t      tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t      tpdo_len     = 1;
+    double       real64       = 1.0;                  /* IEEE754: 0x3FF0000000000000              */
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TREAL64, (CO_DATA)(&real64));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    TS_ASSERT(0 != COTPdoPlanGet(&node.TPdo[0]));
+
+    TS_SYNC_SEND();
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 8);                         /* check PDO #0 (Id and DLC)                */
+    CHK_LONG (frm, 0, 0x00000000);
+    CHK_LONG (frm, 4, 0x3FF00000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC8
+*
+*          This testcase will check the plan reception of:
+*          - PDO #0 (asynchronous, 1 unsigned64 in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_RxU64)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map    = 0x25000B40;
+    uint8_t  rpdo_type   = 254;
+    uint8_t  rpdo_len    = 1;
+    uint64_t data64      = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED64, (CO_DATA)(&data64));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    TS_ASSERT(0 != CORPdoPlanGet(0x201));
+
+    TS_PDO_SEND(0x201, 0x51);
+
+    TS_ASSERT(0x5857565554535251 == data64);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC9
+*
+*          This testcase will check, that a TPDO with an invalid COB-ID is not sent with
+*          the plan and that an empty mapping gets no plan.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_TxInvalid)
+{
+    CO_IF_FRM    frm;
+    CO_NODE      node;
+    CO_PDO_PLAN  empty;
+    uint32_t     tpdo_id      = 0x40000180;
+    uint32_t     tpdo_map[1]  = { 0x25000B08 };
+    uint8_t      tpdo_type    = 1;
+    uint16_t     tpdo_inhibit = 0;
+    uint16_t     tpdo_evtime  = 0;
+    uint8_t      tpdo_len     = 1;
+    uint8_t      data8        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+    COPdoPlanInit(&node);
+
+    TS_ASSERT(0 != COTPdoPlanGet(&node.TPdo[0]));
+    node.TPdo[0].Identifier |= 0x80000000uL;         /* simulate an invalid COB-ID               */
+    COTPdoTx(&node.TPdo[0]);
+
+    CHK_NOCAN(&frm);                                  /* check for no CAN frame                   */
+
+    TS_ASSERT(CO_PDO_PLAN_STACK == COPdoPlanCompile(&empty, &node.TPdo[0].Map[0], 0));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC10
+*
+*          This testcase will measure the time per 8-byte TPDO (4x2 byte content) with
+*          the stack mapping functions and with the precompiled plan.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoPlan_Bench)
+{
+    CO_NODE  node;
+    uint32_t tpdo_id      = 0x40000180;
+    uint32_t tpdo_map[4]  = { 0x25000B10, 0x25000C10, 0x25000D10, 0x25000E10 };
+    uint8_t  tpdo_type    = 1;
+    uint16_t tpdo_inhibit = 0;
+    uint16_t tpdo_evtime  = 0;
+    uint8_t  tpdo_len     = 4;
+    uint16_t data[4]      = { 0x9192, 0x9394, 0x9596, 0x9798 };
+    uint64_t stack;
+    uint64_t plan;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data[1]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data[2]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data[3]));
+    TS_CreateNodeAutoStart(&node);
+
+    COPdoPlanInit((CO_NODE *)0);
+    stack = PdoPlanBench(&node);
+    COPdoPlanInit(&node);
+    plan  = PdoPlanBench(&node);
+
+    TS_Printf("  8-byte TPDO: stack %u ns, plan %u ns\n", (uint32_t)stack, (uint32_t)plan);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_PDO_PLAN()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_PdoPlan_Tx8x1Byte);
+    TS_RUNNER(TS_PdoPlan_Tx1_2_4Byte);
+    TS_RUNNER(TS_PdoPlan_Recompile);
+    TS_RUNNER(TS_PdoPlan_RxAsync);
+    TS_RUNNER(TS_PdoPlan_RxSync);
+    TS_RUNNER(TS_PdoPlan_TxU48);
+    TS_RUNNER(TS_PdoPlan_TxReal64);
+    TS_RUNNER(TS_PdoPlan_RxU64);
+    TS_RUNNER(TS_PdoPlan_TxInvalid);
+    TS_RUNNER(TS_PdoPlan_Bench);
+
+    COPdoPlanInit((CO_NODE *)0);
+
+    TS_End();
+}
@@ -0,0 +1,193 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_pdo_sched.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that the scheduler takes over the event timers and sends
+*          the TPDOs due in the same tick in COB-ID order:
+*          - PDO #0 (COB-ID 0x182, event timer 100ms)
+*          - PDO #1 (COB-ID 0x181, event timer 100ms)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoSched_Event)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id[2]   = { 0x40000181, 0x40000180 };
+    uint32_t  tpdo_map[2]  = { 0x25000B08, 0x25000C08 };
+    uint8_t   tpdo_type    = 255;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 100;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data[2]      = { 0x91, 0x92 };
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id[0], &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_CreateTPdoCom(1, &tpdo_id[1], &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(1, &tpdo_map[1], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data[1]));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_ASSERT(2 == COPdoSchedInit(&node, 10));        /* scheduler tick: 1ms                      */
+    TS_ASSERT(0 > node.TPdo[0].EvTmr);                /* check stack timers are released          */
+    TS_ASSERT(0 > node.TPdo[1].EvTmr);
+
+    TS_Wait(&node, 100);                              /* wait 100ms                               */
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #1 (lower COB-ID first)        */
+    CHK_BYTE (frm, 0, 0x92);
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x182, 1);                         /* check PDO #0                             */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    TS_ASSERT(2 == COPdoSchedStat()->Batch);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that a burst of triggers within the inhibit time results
+*          in a single deferred transmission:
+*          - PDO #0 (type 254, inhibit time 10ms)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoSched_Inhibit)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 100;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_ASSERT(1 == COPdoSchedInit(&node, 10));        /* scheduler tick: 1ms                      */
+
+    COTPdoTrigPdo(node.TPdo, 0);                      /* first trigger is sent immediately        */
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+    CHK_BYTE (frm, 0, 0x91);
+
+    data8 = 0x92;                                     /* burst within the inhibit time            */
+    COTPdoTrigPdo(node.TPdo, 0);
+    data8 = 0x93;
+    COTPdoTrigPdo(node.TPdo, 0);
+    CHK_NOCAN(&frm);
+
+    TS_Wait(&node, 5);                                /* wait 5ms                                 */
+    CHK_NOCAN(&frm);
+
+    TS_Wait(&node, 5);                                /* wait 5ms (end of inhibit time)           */
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+    CHK_BYTE (frm, 0, 0x93);                          /* check latest value                       */
+    CHK_NOCAN(&frm);
+
+    TS_ASSERT(2 == COPdoSchedStat()->Deferred);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that writes to an asynchronous mapped object within the
+*          inhibit time result in a single deferred transmission:
+*          - PDO #0 (type 254, inhibit time 10ms)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoSched_InhibitObj)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 100;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ___APRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_ASSERT(1 == COPdoSchedInit(&node, 10));        /* scheduler tick: 1ms                      */
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x92);    /* first write is sent immediately   */
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+    CHK_BYTE (frm, 0, 0x92);
+
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x93);    /* burst within the inhibit time     */
+    CODictWrByte(&node.Dict, CO_DEV(0x2500, 0x0B), 0x94);
+    CHK_NOCAN(&frm);
+
+    TS_Wait(&node, 10);                               /* wait 10ms (end of inhibit time)          */
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+    CHK_BYTE (frm, 0, 0x94);                          /* check latest value                       */
+    CHK_NOCAN(&frm);
+
+    TS_ASSERT(2 == COPdoSchedStat()->Deferred);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_PDO_SCHED()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_PdoSched_Event);
+    TS_RUNNER(TS_PdoSched_Inhibit);
+    TS_RUNNER(TS_PdoSched_InhibitObj);
+
+    COPdoSchedInit((CO_NODE *)0, 0);
+
+    TS_End();
+}
@@ -0,0 +1,282 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_pdo_shadow.h"
+#include "co_unsigned64.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that a staged TPDO mapping is used from the SYNC after
+*          the next SYNC on:
+*          - PDO #0 (1 byte and 1 word in content, swapped to 1 long and 1 byte)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoShadow_TxSync)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map[3]  = { 0x25000B08, 0x25000C10, 0 };
+    uint32_t  shadow[2]    = { 0x25000D20, 0x25000B08 };
+    uint8_t   tpdo_type    = 1;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 2;
+    uint8_t   data8        = 0x91;
+    uint16_t  data16       = 0x9293;
+    uint32_t  data32       = 0x94959697;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(OBJ1AXX_N(0, 3, &tpdo_map[2]));          /* spare mapping entry                      */
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data32));
+    TS_CreateNodeAutoStart(&node);
+    COPdoShadowInit(&node);
+
+    TS_ASSERT(CO_ERR_NONE == COPdoShadowStage(0x1A00, &shadow[0], 2));
+    TS_ASSERT(1 == COPdoShadowPending());
+
+    TS_SYNC_SEND();                                   /* SYNC uses the active mapping             */
+
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 3);
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_WORD (frm, 1, 0x9293);
+    CHK_NOCAN(&frm);
+
+    TS_ASSERT(0          == COPdoShadowPending());    /* check swapped after SYNC handling        */
+    TS_ASSERT(2          == tpdo_len);
+    TS_ASSERT(0x25000D20 == tpdo_map[0]);
+    TS_ASSERT(0x25000B08 == tpdo_map[1]);
+
+    TS_SYNC_SEND();                                   /* next SYNC uses the new mapping           */
+
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 5);
+    CHK_LONG (frm, 0, 0x94959697);
+    CHK_BYTE (frm, 4, 0x91);
+    CHK_NOCAN(&frm);
+
+    TS_ASSERT(1 == COPdoShadowStat()->Swapped);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that a mapping is staged with SDO downloads to a shadow
+*          record and committed with the shadow mapping object:
+*          - 2F00:1 shadow commit (record 1A00, 3 entries)
+*          - 2F00:2..4 shadow mapping entries
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoShadow_Sdo)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map[3]  = { 0x25000B08, 0, 0 };
+    uint32_t  commit       = 0;
+    uint32_t  shadow[3]    = { 0, 0, 0 };
+    uint8_t   tpdo_type    = 1;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8        = 0x91;
+    uint16_t  data16       = 0x9293;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(OBJ1AXX_N(0, 2, &tpdo_map[1]));
+    TS_ODAdd(OBJ1AXX_N(0, 3, &tpdo_map[2]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_ODAdd(CO_KEY(0x2F00, 0x01, CO_OBJ_____RW), CO_TSHADOW_MAP, (CO_DATA)(&commit));
+    TS_ODAdd(CO_KEY(0x2F00, 0x02, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&shadow[0]));
+    TS_ODAdd(CO_KEY(0x2F00, 0x03, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&shadow[1]));
+    TS_ODAdd(CO_KEY(0x2F00, 0x04, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&shadow[2]));
+    TS_CreateNodeAutoStart(&node);
+    COPdoShadowInit(&node);
+
+    TS_SDO_SEND(0x23, 0x2F00, 2, 0x25000C10);
+    CHK_SDO0_OK(0x2F00, 2);
+    TS_SDO_SEND(0x23, 0x2F00, 3, 0x25000B08);
+    CHK_SDO0_OK(0x2F00, 3);
+    TS_SDO_SEND(0x23, 0x2F00, 4, 0x25000D08);         /* entry to missing object                  */
+    CHK_SDO0_OK(0x2F00, 4);
+
+    TS_SDO_SEND(0x23, 0x2F00, 1, 0x1A000003);         /* commit is refused                        */
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x80);
+    TS_ASSERT(0 == COPdoShadowPending());
+    TS_ASSERT(0 == commit);
+
+    TS_SDO_SEND(0x23, 0x2F00, 1, 0x1A000002);         /* commit the first two entries             */
+    CHK_SDO0_OK(0x2F00, 1);
+    TS_ASSERT(1          == COPdoShadowPending());
+    TS_ASSERT(0x1A000002 == commit);
+
+    TS_SYNC_SEND();
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+    CHK_BYTE (frm, 0, 0x91);
+
+    TS_SYNC_SEND();
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 3);
+    CHK_WORD (frm, 0, 0x9293);
+    CHK_BYTE (frm, 2, 0x91);
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that invalid mappings are rejected at staging time and
+*          the active mapping stays untouched.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoShadow_Reject)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map[2]  = { 0x25000B08, 0 };
+    uint32_t  nomap[1]     = { 0x25000E08 };
+    uint32_t  badlen[1]    = { 0x25000B10 };
+    uint32_t  toolong[2]   = { 0x25000F40, 0x25000B08 };
+    uint32_t  nosub[3]     = { 0x25000B08, 0x25000B08, 0x25000B08 };
+    uint32_t  valid[2]     = { 0x25000B08, 0x25000B08 };
+    uint8_t   tpdo_type    = 1;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8        = 0x91;
+    uint8_t   local8       = 0x92;
+    uint64_t  data64       = 0x98999A9B9C9D9E9Full;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(OBJ1AXX_N(0, 2, &tpdo_map[1]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x0E, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&local8));
+    TS_ODAdd(CO_KEY(0x2500, 0x0F, CO_OBJ____PRW), CO_TUNSIGNED64, (CO_DATA)(&data64));
+    TS_CreateNodeAutoStart(&node);
+    COPdoShadowInit(&node);
+
+    TS_ASSERT(CO_ERR_OBJ_MAP_TYPE  == COPdoShadowStage(0x1A00, &nomap[0],   1));
+    TS_ASSERT(CO_ERR_OBJ_MAP_LEN   == COPdoShadowStage(0x1A00, &badlen[0],  1));
+    TS_ASSERT(CO_ERR_OBJ_MAP_LEN   == COPdoShadowStage(0x1A00, &toolong[0], 2));
+    TS_ASSERT(CO_ERR_OBJ_NOT_FOUND == COPdoShadowStage(0x1A00, &nosub[0],   3));
+    TS_ASSERT(CO_ERR_BAD_ARG       == COPdoShadowStage(0x1A08, &valid[0],   1));
+    TS_ASSERT(CO_ERR_BAD_ARG       == COPdoShadowStage(0x1A00, &valid[0],   9));
+    TS_ASSERT(0 == COPdoShadowPending());
+    TS_ASSERT(6 == COPdoShadowStat()->Rejected);
+
+    TS_ASSERT(CO_ERR_NONE == COPdoShadowStage(0x1A00, &valid[0], 2));
+    TS_ASSERT(CO_ERR_NONE == COPdoShadowStage(0x1A00, &valid[0], 1));  /* restage replaces        */
+    TS_ASSERT(1 == COPdoShadowPending());
+
+    TS_SYNC_SEND();
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+
+    TS_ASSERT(1 == tpdo_len);
+    TS_ASSERT(2 == COPdoShadowStat()->Staged);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check the swap of an asynchronous RPDO mapping:
+*          - PDO #0 (1 word in content, swapped to 2 bytes)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_PdoShadow_Rx)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map[2] = { 0x25000B10, 0 };
+    uint32_t shadow[2]   = { 0x25000D08, 0x25000C08 };
+    uint8_t  rpdo_type   = 254;
+    uint8_t  rpdo_len    = 1;
+    uint16_t data16      = 0x9293;
+    uint8_t  data8[2]    = { 0x91, 0x92 };
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(OBJ16XX_N(0, 2, &rpdo_map[1]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8[0]));
+    TS_ODAdd(CO_KEY(0x2500, 0x0D, CO_OBJ____PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8[1]));
+    TS_CreateNodeAutoStart(&node);
+    COPdoShadowInit(&node);
+
+    TS_ASSERT(CO_ERR_NONE == COPdoShadowStage(0x1600, &shadow[0], 2));
+
+    TS_PDO_SEND(0x201, 0x51);                         /* received with the active mapping         */
+    TS_ASSERT(0x5251 == data16);
+    TS_ASSERT(0x91   == data8[0]);
+
+    TS_SYNC_SEND();
+    TS_ASSERT(2 == rpdo_len);
+
+    TS_PDO_SEND(0x201, 0x61);                         /* received with the new mapping            */
+    TS_ASSERT(0x5251 == data16);
+    TS_ASSERT(0x61   == data8[1]);
+    TS_ASSERT(0x62   == data8[0]);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_PDO_SHADOW()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_PdoShadow_TxSync);
+    TS_RUNNER(TS_PdoShadow_Sdo);
+    TS_RUNNER(TS_PdoShadow_Reject);
+    TS_RUNNER(TS_PdoShadow_Rx);
+
+    COPdoShadowInit((CO_NODE *)0);
+
+    TS_End();
+}
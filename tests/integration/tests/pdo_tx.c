@@ -19,6 +19,7 @@
 ******************************************************************************/
 
 #include "def_suite.h"
+#include "co_sync_pipe.h"
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
@@ -1128,6 +1129,58 @@ TS_DEF_MAIN(TS_TPdo_ChangeAsyncProperty)
     CHK_NO_ERR(&node);                                       /* check error free stack execution  */
 }
 
+#if CO_TPDO_N >= 32
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC26
+*
+*          This testcase will check the transmission of 32 synchronous TPDOs on a single
+*          SYNC, handed to the driver in one batch:
+*          - PDO #0..#31 (1 long in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_32Sync)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id[32];
+    uint32_t  tpdo_map[32];
+    uint32_t  data[32];
+    uint8_t   tpdo_type    = 1;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   n;
+
+    TS_CreateMandatoryDir();
+    for (n = 0; n < 32; n++) {
+        tpdo_id[n]  = 0x40000300 + n;
+        tpdo_map[n] = CO_KEY(0x2600, 1 + n, 0x20);
+        data[n]     = 0x71727300 + n;
+        TS_CreateTPdoCom(n, &tpdo_id[n], &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+        TS_CreateTPdoMap(n, &tpdo_map[n], &tpdo_len);
+    }
+    for (n = 0; n < 32; n++) {
+        TS_ODAdd(CO_KEY(0x2600, 1 + n, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data[n]));
+    }
+    TS_CreateNodeAutoStart(&node);
+    COSyncPipeInit(&node, SimCanSendBatch, 0);
+
+    TS_SYNC_SEND();
+
+    for (n = 0; n < 32; n++) {
+        CHK_CAN  (&frm);                              /* check for a CAN frame                    */
+        CHK_PDO0 (frm, 0x301u + n, 4);                /* check PDO #n (Id and DLC)                */
+        CHK_LONG (frm, 0, 0x71727300 + n);
+    }
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+    TS_ASSERT(32 == COSyncPipeStat()->Frames);        /* all TPDOs in a single SYNC batch         */
+    TS_ASSERT(0  == COSyncPipeStat()->Overflow);
+
+    COSyncPipeInit((CO_NODE *)0, 0, 0);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+#endif
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -1160,6 +1213,9 @@ SUITE_PDO_TX()
     TS_RUNNER(TS_TPdo_SetEventTime);
     TS_RUNNER(TS_TPdo_SetEventTimeAndReset);
     TS_RUNNER(TS_TPdo_ChangeAsyncProperty);
+#if CO_TPDO_N >= 32
+    TS_RUNNER(TS_TPdo_32Sync);
+#endif
 
     TS_End();
 }
@@ -0,0 +1,350 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_blk_down
+* \details    This test suite checks the protocol for SDO block download
+*             (e.g. SDO client writes data to SDO server).
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_csdo_blk.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK CSdoBlkDownCb;
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to write a 16 byte domain with block download
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to send
+*           16 bytes in a single block with CRC to the SDO server #0 on
+*           device with Node-Id 5.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_Blk16ByteDomain)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockDownload(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST: CRC, SIZE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 16);
+
+    /* -- SERVER INIT RESPONSE: CRC, BLKSIZE 127 -- */
+    TS_SDO5_SEND (0xA4, idx, sub, 127);
+
+    /* -- CHECK BLOCK SEGMENTS -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x01);
+    CHK_SEG  (frm, 1, 7);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x02);
+    CHK_SEG  (frm, 8, 7);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x83);
+    CHK_SEG  (frm, 15, 2);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE: 3 SEGMENTS -- */
+    TS_SEG5_SEND (0xA2, 0x7F03, 0x000000);
+
+    /* -- CHECK END REQUEST: 5 UNUSED BYTES, CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD5);
+    CHK_WORD (frm, 1, 0x65E5);
+
+    /* -- SERVER END RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+    TS_ASSERT(16 == COCSdoBlkSize(csdo));
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to repeat segments, which are not acknowledged
+*
+*           The server acknowledges only the first segment of a block with
+*           2 segments. The SDO client repeats the second segment as first
+*           segment of the next block.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkRepeat)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+    TS_ASSERT(CO_ERR_NONE == COCSdoBlkSetup(csdo, 127, 0));
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockDownload(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST: NO CRC, SIZE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC2);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 16);
+
+    /* -- SERVER INIT RESPONSE: BLKSIZE 2 -- */
+    TS_SDO5_SEND (0xA0, idx, sub, 2);
+
+    /* -- CHECK BLOCK #1 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x01);
+    CHK_SEG  (frm, 1, 7);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x02);
+    CHK_SEG  (frm, 8, 7);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE: SEGMENT #2 MISSING -- */
+    TS_SEG5_SEND (0xA2, 0x0201, 0x000000);
+
+    /* -- CHECK BLOCK #2: REPEAT SEGMENT #2 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x01);
+    CHK_SEG  (frm, 8, 7);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x82);
+    CHK_SEG  (frm, 15, 2);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE: 2 SEGMENTS -- */
+    TS_SEG5_SEND (0xA2, 0x0202, 0x000000);
+
+    /* -- CHECK END REQUEST: NO CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD5);
+    CHK_WORD (frm, 1, 0);
+
+    /* -- SERVER END RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+    TS_ASSERT(1 == COCSdoBlkStat()->Repeated);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle a timeout
+*
+*           The server does not respond to the initiate request. The SDO
+*           client aborts the transfer after the timeout.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkTimeout)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 100;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockDownload(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- SECOND REQUEST WHILE BUSY -- */
+    err = COCSdoRequestBlockDownload(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_SDO_OFF);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- NO SERVER INIT RESPONSE -- */
+    TS_Wait(&node, 50);
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 0);
+
+    TS_Wait(&node, 100);
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0x05040000);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 0x05040000);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle an abort of the server
+*
+*           The server aborts the transfer after the block with a CRC
+*           error. The SDO client finishes the transfer with the abort code.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkAbort)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[4] = { 1,2,3,4 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockDownload(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 4,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: CRC, BLKSIZE 127 -- */
+    TS_SDO5_SEND (0xA4, idx, sub, 127);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x81);
+    CHK_SEG  (frm, 1, 4);
+
+    /* -- SERVER ABORT: CRC ERROR -- */
+    TS_SDO5_SEND (0x80, idx, sub, 0x05040004);
+
+    /* -- CHECK TRANSFER FINISHED WITHOUT ABORT REQUEST -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0x05040004);
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoBlkDownSetup(void)
+{
+    TS_CallbackInit(&CSdoBlkDownCb);
+}
+
+static void CSdoBlkDownCleanup(void)
+{
+    TS_CallbackDeInit();
+    COCSdoBlkInit((CO_NODE *)0, 0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_BLK_DOWN()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoBlkDownSetup, CSdoBlkDownCleanup);
+
+    TS_RUNNER(TS_CSdoWr_Blk16ByteDomain);
+    TS_RUNNER(TS_CSdoWr_BlkRepeat);
+
+    TS_RUNNER(TS_CSdoWr_BlkTimeout);
+    TS_RUNNER(TS_CSdoWr_BlkAbort);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
@@ -0,0 +1,468 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_blk_up
+* \details    This test suite checks the protocol for SDO block upload
+*             (e.g. SDO client reads data from SDO server).
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_csdo_blk.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK CSdoBlkUpCb;
+static uint32_t    CSdoBlkUpNow;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t CSdoBlkUpClock(void)
+{
+    return (CSdoBlkUpNow);
+}
+
+/* send segment with 7 upcounting bytes, starting at seg * 7 + 1 */
+static void CSdoBlkUpSeg(uint8_t cmd, uint8_t seg)
+{
+    uint8_t d = (uint8_t)(seg * 7u + 1u);
+
+    SimCanSetFrm(0x605, 8, cmd, d, d + 1, d + 2, d + 3, d + 4, d + 5, d + 6);
+    SimCanRun();
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to read a 16 byte domain with block upload
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to
+*           read 16 bytes in a single block with CRC from the SDO server #0
+*           on device with Node-Id 5.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_Blk16ByteDomain)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[20] = { 0 };
+    uint8_t   n;
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockUpload(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], sizeof(val),
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST: CRC, BLKSIZE 127 -- */
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA4);
+    CHK_MLTPX  (frm, idx, sub);
+    CHK_BLKSIZE(frm, 127);
+
+    /* -- SERVER INIT RESPONSE: CRC, SIZE 16 -- */
+    TS_SDO5_SEND (0xC6, idx, sub, 16);
+
+    /* -- CHECK START UPLOAD -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+    CHK_SEG  (frm, 0, 0);
+
+    /* -- SERVER BLOCK: 3 SEGMENTS -- */
+    TS_SEG5_SEND (0x01, 0x04030201, 0x070605);
+    TS_SEG5_SEND (0x02, 0x0b0a0908, 0x0e0d0c);
+    CHK_NOCAN(&frm);
+    TS_SEG5_SEND (0x83, 0x0000100f, 0x000000);
+
+    /* -- CHECK BLOCK ACKNOWLEDGE -- */
+    CHK_CAN   (&frm);
+    CHK_SDO5  (frm, 0xA2);
+    CHK_ACKSEQ(frm, 3);
+    CHK_NEXTBLK(frm, 127);
+
+    /* -- SERVER END REQUEST: 5 UNUSED BYTES, CRC -- */
+    TS_SEG5_SEND (0xD5, 0x65E5, 0x000000);
+
+    /* -- CHECK END RESPONSE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    TS_ASSERT(16 == COCSdoBlkSize(csdo));
+    for (n = 0; n < 16; n++) {
+        TS_ASSERT((n + 1) == val[n]);
+    }
+    TS_ASSERT(0 == val[16]);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to drop segments out of sequence
+*
+*           The first segment of a block with 2 segments is lost. The SDO
+*           client drops the second segment and acknowledges no segment, so
+*           the server repeats the segments with the halved block size.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkLostSegment)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+    TS_ASSERT(CO_ERR_NONE == COCSdoBlkSetup(csdo, 2, 0));
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockUpload(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], sizeof(val),
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST: NO CRC, BLKSIZE 2 -- */
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA0);
+    CHK_BLKSIZE(frm, 2);
+
+    /* -- SERVER INIT RESPONSE: NO SIZE -- */
+    TS_SDO5_SEND (0xC0, idx, sub, 0);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    /* -- SERVER BLOCK #1: SEGMENT #1 LOST -- */
+    TS_SEG5_SEND (0x02, 0x0b0a0908, 0x0e0d0c);
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA2);
+    CHK_ACKSEQ (frm, 0);
+    CHK_NEXTBLK(frm, 1);
+
+    /* -- SERVER BLOCK #2 AND #3: REPEATED -- */
+    TS_SEG5_SEND (0x01, 0x04030201, 0x070605);
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA2);
+    CHK_ACKSEQ (frm, 1);
+    CHK_NEXTBLK(frm, 2);
+    TS_SEG5_SEND (0x81, 0x0b0a0908, 0x0e0d0c);
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA2);
+    CHK_ACKSEQ (frm, 1);
+    CHK_NEXTBLK(frm, 2);
+
+    /* -- SERVER END REQUEST: NO UNUSED BYTES -- */
+    TS_SEG5_SEND (0xC1, 0x0000, 0x000000);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    TS_ASSERT(14 == COCSdoBlkSize(csdo));
+    TS_ASSERT(14 == val[13]);
+    TS_ASSERT(1  == COCSdoBlkStat()->Repeated);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to detect a CRC error
+*
+*           The CRC of the end request does not match the received data.
+*           The SDO client aborts the transfer.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkBadCrc)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockUpload(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], sizeof(val),
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+
+    TS_SDO5_SEND (0xC6, idx, sub, 7);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    TS_SEG5_SEND (0x81, 0x04030201, 0x070605);
+    CHK_CAN   (&frm);
+    CHK_SDO5  (frm, 0xA2);
+    CHK_ACKSEQ(frm, 1);
+
+    /* -- SERVER END REQUEST: BAD CRC -- */
+    TS_SEG5_SEND (0xC1, 0x1234, 0x000000);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 0x05040004);
+
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0x05040004);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to reject a domain, which exceeds the buffer
+*
+*           The server indicates 16 bytes for a buffer with 8 bytes. The
+*           SDO client aborts the transfer with out of memory.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkOverflow)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[8] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestBlockUpload(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], sizeof(val),
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+
+    /* -- SERVER INIT RESPONSE: SIZE 16 -- */
+    TS_SDO5_SEND (0xC6, idx, sub, 16);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 0x05040005);
+
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0x05040005);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to adapt the block size to lost segments
+*
+*           The third segment of the first block with 8 segments is lost
+*           on the bus. The SDO client halves the next block size and
+*           increases it again after the complete second block. The report
+*           of the transfer counts the repeated segments and the time.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkAdaptive)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    CO_CSDO   *csdo;
+    const CO_CSDO_BLK_XFER *xfer;
+    uint8_t    serverId = 5;
+    uint32_t   idx = 0x2000;
+    uint8_t    sub = 0x01;
+    uint32_t   timeout = 1000;
+    uint8_t    val[100] = { 0 };
+    uint8_t    n;
+    CO_ERR     err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    COCSdoBlkInit(&node, CSdoBlkUpClock);
+    csdo = COCSdoFind(&node, 0);
+    TS_ASSERT(CO_ERR_NONE == COCSdoBlkSetup(csdo, 8, 0));
+
+    /* -- TEST -- */
+    CSdoBlkUpNow = 100;
+    err = COCSdoRequestBlockUpload(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], sizeof(val),
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA0);
+    CHK_BLKSIZE(frm, 8);
+
+    TS_SDO5_SEND (0xC0, idx, sub, 0);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    /* -- SERVER BLOCK #1: SEGMENT #3 LOST ON THE BUS -- */
+    SimCanSetLoss(0, 1u << 2);
+    for (n = 1; n <= 8; n++) {
+        CSdoBlkUpSeg(n, n - 1);
+    }
+    TS_ASSERT(1 == SimCanGetLost());
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA2);
+    CHK_ACKSEQ (frm, 2);
+    CHK_NEXTBLK(frm, 4);
+
+    /* -- SERVER BLOCK #2: HALVED -- */
+    for (n = 1; n <= 4; n++) {
+        CSdoBlkUpSeg(n, n + 1);
+    }
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA2);
+    CHK_ACKSEQ (frm, 4);
+    CHK_NEXTBLK(frm, 8);
+
+    /* -- SERVER BLOCK #3: INCREASED, LAST SEGMENT COMPLETE -- */
+    for (n = 1; n <= 8; n++) {
+        CSdoBlkUpSeg((n < 8) ? n : (0x80 | n), n + 5);
+    }
+    CHK_CAN    (&frm);
+    CHK_SDO5   (frm, 0xA2);
+    CHK_ACKSEQ (frm, 8);
+    CHK_NEXTBLK(frm, 8);
+
+    /* -- SERVER END REQUEST: NO UNUSED BYTES -- */
+    CSdoBlkUpNow = 350;
+    TS_SEG5_SEND (0xC1, 0x0000, 0x000000);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER AND REPORT -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    TS_ASSERT(98 == COCSdoBlkSize(csdo));
+    for (n = 0; n < 98; n++) {
+        TS_ASSERT((n + 1) == val[n]);
+    }
+    xfer = COCSdoBlkXfer(csdo);
+    TS_ASSERT(14  == xfer->Segments);
+    TS_ASSERT(5   == xfer->Repeated);
+    TS_ASSERT(3   == xfer->Blocks);
+    TS_ASSERT(8   == xfer->BlkSize);
+    TS_ASSERT(4   == xfer->MinSize);
+    TS_ASSERT(250 == xfer->Time);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoBlkUpSetup(void)
+{
+    TS_CallbackInit(&CSdoBlkUpCb);
+}
+
+static void CSdoBlkUpCleanup(void)
+{
+    TS_CallbackDeInit();
+    COCSdoBlkInit((CO_NODE *)0, 0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_BLK_UP()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoBlkUpSetup, CSdoBlkUpCleanup);
+
+    TS_RUNNER(TS_CSdoRd_Blk16ByteDomain);
+    TS_RUNNER(TS_CSdoRd_BlkLostSegment);
+    TS_RUNNER(TS_CSdoRd_BlkAdaptive);
+
+    TS_RUNNER(TS_CSdoRd_BlkBadCrc);
+    TS_RUNNER(TS_CSdoRd_BlkOverflow);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
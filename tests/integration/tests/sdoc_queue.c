@@ -0,0 +1,210 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_queue
+* \details    This test suite checks the request queue of the SDO clients.
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_csdo_queue.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t QueueDoneNum;                         /* number of request callbacks              */
+static uint32_t QueueDoneCode;                        /* abort code of the last callback          */
+static uint8_t  QueueDoneNode;                        /* server of the last callback              */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void QueueDone(CO_CSDO_REQ *req, uint32_t code)
+{
+    QueueDoneNum++;
+    QueueDoneCode = code;
+    QueueDoneNode = req->NodeId;
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Queue requests to two servers on a single SDO client
+*
+*           Three uploads are submitted: node 5, node 6 and node 5 again.
+*           The SDO client #0 processes them in submit order and is
+*           switched between the servers.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoQueue_Order)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_CSDO_REQ req[3];
+    uint8_t     serverId = 5;
+    uint32_t    idx = 0x2000;
+    uint8_t     sub = 0x01;
+    uint32_t    val[3] = { 0 };
+    uint8_t     n;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    TS_ASSERT(1 == COCSdoQueueInit(&node));
+    for (n = 0; n < 3; n++) {
+        req[n].State = CO_CSDO_REQ_IDLE;
+    }
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == COCSdoQueueSubmit(&req[0], CO_CSDO_REQ_UPLOAD, 5,
+        CO_DEV(idx, sub), (uint8_t *)&val[0], 4, QueueDone, 1000));
+    TS_ASSERT(CO_ERR_NONE == COCSdoQueueSubmit(&req[1], CO_CSDO_REQ_UPLOAD, 6,
+        CO_DEV(idx, sub), (uint8_t *)&val[1], 4, QueueDone, 1000));
+    TS_ASSERT(CO_ERR_NONE == COCSdoQueueSubmit(&req[2], CO_CSDO_REQ_UPLOAD, 5,
+        CO_DEV(idx, sub), (uint8_t *)&val[2], 4, QueueDone, 1000));
+    TS_ASSERT(2 == COCSdoQueueStat()->Pending);
+    TS_ASSERT(CO_ERR_BAD_ARG == COCSdoQueueSubmit(&req[0], CO_CSDO_REQ_UPLOAD, 5,
+        CO_DEV(idx, sub), (uint8_t *)&val[0], 4, QueueDone, 1000));
+
+    /* -- REQUEST #1: NODE 5 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x40);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_NOCAN(&frm);
+    TS_SDO5_SEND (0x43, idx, sub, 0x11111111);
+    TS_ASSERT(1 == QueueDoneNum);
+    TS_ASSERT(5 == QueueDoneNode);
+    TS_ASSERT(0 == QueueDoneCode);
+
+    /* -- REQUEST #2: NODE 6, STARTED WITH NEXT TICK -- */
+    CHK_NOCAN(&frm);
+    TS_Wait(&node, 2);
+    CHK_CAN  (&frm);
+    TS_ASSERT(0x586 == frm.Identifier);
+    TS_ASSERT(0x40  == frm.Data[0]);
+    SimCanSetFrm(0x606, 8, 0x43, 0x00, 0x20, 0x01, 0x22, 0x22, 0x22, 0x22);
+    SimCanRun();
+    TS_ASSERT(2 == QueueDoneNum);
+    TS_ASSERT(6 == QueueDoneNode);
+
+    /* -- REQUEST #3: NODE 5 AGAIN -- */
+    TS_Wait(&node, 2);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x40);
+    TS_SDO5_SEND (0x43, idx, sub, 0x33333333);
+    TS_ASSERT(3 == QueueDoneNum);
+    TS_ASSERT(5 == QueueDoneNode);
+
+    /* -- CHECK RESULTS -- */
+    TS_ASSERT(0x11111111 == val[0]);
+    TS_ASSERT(0x22222222 == val[1]);
+    TS_ASSERT(0x33333333 == val[2]);
+    TS_ASSERT(3 == COCSdoQueueStat()->Finished);
+    TS_ASSERT(2 == COCSdoQueueStat()->Retargets);
+    TS_ASSERT(0 == COCSdoQueueStat()->Running);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Cancel a waiting request
+*
+*           The second request to node 5 waits for the first one and is
+*           cancelled. A timeout of the first request is reported with the
+*           abort code of the SDO client.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoQueue_Cancel)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_CSDO_REQ req[2];
+    uint8_t     serverId = 5;
+    uint32_t    idx = 0x2000;
+    uint8_t     sub = 0x01;
+    uint32_t    val = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    (void)COCSdoQueueInit(&node);
+    req[0].State = CO_CSDO_REQ_IDLE;
+    req[1].State = CO_CSDO_REQ_IDLE;
+
+    /* -- TEST -- */
+    TS_ASSERT(CO_ERR_NONE == COCSdoQueueSubmit(&req[0], CO_CSDO_REQ_UPLOAD, 5,
+        CO_DEV(idx, sub), (uint8_t *)&val, 4, QueueDone, 100));
+    TS_ASSERT(CO_ERR_NONE == COCSdoQueueSubmit(&req[1], CO_CSDO_REQ_UPLOAD, 5,
+        CO_DEV(idx, sub), (uint8_t *)&val, 4, QueueDone, 100));
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x40);
+
+    TS_ASSERT(-1 == COCSdoQueueCancel(&req[0]));      /* running                                  */
+    TS_ASSERT( 0 == COCSdoQueueCancel(&req[1]));
+    TS_ASSERT(CO_CSDO_REQ_IDLE == req[1].State);
+
+    /* -- NO SERVER RESPONSE -- */
+    TS_Wait(&node, 150);
+    TS_ASSERT(1 == QueueDoneNum);
+    TS_ASSERT(0x05040000 == QueueDoneCode);
+    TS_ASSERT(1 == COCSdoQueueStat()->Failed);
+    TS_ASSERT(0 == COCSdoQueueStat()->Pending);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoQueueSetup(void)
+{
+    QueueDoneNum  = 0;
+    QueueDoneCode = 0;
+    QueueDoneNode = 0;
+}
+
+static void CSdoQueueCleanup(void)
+{
+    (void)COCSdoQueueInit((CO_NODE *)0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_QUEUE()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoQueueSetup, CSdoQueueCleanup);
+
+    TS_RUNNER(TS_CSdoQueue_Order);
+    TS_RUNNER(TS_CSdoQueue_Cancel);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
@@ -666,6 +666,66 @@ TS_DEF_MAIN(TS_BlkWr_LostSeg)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the block download, when the third received segment is lost
+*          on the bus
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_RxLossSeg)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC0, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);                /* check block size                         */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    SimCanSetLoss(0, 1u << 2);                        /* 3rd received frame is lost               */
+    TS_SendBlk(0x00, 6, 1, 0);                        /* transmit segment 1 to 6                  */
+    TS_ASSERT   (1 == SimCanGetLost());
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 2);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, CO_SDO_BUF_SEG);                /* check next block size                    */
+
+                                                      /*===== RE-SEND FAILED BLOCK DOWNLOAD ======*/
+    TS_SendBlk(0x0E, 4, 1, 0);                        /* transmit segment 1 to 4                  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 4);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, CO_SDO_BUF_SEG);                /* check next block size                    */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00000000);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -1435,6 +1495,7 @@ SUITE_BLK_DOWN()
     TS_RUNNER(TS_BlkWr_41ByteDomain_NoLen);
     TS_RUNNER(TS_BlkWr_1000ByteDomain_NoLen);
     TS_RUNNER(TS_BlkWr_LostSeg);
+    TS_RUNNER(TS_BlkWr_RxLossSeg);
     TS_RUNNER(TS_BlkWr_890ByteDomain);
     TS_RUNNER(TS_BlkWr_889ByteDomain);
     TS_RUNNER(TS_BlkWr_46ByteDomain);
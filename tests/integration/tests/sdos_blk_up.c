@@ -725,6 +725,61 @@ TS_DEF_MAIN(TS_BlkRd_LostFirstSeg)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the block upload of an array with size = 26 Bytes, when the
+*          third transmitted segment is lost on the bus (Go-Back-N ARQ)
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_TxLossSeg)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 26;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 'a');
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, 3);                  /* 3 segments per block (21 bytes)          */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    SimCanSetLoss(1u << 2, 0);                        /* 3rd transmitted frame is lost            */
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  ('a', 2, 0, 0);                        /* 2 blocks (a-g,h-n)                       */
+    CHK_NOCAN   (&frm);                               /* segment 3 (o-u) is lost                  */
+    TS_ASSERT  (1 == SimCanGetLost());
+    TS_ACKBLK_SEND(0xA2, 2, 3);                       /* ack for segment 1-2                      */
+
+    TS_ChkBlk  ('o', 2, 1, 5);                        /* 2 blocks (o-u,v-z) (last block: 5 bytes) */
+    TS_ACKBLK_SEND(0xA2, 2, 3);                       /* ack for segment 3-4                      */
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC9);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -1356,6 +1411,7 @@ SUITE_BLK_UP()
     TS_RUNNER(TS_BlkRd_LostMiddleSeg);
     TS_RUNNER(TS_BlkRd_LostLastSeg);
     TS_RUNNER(TS_BlkRd_LostFirstSeg);
+    TS_RUNNER(TS_BlkRd_TxLossSeg);
     TS_RUNNER(TS_BlkRd_BadCmd);
     TS_RUNNER(TS_BlkRd_ObjNotExist);
     TS_RUNNER(TS_BlkRd_SubIdxNotExist);
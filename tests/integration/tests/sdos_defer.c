@@ -0,0 +1,326 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup sdos_defer
+* \details    This test suite checks the deferred object access of the SDO
+*             servers.
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_sdo_defer.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t DeferPending;           /* prepare functions return pending  */
+static uint8_t DeferDropped;           /* number of dropped accesses        */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+#define DEFER_TYPE  ((CO_OBJ_TYPE *)&DeferType)
+static uint32_t DeferTypeSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    CO_UNUSED(obj);
+    CO_UNUSED(node);
+    CO_UNUSED(width);
+
+    return (4u);
+}
+static CO_ERR DeferTypeCtrl(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint16_t func, uint32_t para)
+{
+    CO_UNUSED(obj);
+    CO_UNUSED(node);
+    CO_UNUSED(para);
+
+    if (func == CO_SDO_DEFER_CTRL_ABORT) {
+        DeferDropped++;
+        return (CO_ERR_NONE);
+    }
+    if ((func == CO_SDO_DEFER_CTRL_RD) || (func == CO_SDO_DEFER_CTRL_WR)) {
+        return ((DeferPending != 0) ? CO_SDO_DEFER_PENDING : CO_ERR_NONE);
+    }
+    return (CO_ERR_TYPE_CTRL);
+}
+static CO_ERR DeferTypeRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buf, uint32_t size)
+{
+    CO_UNUSED(node);
+
+    if ((DeferPending != 0) || (size < 4u)) {
+        return (CO_ERR_TYPE_RD);
+    }
+    *(uint32_t *)buf = *(uint32_t *)(obj->Data);
+    return (CO_ERR_NONE);
+}
+static CO_ERR DeferTypeWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buf, uint32_t size)
+{
+    CO_UNUSED(node);
+
+    if ((DeferPending != 0) || (size < 4u)) {
+        return (CO_ERR_TYPE_WR);
+    }
+    *(uint32_t *)(obj->Data) = *(uint32_t *)buf;
+    return (CO_ERR_NONE);
+}
+static const CO_OBJ_TYPE DeferType = { DeferTypeSize, DeferTypeCtrl, DeferTypeRead, DeferTypeWrite };
+
+static CO_OBJ *DeferCreate(CO_NODE *node, uint16_t idx, uint8_t sub, uint32_t *val)
+{
+    DeferPending = 1;
+    DeferDropped = 0;
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), DEFER_TYPE, (CO_DATA)(val));
+    TS_CreateNode(node, 0);
+    COSdoDeferInit(node);
+    TS_ASSERT(0 == COSdoDeferType(DEFER_TYPE));
+
+    return (CODictFind(&node->Dict, CO_DEV(idx, sub)));
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Parked upload while other services keep running
+*
+*           The upload request is parked until the application completes
+*           the access; an NMT command is processed in the meantime. The
+*           completed request is answered by the stack.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoDefer_ExpRdPending)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_OBJ   *obj;
+    uint16_t  idx  = 0x2540;
+    uint8_t   sub  = 1;
+    uint32_t  val  = 0x11223344;
+
+    /* -- PREPARATION -- */
+    obj = DeferCreate(&node, idx, sub, &val);
+
+    /* -- PARKED UPLOAD -- */
+    TS_SDO_SEND (0x40, idx, sub, 0);
+    CHK_NOCAN   (&frm);
+
+    /* -- NMT COMMAND WHILE PARKED -- */
+    TS_NMT_SEND (0x01, 1);
+    TS_ASSERT(CO_OPERATIONAL == CONmtGetMode(&node.Nmt));
+
+    /* -- COMPLETE ACCESS -- */
+    DeferPending = 0;
+    TS_ASSERT(1 == COSdoDeferDone(obj, 0));
+    CONodeProcess(&node);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x43);
+    CHK_MLTPX   (frm, idx, sub);
+    CHK_DATA    (frm, val);
+
+    TS_ASSERT(1 == COSdoDeferStat()->Parked);
+    TS_ASSERT(1 == COSdoDeferStat()->Replayed);
+    TS_ASSERT(0 == COSdoDeferStat()->Aborted);
+    TS_ASSERT(1 == COSdoDeferStat()->MaxParked);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Parked download completed with an abort code
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoDefer_ExpWrAbort)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_OBJ   *obj;
+    uint16_t  idx  = 0x2540;
+    uint8_t   sub  = 2;
+    uint32_t  val  = 0;
+
+    /* -- PREPARATION -- */
+    obj = DeferCreate(&node, idx, sub, &val);
+
+    /* -- PARKED DOWNLOAD -- */
+    TS_SDO_SEND (0x23, idx, sub, 0x55667788);
+    CHK_NOCAN   (&frm);
+
+    /* -- ABORT ACCESS -- */
+    TS_ASSERT(1 == COSdoDeferDone(obj, 0x06060000));
+    CHK_SDO0_ERR(idx, sub, 0x06060000);
+    TS_ASSERT(0 == val);
+    TS_ASSERT(1 == DeferDropped);
+
+    /* -- NO REPLAY AFTER ABORT -- */
+    CONodeProcess(&node);
+    CHK_NOCAN   (&frm);
+
+    TS_ASSERT(0 == COSdoDeferStat()->Replayed);
+    TS_ASSERT(1 == COSdoDeferStat()->Aborted);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Parked upload without completion times out
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoDefer_Timeout)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_OBJ   *obj;
+    uint16_t  idx  = 0x2540;
+    uint8_t   sub  = 3;
+    uint32_t  val  = 0;
+
+    /* -- PREPARATION -- */
+    obj = DeferCreate(&node, idx, sub, &val);
+
+    /* -- PARKED UPLOAD -- */
+    TS_SDO_SEND (0x40, idx, sub, 0);
+    CHK_NOCAN   (&frm);
+
+    /* -- TIMEOUT -- */
+    TS_Wait(&node, CO_SDO_DEFER_TIMEOUT + 10);
+    CHK_SDO0_ERR(idx, sub, 0x05040000);
+    TS_ASSERT(1 == DeferDropped);
+
+    /* -- LATE COMPLETION IS IGNORED -- */
+    TS_ASSERT(0 == COSdoDeferDone(obj, 0));
+    CONodeProcess(&node);
+    CHK_NOCAN   (&frm);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Ready accesses are passed to the stack immediately
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoDefer_NotPending)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2540;
+    uint8_t   sub  = 4;
+    uint32_t  val  = 0;
+
+    /* -- PREPARATION -- */
+    (void)DeferCreate(&node, idx, sub, &val);
+    DeferPending = 0;
+
+    /* -- DOWNLOAD WITHOUT PARKING -- */
+    TS_SDO_SEND (0x23, idx, sub, 0x55667788);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x60);
+    CHK_MLTPX   (frm, idx, sub);
+    TS_ASSERT(0x55667788 == val);
+
+    TS_ASSERT(0 == COSdoDeferStat()->Parked);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Leave the segments of a block download to the stack
+*
+*           Segment 32 of the block starts with 0x20 and the data bytes
+*           0x25, 0x26, 0x27, which look like the download request of a
+*           deferred object. The segment belongs to the running transfer of
+*           the stack server.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoDefer_StackBlkWr)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 40 * 7;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+    uint32_t    val  = 0;
+
+    /* -- PREPARATION -- */
+    DeferPending = 1;
+    DeferDropped = 0;
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_ODAdd(CO_KEY(0x2625, 0x27, CO_OBJ_____RW), DEFER_TYPE, (CO_DATA)(&val));
+    TS_CreateNode(&node, 0);
+    COSdoDeferInit(&node);
+    TS_ASSERT(0 == COSdoDeferType(DEFER_TYPE));
+
+    /* -- INIT BLOCK DOWNLOAD -- */
+    TS_SDO_SEND (0xC2, idx, sub, size);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA0);
+    CHK_MLTPX   (frm, idx, sub);
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);
+
+    /* -- BLOCK DOWNLOAD: 40 SEGMENTS -- */
+    TS_SendBlk(0x4C, 40, 1, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA2);
+    CHK_ACKSEQ  (frm, 40);
+
+    /* -- END BLOCK DOWNLOAD -- */
+    TS_EBLK_SEND(0xC1, 0x00000000);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA1);
+
+    CHK_DOM_FULL(dom, 0x4C);
+    TS_ASSERT(0 == COSdoDeferStat()->Parked);
+    TS_ASSERT(0 == DeferDropped);
+
+    CHK_NO_ERR(&node);
+}
+
+static void SdoDeferCleanup(void)
+{
+    COSdoDeferInit((CO_NODE *)0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_SDOS_DEFER()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(NULL, SdoDeferCleanup);
+
+    TS_RUNNER(TS_SdoDefer_ExpRdPending);
+    TS_RUNNER(TS_SdoDefer_ExpWrAbort);
+    TS_RUNNER(TS_SdoDefer_Timeout);
+    TS_RUNNER(TS_SdoDefer_NotPending);
+    TS_RUNNER(TS_SdoDefer_StackBlkWr);
+
+    TS_End();
+}
+
+/*! @} */
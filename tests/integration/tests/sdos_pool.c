@@ -0,0 +1,235 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup sdos_pool
+* \details    This test suite checks the buffer pool of the SDO servers.
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+#if CO_SDO_POOL_WRAP
+
+#include "co_sdo_pool.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Lease a pool buffer for two block downloads
+*
+*           The server gets a buffer with the initiation of the first block
+*           download. The buffer is returned after the end of the transfer
+*           and leased again for the second block download.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoPool_BlkWr)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom1;
+    CO_OBJ_DOM *dom2;
+    uint16_t    idx  = 0x2100;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    dom1 = DomCreate(idx, 0, CO_OBJ_____RW, 42);
+    dom2 = DomCreate(idx, 1, CO_OBJ_____RW, 43);
+    TS_CreateNode(&node, 0);
+    COSdoPoolInit(&node);
+    TS_ASSERT(0 == COSdoPoolStat()->Used);
+
+    /* -- FIRST BLOCK DOWNLOAD -- */
+    TS_SDO_SEND (0xC2, idx, 0, 42);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA0);
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);
+    TS_ASSERT(1 == COSdoPoolStat()->Used);
+    TS_ASSERT(1 == COSdoPoolStat()->Leases);
+
+    TS_SendBlk(0x00, 6, 1, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA2);
+    CHK_ACKSEQ  (frm, 6);
+
+    TS_EBLK_SEND(0xC1, 0x00000000);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA1);
+    CHK_DOM_FULL(dom1, 0);
+
+    /* -- SECOND BLOCK DOWNLOAD: SAME BUFFER -- */
+    TS_SDO_SEND (0xC2, idx, 1, 43);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA0);
+    TS_ASSERT(1 == COSdoPoolStat()->Used);
+    TS_ASSERT(2 == COSdoPoolStat()->Leases);
+
+    TS_SendBlk(0x00, 7, 1, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA2);
+    CHK_ACKSEQ  (frm, 7);
+
+    TS_EBLK_SEND(0xD9, 0x00000000);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA1);
+    CHK_DOM_FULL(dom2, 0);
+
+    TS_ASSERT(1 == COSdoPoolStat()->MaxUsed);
+    TS_ASSERT(0 == COSdoPoolStat()->Exhausted);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Return the pool buffer after a segmented upload
+*
+*           The buffer of the segmented upload is returned with the next
+*           request. The following expedited download needs no buffer.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoPool_SegRd)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 2;
+    uint32_t    val  = 0;
+    uint8_t     tgl  = 0x00;
+    uint32_t    id;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, 21);
+    DomFill(dom, 0);
+    TS_ODAdd(CO_KEY(0x2510, 3, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&val));
+    TS_CreateNode(&node, 0);
+    COSdoPoolInit(&node);
+
+    /* -- SEGMENTED UPLOAD -- */
+    TS_SDO_SEND (0x40, idx, sub, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x41);
+    TS_ASSERT(1 == COSdoPoolStat()->Used);
+
+    for (id = 0; id < 21; id += 7) {
+        TS_SDO_SEND((0x60 | tgl), 0, 0, 0);
+        CHK_CAN  (&frm);
+        CHK_SDO0 (frm, (id < 14) ? tgl : (0x01 | tgl));
+        CHK_SEG  (frm, id, 7);
+        tgl ^= 0x10;
+    }
+
+    /* -- EXPEDITED DOWNLOAD: BUFFER RETURNED -- */
+    TS_SDO_SEND (0x23, 0x2510, 3, 0x12345678);
+    CHK_SDO0_OK (0x2510, 3);
+    TS_ASSERT(0x12345678 == val);
+    TS_ASSERT(0 == COSdoPoolStat()->Used);
+    TS_ASSERT(1 == COSdoPoolStat()->Leases);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Abort a block download with an exhausted pool
+*
+*           All pool buffers are allocated by the application. The block
+*           download is aborted with 'out of memory' and succeeds after a
+*           buffer is returned to the pool.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoPool_Exhausted)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint8_t    *buf[CO_SDO_POOL_NUM];
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+    uint8_t     n;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, 42);
+    TS_CreateNode(&node, 0);
+    COSdoPoolInit(&node);
+    for (n = 0; n < CO_SDO_POOL_NUM; n++) {
+        buf[n] = COSdoPoolAlloc();
+        TS_ASSERT(0 != buf[n]);
+    }
+    TS_ASSERT(0 == COSdoPoolAlloc());
+
+    /* -- BLOCK DOWNLOAD: OUT OF MEMORY -- */
+    TS_SDO_SEND (0xC2, idx, sub, 42);
+    CHK_SDO0_ERR(idx, sub, CO_SDO_POOL_ERR_MEM);
+    TS_ASSERT(1 == COSdoPoolStat()->Exhausted);
+
+    /* -- BLOCK DOWNLOAD: BUFFER RETURNED -- */
+    COSdoPoolFree(buf[0]);
+    TS_SDO_SEND (0xC2, idx, sub, 42);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA0);
+
+    TS_SendBlk(0x00, 6, 1, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA2);
+    CHK_ACKSEQ  (frm, 6);
+
+    TS_EBLK_SEND(0xC1, 0x00000000);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA1);
+    CHK_DOM_FULL(dom, 0);
+
+    TS_ASSERT(CO_SDO_POOL_NUM == COSdoPoolStat()->Allocs);
+    TS_ASSERT(CO_SDO_POOL_NUM == COSdoPoolStat()->MaxUsed);
+
+    CHK_NO_ERR(&node);
+}
+
+static void SdoPoolCleanup(void)
+{
+    COSdoPoolInit((CO_NODE *)0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_SDOS_POOL()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(NULL, SdoPoolCleanup);
+
+    TS_RUNNER(TS_SdoPool_BlkWr);
+    TS_RUNNER(TS_SdoPool_SegRd);
+    TS_RUNNER(TS_SdoPool_Exhausted);
+
+    TS_End();
+}
+
+#endif  /* #if CO_SDO_POOL_WRAP */
+
+/*! @} */
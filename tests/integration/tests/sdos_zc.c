@@ -0,0 +1,299 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup sdos_zc
+* \details    This test suite checks the zero-copy uploads of the SDO servers.
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+#include "co_sdo_zc.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Segmented upload of a domain from the object memory
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoZc_SegRdDomain)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 2;
+    uint8_t     tgl  = 0x00;
+    uint32_t    id;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node, 0);
+    COSdoZcInit(&node);
+
+    /* -- INIT SEGMENTED UPLOAD -- */
+    TS_SDO_SEND (0x40, idx, sub, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x41);
+    CHK_MLTPX   (frm, idx, sub);
+    CHK_DATA    (frm, size);
+
+    /* -- SEGMENTED UPLOAD -- */
+    for (id = 0; id < size; id += 7) {
+        TS_SDO_SEND((0x60 | tgl), 0, 0, 0);
+        CHK_CAN  (&frm);
+        CHK_SDO0 (frm, (id < (size - 7)) ? tgl : (0x01 | tgl));
+        CHK_SEG  (frm, id, 7);
+        tgl ^= 0x10;
+    }
+
+    TS_ASSERT(1    == COSdoZcStat()->Transfers);
+    TS_ASSERT(size == COSdoZcStat()->Bytes);
+    TS_ASSERT(size == COSdoZcStat()->Copied);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Segmented upload of a string with a bad toggle bit
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoZc_SegRdStringToggle)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    uint16_t    idx  = 0x2530;
+    uint8_t     sub  = 2;
+    CO_OBJ_STR  str;
+    char       *strPtr = "abcdefghijklmnopqrstuvw";
+
+    str.Offset = 0;
+    str.Start  = (uint8_t *)strPtr;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____R_), CO_TSTRING, (CO_DATA)(&str));
+    TS_CreateNode(&node, 0);
+    COSdoZcInit(&node);
+
+    /* -- INIT SEGMENTED UPLOAD -- */
+    TS_SDO_SEND (0x40, idx, sub, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x41);
+    CHK_DATA    (frm, 23);
+
+    TS_SDO_SEND (0x60, 0, 0, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x00);
+    CHK_SEG     (frm, 'a', 7);
+
+    /* -- REPEATED TOGGLE BIT -- */
+    TS_SDO_SEND (0x60, 0, 0, 0);
+    CHK_SDO0_ERR(idx, sub, 0x05030000);
+
+    TS_ASSERT(0 == COSdoZcStat()->Transfers);
+    TS_ASSERT(1 == COSdoZcStat()->Aborted);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Block upload of a domain with a lost segment
+*
+*           The lost segment and all following segments are sent again
+*           from the object memory.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoZc_BlkRdLostSeg)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 26;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 'a');
+    TS_CreateNode(&node, 0);
+    COSdoZcInit(&node);
+
+    /* -- INIT BLOCK UPLOAD: 3 SEGMENTS PER BLOCK -- */
+    TS_SDO_SEND (0xA0, idx, sub, 3);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xC2);
+    CHK_MLTPX   (frm, idx, sub);
+    CHK_DATA    (frm, size);
+
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x01);
+    CHK_SEG     (frm, 'a', 7);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x02);
+    CHK_SEG     (frm, 'h', 7);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x03);
+    CHK_SEG     (frm, 'o', 7);
+
+    /* -- SEGMENT 3 LOST -- */
+    TS_ACKBLK_SEND(0xA2, 2, 3);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x01);
+    CHK_SEG     (frm, 'o', 7);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x82);
+    CHK_SEG     (frm, 'v', 5);
+
+    /* -- END BLOCK UPLOAD: 2 UNUSED BYTES -- */
+    TS_ACKBLK_SEND(0xA2, 2, 3);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xC9);
+    CHK_ZERO    (frm);
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+    CHK_NOCAN   (&frm);
+
+    TS_ASSERT(1    == COSdoZcStat()->Transfers);
+    TS_ASSERT(size == COSdoZcStat()->Bytes);
+    TS_ASSERT(33   == COSdoZcStat()->Copied);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Leave write-only domains to the stack
+*
+*           The upload of a write-only domain is aborted by the stack.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoZc_WriteOnly)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 8;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    DomCreate(idx, sub, CO_OBJ______W, 42);
+    TS_CreateNode(&node, 0);
+    COSdoZcInit(&node);
+
+    /* -- UPLOAD ABORTED BY THE STACK -- */
+    TS_SDO_SEND (0x40, idx, sub, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0x80);
+    CHK_MLTPX   (frm, idx, sub);
+    CHK_DATA    (frm, 0x06010001);
+
+    TS_ASSERT(0 == COSdoZcStat()->Transfers);
+    TS_ASSERT(0 == COSdoZcStat()->Aborted);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Leave the segments of a block download to the stack
+*
+*           Segment 64 of the block starts with 0x40 and the data bytes
+*           0x20, 0x21, 0x22, which look like the upload request of a
+*           domain. The segment belongs to the running transfer of the
+*           stack server.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SdoZc_StackBlkWr)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 70 * 7;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomCreate(0x2120, 0x22, CO_OBJ_____RW, 42);
+    TS_CreateNode(&node, 0);
+    COSdoZcInit(&node);
+
+    /* -- INIT BLOCK DOWNLOAD -- */
+    TS_SDO_SEND (0xC2, idx, sub, size);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA0);
+    CHK_MLTPX   (frm, idx, sub);
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);
+
+    /* -- BLOCK DOWNLOAD: 70 SEGMENTS -- */
+    TS_SendBlk(0x67, 70, 1, 0);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA2);
+    CHK_ACKSEQ  (frm, 70);
+
+    /* -- END BLOCK DOWNLOAD -- */
+    TS_EBLK_SEND(0xC1, 0x00000000);
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA1);
+
+    CHK_DOM_FULL(dom, 0x67);
+    TS_ASSERT(0 == COSdoZcStat()->Transfers);
+    TS_ASSERT(0 == COSdoZcStat()->Copied);
+
+    CHK_NO_ERR(&node);
+}
+
+static void SdoZcCleanup(void)
+{
+    COSdoZcInit((CO_NODE *)0);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_SDOS_ZC()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(NULL, SdoZcCleanup);
+
+    TS_RUNNER(TS_SdoZc_SegRdDomain);
+    TS_RUNNER(TS_SdoZc_SegRdStringToggle);
+    TS_RUNNER(TS_SdoZc_BlkRdLostSeg);
+    TS_RUNNER(TS_SdoZc_WriteOnly);
+    TS_RUNNER(TS_SdoZc_StackBlkWr);
+
+    TS_End();
+}
+
+/*! @} */
@@ -19,11 +19,31 @@
 ******************************************************************************/
 
 #include "def_suite.h"
+#include "co_sync_pipe.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t SyncPipeTicks;                        /* simulated tick counter                   */
+static uint32_t SyncPipeCalls;                        /* number of batch send calls               */
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+static uint32_t SyncPipeClock(void)
+{
+    SyncPipeTicks++;
+    return (SyncPipeTicks);
+}
+
+static int16_t SyncPipeSend(CO_IF_FRM *frm, uint8_t num)
+{
+    SyncPipeCalls++;
+    return (SimCanSendBatch(frm, num));
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TC1
 *
@@ -258,6 +278,73 @@ TS_DEF_MAIN(TS_Sync_change_period)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+#if CO_TPDO_N >= 32
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC8
+*
+*          This testcase will check the SYNC pipeline with 32 synchronous TPDOs: the
+*          synchronous RPDO is latched before the TPDOs are built, all TPDOs are handed
+*          to the driver in one call and the SYNC-to-last-TPDO latency is reported.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Sync_pipe_32TPdo)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  rpdo_id      = 0x40000200;
+    uint32_t  rpdo_map     = CO_KEY(0x2600, 1, 0x20);
+    uint32_t  tpdo_id[32];
+    uint32_t  tpdo_map[32];
+    uint32_t  data[32];
+    uint8_t   pdo_type     = 1;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   pdo_len      = 1;
+    uint8_t   n;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &pdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &pdo_len);
+    for (n = 0; n < 32; n++) {
+        tpdo_id[n]  = 0x40000300 + n;
+        tpdo_map[n] = CO_KEY(0x2600, 1 + n, 0x20);
+        data[n]     = 0;
+        TS_CreateTPdoCom(n, &tpdo_id[n], &pdo_type, &tpdo_inhibit, &tpdo_evtime);
+        TS_CreateTPdoMap(n, &tpdo_map[n], &pdo_len);
+    }
+    for (n = 0; n < 32; n++) {
+        TS_ODAdd(CO_KEY(0x2600, 1 + n, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data[n]));
+    }
+    TS_CreateNodeAutoStart(&node);
+
+    SyncPipeTicks = 0;
+    SyncPipeCalls = 0;
+    COSyncPipeInit(&node, SyncPipeSend, SyncPipeClock);
+
+    TS_PDO_SEND(0x201, 0x51);                         /* synchronous RPDO, latched until SYNC     */
+    TS_ASSERT(0 == data[0]);
+
+    TS_SYNC_SEND();
+
+    TS_ASSERT(0x54535251 == data[0]);                 /* RPDO written before TPDOs are built      */
+    for (n = 0; n < 32; n++) {
+        CHK_CAN  (&frm);                              /* check for a CAN frame                    */
+        CHK_PDO0 (frm, 0x301u + n, 4);                /* check PDO #n (Id and DLC)                */
+        CHK_LONG (frm, 0, (n == 0) ? 0x54535251 : 0);
+    }
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    TS_ASSERT(1  == SyncPipeCalls);                   /* one driver call per SYNC                 */
+    TS_ASSERT(32 == COSyncPipeStat()->Frames);
+    TS_ASSERT(1  == COSyncPipeStat()->Cycles);
+    TS_ASSERT(1  == COSyncPipeStat()->Last);          /* one tick between SYNC and batch send     */
+    TS_ASSERT(1  == COSyncPipeStat()->Max);
+
+    COSyncPipeInit((CO_NODE *)0, 0, 0);
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+#endif
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -273,6 +360,9 @@ SUITE_SYNC_PROD()
     TS_RUNNER(TS_Sync_change_id);
     TS_RUNNER(TS_Sync_freeze_id);
     TS_RUNNER(TS_Sync_change_period);
+#if CO_TPDO_N >= 32
+    TS_RUNNER(TS_Sync_pipe_32TPdo);
+#endif
 
     TS_End();
 }
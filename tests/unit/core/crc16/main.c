@@ -0,0 +1,111 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_crc16.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static const uint8_t Check[] = "123456789";
+
+static uint8_t Data[300];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void Fill(void)
+{
+    uint32_t i;
+    uint32_t x = 0x12345678u;
+
+    for (i = 0; i < sizeof(Data); i++) {
+        x       = (x * 1103515245u) + 12345u;
+        Data[i] = (uint8_t)(x >> 16);
+    }
+}
+
+/******************************************************************************
+* TEST CASES
+******************************************************************************/
+
+void test_check_value(void)
+{
+    TEST_CHECK(COCrc16Ref   (0, Check, 9) == 0x31C3);
+    TEST_CHECK(COCrc16Slice4(0, Check, 9) == 0x31C3);
+    TEST_CHECK(COCrc16      (0, Check, 9) == 0x31C3);
+}
+
+void test_empty(void)
+{
+    TEST_CHECK(COCrc16Ref   (0x1D0F, Check, 0) == 0x1D0F);
+    TEST_CHECK(COCrc16Slice4(0x1D0F, Check, 0) == 0x1D0F);
+}
+
+void test_slice4_ref(void)
+{
+    uint32_t ofs;
+    uint32_t len;
+
+    Fill();
+    for (ofs = 0; ofs < 4; ofs++) {                /* unaligned start        */
+        for (len = 0; len < 290; len++) {
+            TEST_CHECK_(COCrc16Slice4(0x5A5A, &Data[ofs], len) ==
+                        COCrc16Ref   (0x5A5A, &Data[ofs], len),
+                        "offset %u, length %u", ofs, len);
+        }
+    }
+}
+
+void test_segmented(void)
+{
+    uint16_t crc = 0;
+    uint32_t pos = 0;
+    uint32_t seg = 1;
+
+    Fill();
+    while (pos < sizeof(Data)) {                   /* growing segment sizes  */
+        if (seg > (sizeof(Data) - pos)) {
+            seg = sizeof(Data) - pos;
+        }
+        crc  = COCrc16Slice4(crc, &Data[pos], seg);
+        pos += seg;
+        seg += 3;
+    }
+    TEST_CHECK(crc == COCrc16Ref(0, Data, sizeof(Data)));
+}
+
+void test_build(void)
+{
+    Fill();
+    TEST_CHECK(COCrc16(0, Data, sizeof(Data)) == COCrc16Ref(0, Data, sizeof(Data)));
+}
+
+
+TEST_LIST = {
+    { "check_value", test_check_value },
+    { "empty",       test_empty       },
+    { "slice4_ref",  test_slice4_ref  },
+    { "segmented",   test_segmented   },
+    { "build",       test_build       },
+    { NULL, NULL }
+};
@@ -0,0 +1,292 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "co_dict_idx.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* number of object entries in large dictionary tests */
+#define TS_LARGE   1000
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint16_t Slot[4096];
+
+static CO_OBJ   Large[TS_LARGE + 1];
+
+/******************************************************************************
+* TEST CASES - INIT
+******************************************************************************/
+
+void test_no_init(void)
+{
+    CO_DICT_IDX idx = { 0 };
+    CO_OBJ     *result;
+
+    result = CODictIdxFind(&idx, CO_DEV(0x1234, 0x56));
+
+    TEST_CHECK(result == NULL);
+}
+
+void test_empty(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    int16_t     num;
+    CO_OBJ      obj[1] = {
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 1);
+
+    num = CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    TEST_CHECK(num < 0);
+    TEST_CHECK(CODictIdxFind(&idx, CO_DEV(0x1234, 0x56)) == NULL);
+}
+
+void test_too_small(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    int16_t     num;
+    CO_OBJ      obj[5] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        { CO_KEY(0x3456, 0x78, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) },
+        { CO_KEY(0x4567, 0x89, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 5);
+
+    num = CODictIdxInit(&idx, &node.Dict, &Slot[0], 4);
+
+    TEST_CHECK(num < 0);
+    TEST_CHECK(CODictIdxFind(&idx, CO_DEV(0x1234, 0x56)) == NULL);
+}
+
+/******************************************************************************
+* TEST CASES - FIND
+******************************************************************************/
+
+void test_single(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[2] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 2);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    result = CODictIdxFind(&idx, CO_DEV(0x1234, 0x56));
+
+    TEST_CHECK(result == &obj[0]);
+}
+
+void test_first(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[5] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        { CO_KEY(0x3456, 0x78, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) },
+        { CO_KEY(0x4567, 0x89, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 5);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    result = CODictIdxFind(&idx, CO_DEV(0x1234, 0x56));
+
+    TEST_CHECK(result == &obj[0]);
+}
+
+void test_middle(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[5] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        { CO_KEY(0x3456, 0x78, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) },
+        { CO_KEY(0x4567, 0x89, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 5);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    result = CODictIdxFind(&idx, CO_DEV(0x3456, 0x78));
+
+    TEST_CHECK(result == &obj[2]);
+}
+
+void test_last(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[5] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        { CO_KEY(0x3456, 0x78, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) },
+        { CO_KEY(0x4567, 0x89, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 5);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    result = CODictIdxFind(&idx, CO_DEV(0x4567, 0x89));
+
+    TEST_CHECK(result == &obj[3]);
+}
+
+void test_not_found(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[5] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        { CO_KEY(0x3456, 0x78, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) },
+        { CO_KEY(0x4567, 0x89, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 5);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    result = CODictIdxFind(&idx, CO_DEV(0x5678, 0x90));
+
+    TEST_CHECK(result == NULL);
+}
+
+void test_ignore_flags(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[3] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 3);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    result = CODictIdxFind(&idx, CO_KEY(0x2345, 0x67, CO_OBJ_____R_));
+
+    TEST_CHECK(result == &obj[1]);
+}
+
+void test_large(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    uint32_t    n;
+    int16_t     num;
+    uint32_t    fail = 0;
+
+    for (n = 0; n < TS_LARGE; n++) {
+        Large[n].Key  = CO_KEY(0x2000 + (n >> 4), n & 0xF, CO_OBJ_D___RW);
+        Large[n].Type = CO_TUNSIGNED8;
+        Large[n].Data = (CO_DATA)(n);
+    }
+    Large[TS_LARGE].Key = 0;
+    CODictInit(&node.Dict, &node, &Large[0], TS_LARGE + 1);
+
+    num = CODictIdxInit(&idx, &node.Dict, &Slot[0], 4096);
+
+    TEST_CHECK(num == TS_LARGE);
+    for (n = 0; n < TS_LARGE; n++) {
+        if (CODictIdxFind(&idx, CO_DEV(0x2000 + (n >> 4), n & 0xF)) != &Large[n]) {
+            fail++;
+        }
+    }
+    TEST_CHECK(fail == 0);
+    TEST_CHECK(CODictIdxFind(&idx, CO_DEV(0x2000, 0x10)) == NULL);
+}
+
+void test_stale(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[4] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        CO_OBJ_DICT_ENDMARK,
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    obj[2]    = obj[1];                     /* insert 0x1800:01 in the middle */
+    obj[1].Key = CO_KEY(0x1800, 0x01, CO_OBJ_D___RW);
+
+    result = CODictIdxFind(&idx, CO_DEV(0x2345, 0x67));
+
+    TEST_CHECK(result == NULL);
+}
+
+void test_clear(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_IDX idx  = { 0 };
+    CO_OBJ     *result;
+    CO_OBJ      obj[2] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 2);
+    CODictIdxInit(&idx, &node.Dict, &Slot[0], 16);
+
+    CODictIdxClear(&idx);
+    result = CODictIdxFind(&idx, CO_DEV(0x1234, 0x56));
+
+    TEST_CHECK(result == NULL);
+}
+
+
+TEST_LIST = {
+    { "no_init",       test_no_init       },
+    { "empty",         test_empty         },
+    { "too_small",     test_too_small     },
+    { "single",        test_single        },
+    { "first",         test_first         },
+    { "middle",        test_middle        },
+    { "last",          test_last          },
+    { "not_found",     test_not_found     },
+    { "ignore_flags",  test_ignore_flags  },
+    { "large",         test_large         },
+    { "stale",         test_stale         },
+    { "clear",         test_clear         },
+    { NULL, NULL }
+};
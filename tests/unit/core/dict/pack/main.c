@@ -0,0 +1,337 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "co_dict_pack.h"
+#include "co_unsigned64.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_OBJ_PACK        Entry[16];
+static uint8_t            TypeIdx[16];
+static const CO_OBJ_TYPE *Type[8];
+static CO_OBJ             Pin[4];
+
+static const CO_DICT_PACK_SPEC Spec = {
+    &Entry[0], &TypeIdx[0], 16, &Type[0], 8, &Pin[0], 4
+};
+
+/******************************************************************************
+* TEST CASES - BUILD
+******************************************************************************/
+
+void test_bad_arg(void)
+{
+    CO_DICT_PACK      pack;
+    CO_DICT_PACK_SPEC spec = Spec;
+    int16_t           err;
+
+    spec.Entry = NULL;
+    err = CODictPackInit(&pack, &spec);
+
+    TEST_CHECK(err < 0);
+}
+
+void test_size(void)
+{
+    TEST_CHECK((sizeof(CO_OBJ_PACK) + sizeof(uint8_t)) < sizeof(CO_OBJ));
+}
+
+void test_order(void)
+{
+    CO_DICT_PACK pack;
+    int16_t      err;
+
+    CODictPackInit(&pack, &Spec);
+    err = CODictPackAdd(&pack, CO_KEY(0x1018, 1, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(1));
+    TEST_CHECK(err == 0);
+
+    err = CODictPackAdd(&pack, CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(4));
+    TEST_CHECK(err < 0);
+
+    err = CODictPackAdd(&pack, CO_KEY(0x1018, 1, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(1));
+    TEST_CHECK(err < 0);
+
+    err = CODictPackAdd(&pack, CO_KEY(0x1018, 1, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(0));
+    TEST_CHECK(err < 0);                        /* pinned entries as well */
+    TEST_CHECK(CODictPackSize(&pack) == 2);
+}
+
+void test_full(void)
+{
+    CO_DICT_PACK      pack;
+    CO_DICT_PACK_SPEC spec = Spec;
+    int16_t           err;
+
+    spec.EntryMax = 1;
+    CODictPackInit(&pack, &spec);
+    err = CODictPackAdd(&pack, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+    TEST_CHECK(err == 0);
+
+    err = CODictPackAdd(&pack, CO_KEY(0x1001, 0, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(0));
+    TEST_CHECK(err < 0);
+}
+
+void test_type_table(void)
+{
+    CO_DICT_PACK pack;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+    CODictPackAdd(&pack, CO_KEY(0x1001, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(0));
+    CODictPackAdd(&pack, CO_KEY(0x1002, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+
+    TEST_CHECK(pack.TypeNum == 2);
+}
+
+/******************************************************************************
+* TEST CASES - FIND
+******************************************************************************/
+
+void test_direct(void)
+{
+    CO_DICT_PACK pack;
+    CO_OBJ      *obj;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(4));
+
+    obj = CODictPackFind(&pack, CO_DEV(0x1018, 0));
+
+    TEST_CHECK(pack.PinNum == 0);
+    TEST_CHECK(obj != NULL);
+    TEST_CHECK(obj->Key  == CO_KEY(0x1018, 0, CO_OBJ_D___R_));
+    TEST_CHECK(obj->Type == CO_TUNSIGNED8);
+    TEST_CHECK(obj->Data == 4);
+}
+
+void test_direct_write(void)
+{
+    CO_DICT_PACK pack;
+    CO_OBJ      *obj;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x2000, 0, CO_OBJ_D___RW), CO_TUNSIGNED32, (CO_DATA)(0x11223344));
+
+    obj = CODictPackFind(&pack, CO_DEV(0x2000, 0));
+
+    TEST_CHECK(obj->Data == (CO_DATA)(&Entry[0].Data));
+    TEST_CHECK(CO_IS_DIRECT(obj->Key) == 0);
+    TEST_CHECK(*(uint32_t *)obj->Data == 0x11223344);
+
+    *(uint32_t *)obj->Data = 0x55667788;                  /* write via view */
+    obj = CODictPackFind(&pack, CO_DEV(0x2000, 0));
+
+    TEST_CHECK(*(uint32_t *)obj->Data == 0x55667788);
+}
+
+void test_ref(void)
+{
+    CO_DICT_PACK pack;
+    CO_OBJ      *obj;
+    uint16_t     var = 0x1234;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x2001, 2, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&var));
+
+    obj = CODictPackFind(&pack, CO_DEV(0x2001, 2));
+
+    TEST_CHECK(obj->Key  == CO_KEY(0x2001, 2, CO_OBJ_____RW));
+    TEST_CHECK(obj->Data == (CO_DATA)(&var));
+}
+
+void test_wide(void)
+{
+    CO_DICT_PACK pack;
+    CO_OBJ      *obj;
+    uint64_t     var = 0x1122334455667788uLL;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x2002, 0, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&var));
+
+    obj = CODictPackFind(&pack, CO_DEV(0x2002, 0));
+
+    TEST_CHECK(pack.PinNum == 1);               /* 64-bit types are pinned */
+    TEST_CHECK(pack.EntryNum == 0);
+    TEST_CHECK(obj == &Pin[0]);
+    TEST_CHECK(obj->Type == CO_TUNSIGNED64);
+    TEST_CHECK(obj->Data == (CO_DATA)(&var));
+}
+
+void test_wide_segmented(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_PACK pack;
+    CO_OBJ      *obj;
+    CO_OBJ      *other;
+    uint64_t     var  = 0;
+    uint64_t     val  = 0x1122334455667788uLL;
+    uint32_t     next = 0x55AA55AAuL;
+    uint32_t     n;
+    CO_ERR       err;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x2002, 0, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&var));
+    CODictPackAdd(&pack, CO_KEY(0x2003, 0, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&next));
+
+    /* initiate: the SDO server keeps the object entry of the transfer */
+    obj = CODictPackFind(&pack, CO_DEV(0x2002, 0));
+
+    /* segments: other services look up entries between the frames */
+    for (n = 0; n <= CO_DICT_PACK_RING; n++) {
+        other = CODictPackFind(&pack, CO_DEV(0x2003, 0));
+        TEST_CHECK(other != obj);
+    }
+
+    /* last segment: the received value is written to the kept entry */
+    err = COObjWrValue(obj, &node, &val, sizeof(val));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(obj->Type == CO_TUNSIGNED64);
+    TEST_CHECK(var  == 0x1122334455667788uLL);
+    TEST_CHECK(next == 0x55AA55AAuL);
+}
+
+void test_pinned(void)
+{
+    CO_DICT_PACK pack;
+    CO_OBJ      *obj;
+    CO_OBJ      *again;
+    uint32_t     var = 0;
+    CO_OBJ_DOM   dom = { 0, 0, 0 };
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x2100, 1, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&var));
+    CODictPackAdd(&pack, CO_KEY(0x2200, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&dom));
+
+    obj   = CODictPackFind(&pack, CO_DEV(0x2100, 1));
+    again = CODictPackFind(&pack, CO_DEV(0x2100, 1));
+
+    TEST_CHECK(pack.PinNum == 2);
+    TEST_CHECK(pack.EntryNum == 0);
+    TEST_CHECK(obj == &Pin[0]);
+    TEST_CHECK(obj == again);
+    TEST_CHECK(CODictPackFind(&pack, CO_DEV(0x2200, 0)) == &Pin[1]);
+    TEST_CHECK(Pin[2].Key == 0);                /* end-marker */
+}
+
+void test_pin_full(void)
+{
+    CO_DICT_PACK pack;
+    uint32_t     var = 0;
+    int16_t      err;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x2100, 1, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&var));
+    CODictPackAdd(&pack, CO_KEY(0x2100, 2, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&var));
+    CODictPackAdd(&pack, CO_KEY(0x2100, 3, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&var));
+
+    err = CODictPackAdd(&pack, CO_KEY(0x2100, 4, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&var));
+
+    TEST_CHECK(err < 0);                        /* last pin is end-marker */
+    TEST_CHECK(pack.PinNum == 3);
+}
+
+void test_ring(void)
+{
+    CO_DICT_PACK pack;
+    CO_OBJ      *first;
+    CO_OBJ      *obj;
+    uint32_t     n;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(7));
+    CODictPackAdd(&pack, CO_KEY(0x1001, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(8));
+
+    first = CODictPackFind(&pack, CO_DEV(0x1000, 0));
+    for (n = 1; n < CO_DICT_PACK_RING; n++) {
+        obj = CODictPackFind(&pack, CO_DEV(0x1001, 0));
+        TEST_CHECK(obj != first);
+    }
+
+    TEST_CHECK(first->Data == 7);
+}
+
+void test_not_found(void)
+{
+    CO_DICT_PACK pack;
+    CO_OBJ      *obj;
+
+    CODictPackInit(&pack, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(7));
+    CODictPackAdd(&pack, CO_KEY(0x1002, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(7));
+
+    obj = CODictPackFind(&pack, CO_DEV(0x1001, 0));
+
+    TEST_CHECK(obj == NULL);
+}
+
+/******************************************************************************
+* TEST CASES - ADAPTER
+******************************************************************************/
+
+void test_attach(void)
+{
+    CO_NODE      node  = { 0 };
+    CO_DICT_PACK pack;
+    CO_DICT_PACK other;
+    CO_OBJ       plain[1] = { CO_OBJ_DICT_ENDMARK };
+    uint8_t      ok;
+
+    uint32_t     var = 0;
+
+    CODictPackInit(&pack,  &Spec);
+    CODictPackInit(&other, &Spec);
+    CODictPackAdd(&pack, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(7));
+    CODictPackAdd(&pack, CO_KEY(0x2100, 1, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&var));
+
+    ok = CODictPackAttach(&node.Dict, &node, &plain[0], 1);
+    TEST_CHECK(ok == 0);
+
+    ok = CODictPackAttach(&node.Dict, &node, CODictPackRoot(&pack), CODictPackSize(&pack));
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(CODictPackSize(&pack) == 3);
+    TEST_CHECK(node.Dict.Root == &Pin[0]);      /* stable PDO entry position */
+    TEST_CHECK(node.Dict.Num == 1);
+    TEST_CHECK(CODictPackGet(&node.Dict) == &pack);
+}
+
+
+TEST_LIST = {
+    { "bad_arg",      test_bad_arg      },
+    { "size",         test_size         },
+    { "order",        test_order        },
+    { "full",         test_full         },
+    { "type_table",   test_type_table   },
+    { "direct",       test_direct       },
+    { "direct_write", test_direct_write },
+    { "ref",          test_ref          },
+    { "wide",         test_wide         },
+    { "wide_segmented", test_wide_segmented },
+    { "pinned",       test_pinned       },
+    { "pin_full",     test_pin_full     },
+    { "ring",         test_ring         },
+    { "not_found",    test_not_found    },
+    { "attach",       test_attach       },
+    { NULL, NULL }
+};
@@ -0,0 +1,53 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_dict_static.hpp"
+
+/******************************************************************************
+* REJECTED DICTIONARIES
+*
+* Each case must fail to compile with the static_assert of the builder;
+* the tests build the case and match the static_assert message.
+******************************************************************************/
+
+static uint32_t SyncId = 0x80;
+
+#if defined(FAIL_DUP_KEY)
+using FailDict = co::od::Dict<
+    co::od::Val<0x1000, 0, CO_OBJ_D___R_, uint32_t, 0x191u>,
+    co::od::Ref<0x1005, 0, CO_OBJ_____RW, &SyncId>,
+    co::od::Val<0x1000, 0, CO_OBJ_D___R_, uint32_t, 0x192u>
+>;
+#elif defined(FAIL_BAD_FLAGS)
+using FailDict = co::od::Dict<
+    co::od::Ref<0x1005, 0, (uint8_t)(CO_OBJ_____RW | 0x80u), &SyncId>
+>;
+#elif defined(FAIL_DIRECT_WRITE)
+using FailDict = co::od::Dict<
+    co::od::Val<0x1000, 0, CO_OBJ_D___RW, uint32_t, 0x191u>
+>;
+#else
+#error "no failure case selected"
+#endif
+
+CO_OBJ *FailGet(void)
+{
+    return (FailDict::Get());
+}
@@ -0,0 +1,128 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_dict_static.hpp"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t        ErrReg   = 0;
+static uint32_t       SyncId   = 0x80;
+static const uint16_t HbTime   = 1000;
+static int32_t        Position = -42;
+
+using TestDict = co::od::Dict<
+    co::od::Ref<0x2000, 0, CO_OBJ____PRW, &Position>,
+    co::od::Ref<0x1017, 0, CO_OBJ_____R_, &HbTime>,
+    co::od::Val<0x1018, 1, CO_OBJ_D___R_, uint32_t, 0x12345678u>,
+    co::od::Ref<0x1005, 0, CO_OBJ_____RW, &SyncId>,
+    co::od::Val<0x1018, 0, CO_OBJ_D___R_, uint8_t, 1>,
+    co::od::Val<0x1000, 0, CO_OBJ_D___R_, uint32_t, 0x191u>,
+    co::od::Ref<0x1001, 0, CO_OBJ_____R_, &ErrReg>
+>;
+
+/* resolved and checked at compile time */
+static_assert(TestDict::Size == 8, "wrong dictionary size");
+static_assert(TestDict::Index<0x1000, 0>() == 0, "wrong position of 1000:0");
+static_assert(TestDict::Index<0x1018, 1>() == 5, "wrong position of 1018:1");
+static_assert(TestDict::Index<0x2000, 0>() == 6, "wrong position of 2000:0");
+
+/******************************************************************************
+* TEST CASES
+******************************************************************************/
+
+void test_sorted(void)
+{
+    CO_OBJ   *od = TestDict::Get();
+    uint16_t  n;
+
+    for (n = 1; n < TestDict::Size - 1; n++) {
+        TEST_CHECK((od[n - 1].Key >> 8) < (od[n].Key >> 8));
+    }
+}
+
+void test_endmark(void)
+{
+    CO_OBJ *od = TestDict::Get();
+
+    TEST_CHECK(od[TestDict::Size - 1].Key  == 0);
+    TEST_CHECK(od[TestDict::Size - 1].Type == NULL);
+    TEST_CHECK(od[TestDict::Size - 1].Data == 0);
+}
+
+void test_ref(void)
+{
+    CO_OBJ *obj = TestDict::Find<0x1005, 0>();
+
+    TEST_CHECK(obj->Key  == CO_KEY(0x1005, 0, CO_OBJ_____RW));
+    TEST_CHECK(obj->Type == CO_TUNSIGNED32);
+    TEST_CHECK(obj->Data == (CO_DATA)(&SyncId));
+}
+
+void test_const_ref(void)
+{
+    CO_OBJ *obj = TestDict::Find<0x1017, 0>();
+
+    TEST_CHECK(obj->Type == CO_TUNSIGNED16);
+    TEST_CHECK(obj->Data == (CO_DATA)(&HbTime));
+}
+
+void test_signed(void)
+{
+    CO_OBJ *obj = TestDict::Find<0x2000, 0>();
+
+    TEST_CHECK(obj->Type == CO_TSIGNED32);
+    TEST_CHECK(*(int32_t *)obj->Data == -42);
+}
+
+void test_val(void)
+{
+    CO_OBJ *obj = TestDict::Find<0x1018, 1>();
+
+    TEST_CHECK(obj->Key  == CO_KEY(0x1018, 1, CO_OBJ_D___R_));
+    TEST_CHECK(obj->Type == CO_TUNSIGNED32);
+    TEST_CHECK(obj->Data == (CO_DATA)0x12345678u);
+}
+
+void test_find(void)
+{
+    CO_NODE  node = {};
+    CO_OBJ  *obj;
+
+    CODictInit(&node.Dict, &node, TestDict::Get(), TestDict::Size);
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x1001, 0));
+
+    TEST_CHECK(obj == (TestDict::Find<0x1001, 0>()));
+}
+
+
+TEST_LIST = {
+    { "sorted",     test_sorted     },
+    { "endmark",    test_endmark    },
+    { "ref",        test_ref        },
+    { "const_ref",  test_const_ref  },
+    { "signed",     test_signed     },
+    { "val",        test_val        },
+    { "find",       test_find       },
+    { NULL, NULL }
+};
@@ -0,0 +1,260 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "co_if_fd.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* frames of the test driver */
+static CO_IF_FD_FRM RxFrm[4];
+static uint8_t      RxNum;
+static uint8_t      RxPos;
+static CO_IF_FD_FRM TxFrm;
+static uint8_t      TxNum;
+static uint32_t     EnNominal;
+static uint32_t     EnData;
+
+/* frames of the receive function */
+static CO_IF_FD_FRM FdFrm;
+static uint8_t      FdNum;
+
+/******************************************************************************
+* TEST DRIVER
+******************************************************************************/
+
+static void    DrvInit   (void) { }
+static void    DrvEnable (uint32_t nominal, uint32_t data) { EnNominal = nominal; EnData = data; }
+static void    DrvReset  (void) { }
+static void    DrvClose  (void) { }
+
+static int16_t DrvRead(CO_IF_FD_FRM *frm)
+{
+    if (RxPos >= RxNum) {
+        return (0);
+    }
+    *frm = RxFrm[RxPos++];
+    return ((int16_t)sizeof(CO_IF_FD_FRM));
+}
+
+static int16_t DrvSend(CO_IF_FD_FRM *frm)
+{
+    TxFrm = *frm;
+    TxNum++;
+    return ((int16_t)sizeof(CO_IF_FD_FRM));
+}
+
+static const CO_IF_FD_DRV TestDrv = {
+    DrvInit, DrvEnable, DrvRead, DrvSend, DrvReset, DrvClose
+};
+
+static int16_t Recv(CO_IF_FD_FRM *frm)
+{
+    FdFrm = *frm;
+    FdNum++;
+    return (1);
+}
+
+static void Setup(uint32_t rate)
+{
+    memset(&RxFrm[0], 0, sizeof(RxFrm));
+    memset(&TxFrm, 0, sizeof(TxFrm));
+    RxNum = 0;
+    RxPos = 0;
+    TxNum = 0;
+    FdNum = 0;
+    COIfFdInit(&TestDrv, rate, Recv);
+}
+
+/******************************************************************************
+* TEST CASES - DLC
+******************************************************************************/
+
+void test_dlc_to_len(void)
+{
+    TEST_CHECK(COIfFdDlcToLen(0)  == 0);
+    TEST_CHECK(COIfFdDlcToLen(8)  == 8);
+    TEST_CHECK(COIfFdDlcToLen(9)  == 12);
+    TEST_CHECK(COIfFdDlcToLen(13) == 32);
+    TEST_CHECK(COIfFdDlcToLen(15) == 64);
+}
+
+void test_len_to_dlc(void)
+{
+    TEST_CHECK(COIfFdLenToDlc(5)  == 5);
+    TEST_CHECK(COIfFdLenToDlc(9)  == 9);
+    TEST_CHECK(COIfFdLenToDlc(12) == 9);
+    TEST_CHECK(COIfFdLenToDlc(33) == 14);
+    TEST_CHECK(COIfFdLenToDlc(64) == 15);
+}
+
+/******************************************************************************
+* TEST CASES - ADAPTER
+******************************************************************************/
+
+void test_read_classic(void)
+{
+    CO_IF_FRM frm;
+    int16_t   err;
+
+    Setup(0);
+    RxFrm[0].Identifier = 0x181;
+    RxFrm[0].DLC        = 2;
+    RxFrm[0].Data[1]    = 0x22;
+    RxNum = 1;
+
+    err = COIfFdCanDriver.Read(&frm);
+
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(frm.Identifier == 0x181);
+    TEST_CHECK(frm.DLC == 2);
+    TEST_CHECK(frm.Data[1] == 0x22);
+    TEST_CHECK(FdNum == 0);
+}
+
+void test_read_fd(void)
+{
+    CO_IF_FRM frm;
+    int16_t   err;
+
+    Setup(0);
+    RxFrm[0].Identifier = 0x201;
+    RxFrm[0].DLC        = 64;
+    RxFrm[0].Flags      = CO_IF_FD_FDF;
+    RxFrm[0].Data[63]   = 0x63;
+    RxFrm[1].Identifier = 0x182;
+    RxFrm[1].DLC        = 1;
+    RxNum = 2;
+
+    err = COIfFdCanDriver.Read(&frm);
+
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(frm.Identifier == 0x182);
+    TEST_CHECK(FdNum == 1);
+    TEST_CHECK(FdFrm.Identifier == 0x201);
+    TEST_CHECK(FdFrm.Data[63] == 0x63);
+
+    err = COIfFdCanDriver.Read(&frm);
+    TEST_CHECK(err == 0);
+}
+
+void test_send_classic(void)
+{
+    CO_IF_FRM frm = { 0 };
+    int16_t   err;
+
+    Setup(2000000);
+    COIfFdCanDriver.Enable(500000);
+    frm.Identifier = 0x701;
+    frm.DLC        = 1;
+    frm.Data[0]    = 0x05;
+
+    err = COIfFdCanDriver.Send(&frm);
+
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(EnNominal == 500000);
+    TEST_CHECK(EnData == 2000000);
+    TEST_CHECK(TxFrm.Identifier == 0x701);
+    TEST_CHECK(TxFrm.Flags == 0);
+    TEST_CHECK(TxFrm.Data[0] == 0x05);
+}
+
+void test_send_pad(void)
+{
+    CO_IF_FD_FRM frm;
+    int16_t      err;
+
+    Setup(2000000);
+    memset(&frm, 0xAA, sizeof(frm));
+    frm.Identifier = 0x181;
+    frm.DLC        = 33;
+    frm.Flags      = CO_IF_FD_FDF | CO_IF_FD_BRS;
+
+    err = COIfFdSend(&frm);
+
+    TEST_CHECK(err > 0);
+    TEST_CHECK(TxFrm.DLC == 48);
+    TEST_CHECK(TxFrm.Data[32] == 0xAA);
+    TEST_CHECK(TxFrm.Data[33] == 0x00);
+    TEST_CHECK(TxFrm.Data[47] == 0x00);
+    TEST_CHECK(TxFrm.Flags == (CO_IF_FD_FDF | CO_IF_FD_BRS));
+}
+
+void test_send_no_brs(void)
+{
+    CO_IF_FD_FRM frm = { 0 };
+
+    Setup(0);
+    frm.Identifier = 0x181;
+    frm.DLC        = 12;
+    frm.Flags      = CO_IF_FD_FDF | CO_IF_FD_BRS;
+
+    (void)COIfFdSend(&frm);
+
+    TEST_CHECK(TxFrm.Flags == CO_IF_FD_FDF);
+}
+
+void test_send_bad(void)
+{
+    CO_IF_FD_FRM frm = { 0 };
+    int16_t      err;
+
+    Setup(0);
+    frm.DLC = 12;                                 /* classical frame > 8  */
+    err = COIfFdSend(&frm);
+    TEST_CHECK(err < 0);
+
+    frm.DLC   = 65;
+    frm.Flags = CO_IF_FD_FDF;
+    err = COIfFdSend(&frm);
+    TEST_CHECK(err < 0);
+    TEST_CHECK(TxNum == 0);
+}
+
+void test_disabled(void)
+{
+    CO_IF_FD_FRM fd  = { 0 };
+    CO_IF_FRM    frm = { 0 };
+
+    COIfFdInit((const CO_IF_FD_DRV *)0, 0, (CO_IF_FD_RECV)0);
+
+    TEST_CHECK(COIfFdSend(&fd) < 0);
+    TEST_CHECK(COIfFdCanDriver.Read(&frm) < 0);
+    TEST_CHECK(COIfFdCanDriver.Send(&frm) < 0);
+}
+
+
+TEST_LIST = {
+    { "dlc_to_len",   test_dlc_to_len   },
+    { "len_to_dlc",   test_len_to_dlc   },
+    { "read_classic", test_read_classic },
+    { "read_fd",      test_read_fd      },
+    { "send_classic", test_send_classic },
+    { "send_pad",     test_send_pad     },
+    { "send_no_brs",  test_send_no_brs  },
+    { "send_bad",     test_send_bad     },
+    { "disabled",     test_disabled     },
+    { NULL, NULL }
+};
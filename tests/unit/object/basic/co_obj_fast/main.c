@@ -0,0 +1,425 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "co_obj_fast.h"
+
+void StubReset(void);
+#define TEST_INIT StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASE - STUB FUNCTIONS
+******************************************************************************/
+
+uint32_t StubPdoTrigObj = 0;
+void COTPdoTrigObj(CO_TPDO *tpdo, CO_OBJ *obj)
+{
+    StubPdoTrigObj++;
+}
+
+void StubReset(void)
+{
+    StubPdoTrigObj = 0;
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_ref8(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  data = 0x12;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&data)};
+    uint8_t  var  = 0;
+    uint8_t  ok;
+
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(var == data);
+}
+
+void test_read_ref16(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int16_t  data = -1234;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED16, (CO_DATA)(&data)};
+    int16_t  var  = 0;
+    uint8_t  ok;
+
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(var == data);
+}
+
+void test_read_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED32, (CO_DATA)(0x22334455)};
+    uint32_t var = 0;
+    uint8_t  ok;
+
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(var == 0x22334455);
+}
+
+void test_read_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x33445566;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TUNSIGNED32, (CO_DATA)(&data)};
+    uint32_t var = 0;
+    uint8_t  ok;
+
+    AppNode.NodeId = 7;
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(var == data + 7);
+}
+
+void test_read_same_as_type(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int8_t   data = -5;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TSIGNED8, (CO_DATA)(&data)};
+    int8_t   fast = 0;
+    int8_t   slow = 0;
+    uint8_t  ok;
+    CO_ERR   err;
+
+    AppNode.NodeId = 3;
+    ok  = COObjRdFast(&Obj, &AppNode, &fast, sizeof(fast));
+    err = Obj.Type->Read(&Obj, &AppNode, &slow, sizeof(slow));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(fast == slow);
+}
+
+void test_read_width(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x11223344;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&data)};
+    uint16_t var  = 0x5566;
+    uint8_t  ok;
+
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 0);
+    TEST_CHECK(var == 0x5566);
+}
+
+void test_read_other_type(void)
+{
+    CO_NODE    AppNode = { 0 };
+    uint8_t    mem[4]  = { 1, 2, 3, 4 };
+    CO_OBJ_DOM dom     = { 0, sizeof(mem), &mem[0] };
+    CO_OBJ     Obj     = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&dom)};
+    uint32_t   var     = 0;
+    uint8_t    ok;
+
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 0);
+    TEST_CHECK(var == 0);
+}
+
+void test_read_wide(void)
+{
+    CO_NODE  AppNode = { 0 };
+    double   data = -2.75;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL64, (CO_DATA)(&data)};
+    double   var  = 0.0;
+    uint8_t  ok;
+
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(var == data);
+}
+
+void test_read_wide_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0x1122334455667788;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TUNSIGNED64, (CO_DATA)(&data)};
+    uint64_t var  = 0;
+    uint8_t  ok;
+
+    AppNode.NodeId = 7;
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 0);
+    TEST_CHECK(var == 0);
+}
+
+void test_read_real32_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.5f;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TREAL32, (CO_DATA)(&data)};
+    float    var  = 0.0f;
+    uint8_t  ok;
+
+    AppNode.NodeId = 7;
+    ok = COObjRdFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 0);
+    TEST_CHECK(var == 0.0f);
+}
+
+void test_read_bad_node(void)
+{
+    uint32_t var = 0x44556677;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED32, (CO_DATA)(0x11223344)};
+    uint8_t  ok;
+
+    ok = COObjRdFast(&Obj, NULL, &var, sizeof(var));
+
+    TEST_CHECK(ok == 0);
+    TEST_CHECK(var == 0x44556677);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint16_t data = 0x1122;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&data)};
+    uint16_t var  = 0x3344;
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(data == 0x3344);
+}
+
+void test_write_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0x22)};
+    uint8_t  var = 0x33;
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK((uint32_t)Obj.Data == 0x33);
+}
+
+void test_write_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x33445566;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TUNSIGNED32, (CO_DATA)(&data)};
+    uint32_t var = 0x44556677 + 7;
+    uint8_t  ok;
+
+    AppNode.NodeId = 7;
+    ok = COObjWrFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(data == 0x44556677);
+}
+
+void test_write_pdo_async(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int32_t  data = 1;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ___APRW), CO_TSIGNED32, (CO_DATA)(&data)};
+    int32_t  var = -2;
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(data == -2);
+    TEST_CHECK(StubPdoTrigObj == 1);
+}
+
+void test_write_pdo(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x33445566;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&data)};
+    uint32_t var = 0x44556677;
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(data == 0x44556677);
+    TEST_CHECK(StubPdoTrigObj == 0);
+}
+
+void test_write_other_type(void)
+{
+    CO_NODE    AppNode = { 0 };
+    uint8_t    mem[4]  = { 1, 2, 3, 4 };
+    CO_OBJ_DOM dom     = { 0, sizeof(mem), &mem[0] };
+    CO_OBJ     Obj     = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&dom)};
+    uint32_t   var     = 0;
+    uint8_t    ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 0);
+    TEST_CHECK(mem[0] == 1);
+}
+
+void test_write_wide(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int64_t  data = 1;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ___APRW), CO_TSIGNED64, (CO_DATA)(&data)};
+    int64_t  var  = -0x1122334455667788;
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(data == -0x1122334455667788);
+    TEST_CHECK(StubPdoTrigObj == 1);
+}
+
+void test_write_u48(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED48, (CO_DATA)(&data)};
+    uint8_t  var[6] = { 0x66, 0x55, 0x44, 0x33, 0x22, 0x11 };
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var[0], sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(data == 0x112233445566);
+}
+
+void test_write_u48_upper(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0xAABBCCDDEEFF0011;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED48, (CO_DATA)(&data)};
+    uint8_t  var[6] = { 0x66, 0x55, 0x44, 0x33, 0x22, 0x11 };
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, &AppNode, &var[0], sizeof(var));
+
+    TEST_CHECK(ok == 1);
+    TEST_CHECK(data == 0x112233445566);
+}
+
+void test_write_bad_node(void)
+{
+    uint32_t var = 0x44556677;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED32, (CO_DATA)(0x11223344)};
+    uint8_t  ok;
+
+    ok = COObjWrFast(&Obj, NULL, &var, sizeof(var));
+
+    TEST_CHECK(ok == 0);
+    TEST_CHECK((uint32_t)Obj.Data == 0x11223344);
+}
+
+/******************************************************************************
+* TEST CASES - STACK API
+******************************************************************************/
+
+void test_api_read(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint16_t data = 0x1234;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&data)};
+    uint16_t var  = 0;
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(var == data);
+}
+
+void test_api_write(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint16_t data = 0x1234;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&data)};
+    uint16_t var  = 0x4321;
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 0x4321);
+}
+
+void test_api_bad_node(void)
+{
+    uint32_t var = 0x44556677;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED32, (CO_DATA)(0x11223344)};
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, NULL, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(var == 0x44556677);
+}
+
+
+TEST_LIST = {
+    { "read_ref8",         test_read_ref8         },
+    { "read_ref16",        test_read_ref16        },
+    { "read_direct",       test_read_direct       },
+    { "read_nodeid",       test_read_nodeid       },
+    { "read_same_as_type", test_read_same_as_type },
+    { "read_width",        test_read_width        },
+    { "read_other_type",   test_read_other_type   },
+    { "read_wide",         test_read_wide         },
+    { "read_wide_nodeid",  test_read_wide_nodeid  },
+    { "read_real32_nodeid",test_read_real32_nodeid},
+    { "read_bad_node",     test_read_bad_node     },
+    { "write_ref",         test_write_ref         },
+    { "write_direct",      test_write_direct      },
+    { "write_nodeid",      test_write_nodeid      },
+    { "write_pdo_async",   test_write_pdo_async   },
+    { "write_pdo",         test_write_pdo         },
+    { "write_other_type",  test_write_other_type  },
+    { "write_wide",        test_write_wide        },
+    { "write_u48",         test_write_u48         },
+    { "write_u48_upper",   test_write_u48_upper   },
+    { "write_bad_node",    test_write_bad_node    },
+    { "api_read",          test_api_read          },
+    { "api_write",         test_api_write         },
+    { "api_bad_node",      test_api_bad_node      },
+    { NULL, NULL }
+};
@@ -0,0 +1,262 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "co_real32.h"
+
+void StubReset(void);
+#define TEST_INIT StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASE - STUB FUNCTIONS
+******************************************************************************/
+
+uint32_t StubPdoTrigObj = 0;
+void COTPdoTrigObj(CO_TPDO *tpdo, CO_OBJ *obj)
+{
+    StubPdoTrigObj++;
+}
+
+void StubReset(void)
+{
+    StubPdoTrigObj = 0;
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_unknown(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.5f;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL32, (CO_DATA)(&data)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 0);
+
+    TEST_CHECK(size == 4);
+}
+
+void test_size_known(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.5f;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL32, (CO_DATA)(&data)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 4);
+
+    TEST_CHECK(size == 4);
+}
+
+void test_bad_size(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.5f;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL32, (CO_DATA)(&data)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 2);
+
+    TEST_CHECK(size == 4);
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = -12.25f;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL32, (CO_DATA)(&data)};
+    float    var  = 0.0f;
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(var == data);
+}
+
+void test_read_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TREAL32, (CO_DATA)(0x3FC00000)};
+    float    var = 0.0f;
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(var == 1.5f);
+}
+
+void test_read_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 2.5f;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TREAL32, (CO_DATA)(&data)};
+    float    var = 0.0f;
+    CO_ERR   err;
+
+    AppNode.NodeId = 7;
+    err = COObjRdValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(var == 2.5f);
+}
+
+void test_read_bad_size(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = -12.25f;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL32, (CO_DATA)(&data)};
+    uint16_t var = 0x4455;
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(var == 0x4455);
+}
+
+void test_read_bad_node(void)
+{
+    float    var = 3.0f;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TREAL32, (CO_DATA)(0x3FC00000)};
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, NULL, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(var == 3.0f);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.0f;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL32, (CO_DATA)(&data)};
+    float    var  = -0.125f;
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == -0.125f);
+}
+
+void test_write_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TREAL32, (CO_DATA)(0)};
+    float    var = 1.5f;
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK((uint32_t)Obj.Data == 0x3FC00000);
+}
+
+void test_write_pdo_async(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.0f;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ___APRW), CO_TREAL32, (CO_DATA)(&data)};
+    float    var = 2.0f;
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 2.0f);
+    TEST_CHECK(StubPdoTrigObj == 1);
+}
+
+void test_write_pdo(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.0f;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ____PRW), CO_TREAL32, (CO_DATA)(&data)};
+    float    var = 2.0f;
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 2.0f);
+    TEST_CHECK(StubPdoTrigObj == 0);
+}
+
+void test_write_bad_size(void)
+{
+    CO_NODE  AppNode = { 0 };
+    float    data = 1.0f;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL32, (CO_DATA)(&data)};
+    uint16_t var = 0x4455;
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(data == 1.0f);
+}
+
+void test_write_bad_node(void)
+{
+    float    var = 2.0f;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TREAL32, (CO_DATA)(0x3FC00000)};
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, NULL, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK((uint32_t)Obj.Data == 0x3FC00000);
+}
+
+
+TEST_LIST = {
+    { "size_unknown",    test_size_unknown    },
+    { "size_known",      test_size_known      },
+    { "bad_size",        test_bad_size        },
+    { "read_ref",        test_read_ref        },
+    { "read_direct",     test_read_direct     },
+    { "read_nodeid",     test_read_nodeid     },
+    { "read_bad_size",   test_read_bad_size   },
+    { "read_bad_node",   test_read_bad_node   },
+    { "write_ref",       test_write_ref       },
+    { "write_direct",    test_write_direct    },
+    { "write_pdo_async", test_write_pdo_async },
+    { "write_pdo",       test_write_pdo       },
+    { "write_bad_size",  test_write_bad_size  },
+    { "write_bad_node",  test_write_bad_node  },
+    { NULL, NULL }
+};
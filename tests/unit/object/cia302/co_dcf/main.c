@@ -0,0 +1,373 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "co_dcf.h"
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASE - HELPER FUNCTIONS
+******************************************************************************/
+
+static CO_DCF   Dcf;
+static uint8_t  DcfBuf[128];
+static uint8_t  Val8;
+static uint16_t Val16;
+static uint32_t Val32;
+static uint32_t ValRo;
+
+/* object dictionary: 1F22:1 and the configured objects 2000:1..4 */
+static CO_OBJ   Obj[5];
+
+/* 3 byte object type, which refuses every write */
+static uint32_t FailSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    (void)obj;
+    (void)node;
+    (void)width;
+    return (3u);
+}
+
+static CO_ERR FailWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    (void)obj;
+    (void)node;
+    (void)buffer;
+    (void)size;
+    return (CO_ERR_TYPE_WR);
+}
+
+static const CO_OBJ_TYPE FailType = { FailSize, 0, 0, FailWrite };
+
+static void DcfSetup(CO_NODE *node)
+{
+    CO_OBJ dict[5] = {
+        { CO_KEY(0x1F22, 1, CO_OBJ______W), CO_TDCF,        (CO_DATA)(&Dcf)   },
+        { CO_KEY(0x2000, 1, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&Val8)  },
+        { CO_KEY(0x2000, 2, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&Val16) },
+        { CO_KEY(0x2000, 3, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&Val32) },
+        { CO_KEY(0x2000, 4, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&ValRo) },
+    };
+
+    memcpy(Obj, dict, sizeof(Obj));
+    memset(&Dcf, 0, sizeof(Dcf));
+    Dcf.Buf  = DcfBuf;
+    Dcf.Size = sizeof(DcfBuf);
+    Val8  = 0;
+    Val16 = 0;
+    Val32 = 0;
+    ValRo = 0;
+    CODictInit(&node->Dict, node, &Obj[0], 5);
+}
+
+/* concise DCF with the values 0x11 (2000:1), 0x2233 (2000:2), 0x44556677 (2000:3) */
+static uint32_t DcfCreate(uint8_t *buf, uint32_t size)
+{
+    static const uint8_t v8[1]  = { 0x11 };
+    static const uint8_t v16[2] = { 0x33, 0x22 };
+    static const uint8_t v32[4] = { 0x77, 0x66, 0x55, 0x44 };
+    CO_DCF_ENTRY entry[3] = {
+        { CO_DEV(0x2000, 1), 1, v8  },
+        { CO_DEV(0x2000, 2), 2, v16 },
+        { CO_DEV(0x2000, 3), 4, v32 },
+    };
+
+    return (CODcfBuild(entry, 3, buf, size));
+}
+
+/* write like the SDO server: announce the size (total), first buffer with
+   offset reset, then in order */
+static CO_ERR DcfDownload(CO_NODE *node, uint8_t *data, uint32_t size, uint32_t total, uint32_t chunk)
+{
+    uint32_t pos = 0;
+    uint32_t num;
+    CO_ERR   err;
+
+    (void)COObjGetSize(&Obj[0], node, total);
+    err = COObjReset(&Obj[0], node, 0);
+    while ((err == CO_ERR_NONE) && (pos < size)) {
+        num = size - pos;
+        if (num > chunk) {
+            num = chunk;
+        }
+        err = COObjWrValue(&Obj[0], node, &data[pos], (uint8_t)num);
+        pos += num;
+    }
+    return (err);
+}
+
+/******************************************************************************
+* TEST CASES - BUILD
+******************************************************************************/
+
+void test_build_entries(void)
+{
+    uint8_t  buf[32];
+    uint32_t len;
+
+    len = DcfCreate(buf, sizeof(buf));
+
+    TEST_CHECK(len == 4 + 8 + 9 + 11);
+    TEST_CHECK(buf[0] == 3 && buf[1] == 0 && buf[2] == 0 && buf[3] == 0);
+    TEST_CHECK(buf[4] == 0x00 && buf[5] == 0x20 && buf[6] == 1);    /* 2000:1 */
+    TEST_CHECK(buf[7] == 1 && buf[8] == 0 && buf[9] == 0 && buf[10] == 0);
+    TEST_CHECK(buf[11] == 0x11);
+    TEST_CHECK(buf[14] == 2 && buf[15] == 2 && buf[19] == 0x33 && buf[20] == 0x22);
+    TEST_CHECK(buf[23] == 3 && buf[24] == 4 && buf[28] == 0x77 && buf[31] == 0x44);
+}
+
+void test_build_too_small(void)
+{
+    uint8_t  buf[31];
+    uint32_t len;
+
+    len = DcfCreate(buf, sizeof(buf));
+
+    TEST_CHECK(len == 0);
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_data(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t size;
+
+    DcfSetup(&AppNode);
+    size = COObjGetSize(&Obj[0], &AppNode, 0);
+
+    TEST_CHECK(size == sizeof(DcfBuf));
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_apply(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len = DcfCreate(buf, sizeof(buf));
+    err = DcfDownload(&AppNode, buf, len, len, 7);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(Dcf.Result == 0);
+    TEST_CHECK(Dcf.Checked == 3);
+    TEST_CHECK(Val8  == 0x11);
+    TEST_CHECK(Val16 == 0x2233);
+    TEST_CHECK(Val32 == 0x44556677);
+}
+
+void test_write_partial(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len = DcfCreate(buf, sizeof(buf));
+    err = DcfDownload(&AppNode, buf, len - 1, len, 7);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(Dcf.Result == CO_DCF_BUSY);
+    TEST_CHECK(Dcf.Checked == 2);
+    TEST_CHECK(Val8  == 0);                     /* nothing applied yet */
+    TEST_CHECK(Val16 == 0);
+}
+
+void test_write_truncated(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len = DcfCreate(buf, sizeof(buf));
+    err = DcfDownload(&AppNode, buf, len - 1, len - 1, 7);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x06070013);
+    TEST_CHECK(Dcf.Checked == 2);
+    TEST_CHECK(Val8  == 0);                     /* nothing applied */
+    TEST_CHECK(Val16 == 0);
+}
+
+void test_write_trunc_head(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len = DcfCreate(buf, sizeof(buf));
+    err = DcfDownload(&AppNode, buf, 3, 3, 7);
+
+    TEST_CHECK(len > 3);
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x06070013);
+    TEST_CHECK(Dcf.Num == 0);
+}
+
+void test_write_apply_fail(void)
+{
+    static const uint8_t v8[1]  = { 0x11 };
+    static const uint8_t v24[3] = { 1, 2, 3 };
+    CO_DCF_ENTRY entry[2] = {
+        { CO_DEV(0x2000, 1), 1, v8  },
+        { CO_DEV(0x2000, 4), 3, v24 },
+    };
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    Obj[4].Key  = CO_KEY(0x2000, 4, CO_OBJ_____RW);
+    Obj[4].Type = (CO_OBJ_TYPE *)&FailType;
+    len = CODcfBuild(entry, 2, buf, sizeof(buf));
+    err = DcfDownload(&AppNode, buf, len, len, 7);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x08000020);
+    TEST_CHECK(Dcf.Checked == 2);
+    TEST_CHECK(Val8 == 0x11);                   /* written before the failure */
+}
+
+void test_write_no_obj(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len    = DcfCreate(buf, sizeof(buf));
+    buf[23] = 9;                                /* 2000:3 -> 2000:9 */
+    err    = DcfDownload(&AppNode, buf, len, len, 7);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x06020000);
+    TEST_CHECK(Val8  == 0);                     /* checked entries unchanged */
+    TEST_CHECK(Val16 == 0);
+}
+
+void test_write_read_only(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len    = DcfCreate(buf, sizeof(buf));
+    buf[23] = 4;                                /* 2000:3 -> 2000:4 */
+    err    = DcfDownload(&AppNode, buf, len, len, 7);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x06010002);
+    TEST_CHECK(ValRo == 0);
+    TEST_CHECK(Val8  == 0);
+}
+
+void test_write_bad_len(void)
+{
+    static const uint8_t v32[4] = { 1, 2, 3, 4 };
+    CO_DCF_ENTRY entry = { CO_DEV(0x2000, 2), 4, v32 };
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[16];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len = CODcfBuild(&entry, 1, buf, sizeof(buf));
+    err = DcfDownload(&AppNode, buf, len, len, 7);
+
+    TEST_CHECK(len == 15);
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x06070012);
+    TEST_CHECK(Val16 == 0);
+}
+
+void test_write_too_long(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[32];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    Dcf.Size = 24;
+    len = DcfCreate(buf, sizeof(buf));
+    err = DcfDownload(&AppNode, buf, len, len, 7);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x05040005);
+    TEST_CHECK(Val8 == 0);
+}
+
+void test_write_trailing(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint8_t  buf[33];
+    uint32_t len;
+    CO_ERR   err;
+
+    DcfSetup(&AppNode);
+    len = DcfCreate(buf, sizeof(buf));
+    buf[len] = 0;
+    err = DcfDownload(&AppNode, buf, len + 1, len + 1, 11);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Dcf.Result == 0x06070012);
+    TEST_CHECK(Val32 == 0);
+}
+
+/******************************************************************************
+* TEST RUNNER
+******************************************************************************/
+
+TEST_LIST = {
+    { "build_entries",     test_build_entries     },
+    { "build_too_small",   test_build_too_small   },
+    { "size_data",         test_size_data         },
+    { "write_apply",       test_write_apply       },
+    { "write_partial",     test_write_partial     },
+    { "write_truncated",   test_write_truncated   },
+    { "write_trunc_head",  test_write_trunc_head  },
+    { "write_apply_fail",  test_write_apply_fail  },
+    { "write_no_obj",      test_write_no_obj      },
+    { "write_read_only",   test_write_read_only   },
+    { "write_bad_len",     test_write_bad_len     },
+    { "write_too_long",    test_write_too_long    },
+    { "write_trailing",    test_write_trailing    },
+    { NULL, NULL }
+};
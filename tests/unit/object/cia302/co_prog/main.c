@@ -0,0 +1,410 @@
+/******************************************************************************
+   Copyright (c) 2025 Michael Stinger
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "co_prog.h"
+#include "co_crc16.h"
+
+void StubReset(void);
+#define TEST_INIT StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASE - STUB FUNCTIONS
+******************************************************************************/
+
+#define STUB_FLASH_SIZE  (3u * CO_PROG_SECTOR)
+
+uint8_t  StubFlash[STUB_FLASH_SIZE];
+uint32_t StubErase   = 0;
+uint32_t StubProgram = 0;
+uint32_t StubBadAlign = 0;
+int16_t  StubFail    = 0;
+uint32_t StubStart   = 0;
+int16_t  StubStartResult = 0;
+
+int16_t StubFlashErase(uint32_t offset, uint32_t size)
+{
+    if (((offset % CO_PROG_SECTOR) != 0) || (offset + size > STUB_FLASH_SIZE)) {
+        StubBadAlign++;
+        return (-1);
+    }
+    memset(&StubFlash[offset], 0xFF, size);
+    StubErase++;
+    return (0);
+}
+
+int16_t StubFlashProgram(uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    uint32_t i;
+
+    if (((offset % CO_PROG_PAGE) != 0) || (size != CO_PROG_PAGE) ||
+        (offset + size > STUB_FLASH_SIZE)) {
+        StubBadAlign++;
+        return (-1);
+    }
+    if (StubFail != 0) {
+        return (StubFail);
+    }
+    for (i = 0; i < size; i++) {
+        StubFlash[offset + i] &= data[i];       /* NOR flash clears bits only */
+    }
+    StubProgram++;
+    return (0);
+}
+
+const CO_PROG_FLASH StubFlashDrv = { StubFlashErase, StubFlashProgram };
+
+int16_t StubProgStart(CO_PROG *prog)
+{
+    (void)prog;
+    StubStart++;
+    return (StubStartResult);
+}
+
+void StubReset(void)
+{
+    memset(StubFlash, 0, sizeof(StubFlash));    /* not erased */
+    StubErase       = 0;
+    StubProgram     = 0;
+    StubBadAlign    = 0;
+    StubFail        = 0;
+    StubStart       = 0;
+    StubStartResult = 0;
+}
+
+/******************************************************************************
+* TEST CASE - HELPER FUNCTIONS
+******************************************************************************/
+
+static CO_PROG Prog;
+
+static void ProgSetup(void)
+{
+    memset(&Prog, 0, sizeof(Prog));
+    Prog.Flash = &StubFlashDrv;
+    Prog.Size  = STUB_FLASH_SIZE;
+    Prog.Start = StubProgStart;
+}
+
+/* image with counting bytes and the CRC of these bytes at the end */
+static void ProgImage(uint8_t *img, uint32_t size)
+{
+    uint32_t i;
+    uint16_t crc;
+
+    for (i = 0; i < size - 2; i++) {
+        img[i] = (uint8_t)(i * 7u);
+    }
+    crc = COCrc16(0, img, size - 2);
+    img[size - 2] = (uint8_t)(crc >> 8);
+    img[size - 1] = (uint8_t)(crc);
+}
+
+/* write like the SDO server: first buffer with offset reset, then in order */
+static CO_ERR ProgDownload(CO_OBJ *obj, CO_NODE *node, uint8_t *img, uint32_t size, uint32_t chunk)
+{
+    uint32_t pos = 0;
+    uint32_t num;
+    CO_ERR   err;
+
+    err = COObjReset(obj, node, 0);
+    while ((err == CO_ERR_NONE) && (pos < size)) {
+        num = size - pos;
+        if (num > chunk) {
+            num = chunk;
+        }
+        err = COObjWrValue(obj, node, &img[pos], (uint8_t)num);
+        pos += num;
+    }
+    return (err);
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_data(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    uint32_t size;
+
+    ProgSetup();
+    size = COObjGetSize(&Obj, &AppNode, 0);
+
+    TEST_CHECK(size == STUB_FLASH_SIZE);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_pages(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    uint8_t  img[600];
+    CO_ERR   err;
+
+    ProgSetup();
+    ProgImage(img, sizeof(img));
+    err = ProgDownload(&Obj, &AppNode, img, sizeof(img), 127);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(Prog.Offset == 600);
+    TEST_CHECK(StubProgram == 2);               /* tail kept in page buffer */
+    TEST_CHECK(StubErase == 2);                 /* sector 0 and erase ahead */
+    TEST_CHECK(StubBadAlign == 0);
+    TEST_CHECK(memcmp(StubFlash, img, 512) == 0);
+    TEST_CHECK(StubFlash[512] == 0xFF);
+}
+
+void test_write_erase_ahead(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    uint8_t  img[CO_PROG_SECTOR + 300];
+    CO_ERR   err;
+
+    ProgSetup();
+    ProgImage(img, sizeof(img));
+    err = ProgDownload(&Obj, &AppNode, img, sizeof(img), 200);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(StubErase == 3);                 /* limited to partition size */
+    TEST_CHECK(StubBadAlign == 0);
+    TEST_CHECK(memcmp(StubFlash, img, CO_PROG_SECTOR + 256) == 0);
+}
+
+void test_write_too_long(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    uint8_t  img[600];
+    CO_ERR   err;
+
+    ProgSetup();
+    Prog.Size = 512;
+    ProgImage(img, sizeof(img));
+    err = ProgDownload(&Obj, &AppNode, img, sizeof(img), 250);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Prog.Status == CO_PROG_ERR_ADDR);
+    TEST_CHECK(Prog.Offset == 500);
+}
+
+void test_write_started(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    uint8_t  img[16] = { 0 };
+    CO_ERR   err;
+
+    ProgSetup();
+    Prog.State = CO_PROG_START;
+    err = ProgDownload(&Obj, &AppNode, img, sizeof(img), 16);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Prog.Offset == 0);
+    TEST_CHECK(StubErase == 0);
+}
+
+void test_write_flash_err(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    uint8_t  img[600];
+    CO_ERR   err;
+
+    ProgSetup();
+    ProgImage(img, sizeof(img));
+    StubFail = -1;
+    err = ProgDownload(&Obj, &AppNode, img, sizeof(img), 250);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Prog.Status == CO_PROG_ERR_WRITE);
+}
+
+/******************************************************************************
+* TEST CASES - PROGRAM CONTROL
+******************************************************************************/
+
+void test_ctrl_start(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Data = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    CO_OBJ   Ctrl = { CO_KEY(0x1F51, 1, CO_OBJ_____RW), CO_TPROG_CTRL, (CO_DATA)(&Prog)};
+    uint8_t  img[600];
+    uint8_t  cmd = CO_PROG_START;
+    uint8_t  state = 0xFF;
+    CO_ERR   err;
+
+    ProgSetup();
+    ProgImage(img, sizeof(img));
+    (void)ProgDownload(&Data, &AppNode, img, sizeof(img), 127);
+    err = COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(StubStart == 1);
+    TEST_CHECK(StubProgram == 3);               /* tail page with padding */
+    TEST_CHECK(memcmp(StubFlash, img, sizeof(img)) == 0);
+    TEST_CHECK(StubFlash[sizeof(img)] == 0xFF);
+
+    err = COObjRdValue(&Ctrl, &AppNode, &state, sizeof(state));
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(state == CO_PROG_START);
+}
+
+void test_ctrl_bad_crc(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Data = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    CO_OBJ   Ctrl = { CO_KEY(0x1F51, 1, CO_OBJ_____RW), CO_TPROG_CTRL, (CO_DATA)(&Prog)};
+    CO_OBJ   Stat = { CO_KEY(0x1F57, 1, CO_OBJ_____R_), CO_TPROG_STAT, (CO_DATA)(&Prog)};
+    uint8_t  img[600];
+    uint8_t  cmd = CO_PROG_START;
+    uint32_t status = 0;
+    CO_ERR   err;
+
+    ProgSetup();
+    ProgImage(img, sizeof(img));
+    img[100] ^= 0x01;
+    (void)ProgDownload(&Data, &AppNode, img, sizeof(img), 127);
+    err = COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(StubStart == 0);
+    TEST_CHECK(Prog.State == CO_PROG_STOP);
+
+    err = COObjRdValue(&Stat, &AppNode, &status, sizeof(status));
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(status == (CO_PROG_ERR_FORMAT << 1));
+}
+
+void test_ctrl_rejected(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Data = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    CO_OBJ   Ctrl = { CO_KEY(0x1F51, 1, CO_OBJ_____RW), CO_TPROG_CTRL, (CO_DATA)(&Prog)};
+    uint8_t  img[64];
+    uint8_t  cmd = CO_PROG_START;
+    CO_ERR   err;
+
+    ProgSetup();
+    ProgImage(img, sizeof(img));
+    StubStartResult = -1;
+    (void)ProgDownload(&Data, &AppNode, img, sizeof(img), 64);
+    err = COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(StubStart == 1);
+    TEST_CHECK(Prog.State == CO_PROG_STOP);
+    TEST_CHECK(Prog.Status == CO_PROG_ERR_NONE);
+}
+
+void test_ctrl_clear(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Data = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    CO_OBJ   Ctrl = { CO_KEY(0x1F51, 1, CO_OBJ_____RW), CO_TPROG_CTRL, (CO_DATA)(&Prog)};
+    uint8_t  img[600];
+    uint8_t  cmd;
+    CO_ERR   err;
+
+    ProgSetup();
+    ProgImage(img, sizeof(img));
+    (void)ProgDownload(&Data, &AppNode, img, sizeof(img), 127);
+    cmd = CO_PROG_START;
+    (void)COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+
+    cmd = CO_PROG_CLEAR;
+    err = COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+    TEST_CHECK(err == CO_ERR_TYPE_WR);          /* program is running */
+
+    cmd = CO_PROG_STOP;
+    err = COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+    TEST_CHECK(err == CO_ERR_NONE);
+    cmd = CO_PROG_CLEAR;
+    err = COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(Prog.Offset == 0);
+    TEST_CHECK(Prog.Erased == 0);
+    TEST_CHECK(Prog.Crc == 0);
+}
+
+void test_ctrl_bad_cmd(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Ctrl = { CO_KEY(0x1F51, 1, CO_OBJ_____RW), CO_TPROG_CTRL, (CO_DATA)(&Prog)};
+    uint8_t  cmd = 4;
+    CO_ERR   err;
+
+    ProgSetup();
+    err = COObjWrValue(&Ctrl, &AppNode, &cmd, sizeof(cmd));
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(Prog.State == CO_PROG_STOP);
+}
+
+/******************************************************************************
+* TEST CASES - FLASH STATUS
+******************************************************************************/
+
+void test_stat_progress(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Data = { CO_KEY(0x1F50, 1, CO_OBJ______W), CO_TPROG_DATA, (CO_DATA)(&Prog)};
+    CO_OBJ   Stat = { CO_KEY(0x1F57, 1, CO_OBJ_____R_), CO_TPROG_STAT, (CO_DATA)(&Prog)};
+    uint8_t  img[100];
+    uint32_t status = 0xFFFFFFFF;
+    CO_ERR   err;
+
+    ProgSetup();
+    err = COObjRdValue(&Stat, &AppNode, &status, sizeof(status));
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(status == 0);
+
+    ProgImage(img, sizeof(img));
+    (void)ProgDownload(&Data, &AppNode, img, sizeof(img), 50);
+    err = COObjRdValue(&Stat, &AppNode, &status, sizeof(status));
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(status == 1);
+}
+
+
+TEST_LIST = {
+    { "size_data",         test_size_data         },
+    { "write_pages",       test_write_pages       },
+    { "write_erase_ahead", test_write_erase_ahead },
+    { "write_too_long",    test_write_too_long    },
+    { "write_started",     test_write_started     },
+    { "write_flash_err",   test_write_flash_err   },
+    { "ctrl_start",        test_ctrl_start        },
+    { "ctrl_bad_crc",      test_ctrl_bad_crc      },
+    { "ctrl_rejected",     test_ctrl_rejected     },
+    { "ctrl_clear",        test_ctrl_clear        },
+    { "ctrl_bad_cmd",      test_ctrl_bad_cmd      },
+    { "stat_progress",     test_stat_progress     },
+    { NULL, NULL }
+};